@@ -0,0 +1,137 @@
+/*
+ * ThreadPool.cpp
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: a1994846931931
+ */
+
+# include "ThreadPool.h"
+
+namespace robot{
+namespace common{
+
+ThreadPool::ThreadPool(unsigned int threads) :
+		_generation(0),
+		_busy(0),
+		_stop(false),
+		_func(NULL),
+		_count(0),
+		_chunk(1),
+		_next(0)
+{
+	if (threads == 0)
+		threads = std::thread::hardware_concurrency();
+	if (threads == 0)
+		threads = 1;
+	// 调用线程也参与计算
+	for (unsigned int i=1; i<threads; i++)
+		_workers.push_back(std::thread(&ThreadPool::workerLoop, this));
+}
+
+unsigned int ThreadPool::size() const
+{
+	return _workers.size() + 1;
+}
+
+void ThreadPool::parallelFor(int count, int chunk, const std::function<void(int, int)>& func)
+{
+	if (count <= 0)
+		return;
+	if (chunk <= 0)
+		throw("错误<ThreadPool>: 分块大小必须大于0!");
+	std::lock_guard<std::mutex> call(_callMutex);
+	{
+		std::lock_guard<std::mutex> lock(_mutex);
+		_func = &func;
+		_count = count;
+		_chunk = chunk;
+		_next = 0;
+		_error = std::exception_ptr();
+		_busy = _workers.size();
+		_generation++;
+	}
+	_start.notify_all();
+	runChunks();
+	std::unique_lock<std::mutex> lock(_mutex);
+	_done.wait(lock, [this]{ return _busy == 0; });
+	_func = NULL;
+	if (_error)
+		std::rethrow_exception(_error);
+}
+
+void ThreadPool::runChunks()
+{
+	for (;;)
+	{
+		const int begin = _next.fetch_add(_chunk);
+		if (begin >= _count)
+			return;
+		const int end = (begin + _chunk < _count) ? (begin + _chunk) : _count;
+		try
+		{
+			(*_func)(begin, end);
+		}
+		catch (...)
+		{
+			std::lock_guard<std::mutex> lock(_mutex);
+			if (!_error)
+				_error = std::current_exception();
+			_next = _count; // 不再领取新的分块
+		}
+	}
+}
+
+void ThreadPool::workerLoop()
+{
+	unsigned long long generation = 0;
+	for (;;)
+	{
+		{
+			std::unique_lock<std::mutex> lock(_mutex);
+			_start.wait(lock, [this, generation]{ return _stop || _generation != generation; });
+			if (_stop)
+				return;
+			generation = _generation;
+		}
+		runChunks();
+		{
+			std::lock_guard<std::mutex> lock(_mutex);
+			_busy--;
+		}
+		_done.notify_one();
+	}
+}
+
+ThreadPool& ThreadPool::global()
+{
+	static ThreadPool pool;
+	return pool;
+}
+
+ThreadPool::~ThreadPool()
+{
+	{
+		std::lock_guard<std::mutex> lock(_mutex);
+		_stop = true;
+	}
+	_start.notify_all();
+	for (unsigned int i=0; i<_workers.size(); i++)
+		_workers[i].join();
+}
+
+void ExecPolicy::run(int count, const std::function<void(int, int)>& func) const
+{
+	if (chunk <= 0)
+		throw("错误<ExecPolicy>: 分块大小必须大于0!");
+	if (mode == sequential)
+	{
+		for (int begin=0; begin<count; begin+=chunk)
+			func(begin, (begin + chunk < count) ? (begin + chunk) : count);
+		return;
+	}
+	ThreadPool& threadPool = (pool == NULL) ? ThreadPool::global() : *pool;
+	threadPool.parallelFor(count, chunk, func);
+}
+
+}
+}
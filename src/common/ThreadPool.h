@@ -0,0 +1,135 @@
+/**
+ * @brief 线程池ThreadPool与执行策略ExecPolicy
+ * @date Oct 16, 2026
+ * @author a1994846931931
+ */
+
+#ifndef THREADPOOL_H_
+#define THREADPOOL_H_
+
+# include <vector>
+# include <thread>
+# include <mutex>
+# include <condition_variable>
+# include <atomic>
+# include <functional>
+# include <exception>
+
+namespace robot{
+namespace common{
+
+/**
+ * @addtogroup common
+ * @{
+ */
+
+/**
+ * @brief 固定线程数的线程池, 用于大量相互独立的计算(例如批量正运动学)
+ *
+ * parallelFor把[0, count)按chunk个一组分块, 工作线程和调用线程一起领取分块执行,
+ * 全部完成后才返回. 同一个线程池同一时间只执行一个parallelFor, 其它调用者排队等待.
+ * 分块中抛出的异常在调用线程中重新抛出(只保留第一个).
+ */
+class ThreadPool {
+public:
+	/**
+	 * @brief 构造函数
+	 * @param threads [in] 参与计算的线程数(包括调用线程), 为0时使用硬件线程数
+	 */
+	ThreadPool(unsigned int threads=0);
+
+	/**
+	 * @brief 参与计算的线程数(包括调用线程)
+	 */
+	unsigned int size() const;
+
+	/**
+	 * @brief 分块并行执行
+	 * @param count [in] 总个数
+	 * @param chunk [in] 每块的个数
+	 * @param func [in] 执行函数, 参数为分块的范围[begin, end)
+	 */
+	void parallelFor(int count, int chunk, const std::function<void(int, int)>& func);
+
+	virtual ~ThreadPool();
+public:
+	/**
+	 * @brief 全局共享的线程池(硬件线程数), 首次调用时创建
+	 */
+	static ThreadPool& global();
+private:
+	/** @brief 工作线程的主循环 */
+	void workerLoop();
+
+	/** @brief 领取并执行分块, 直到全部领取完 */
+	void runChunks();
+private:
+	/** @brief 工作线程 */
+	std::vector<std::thread> _workers;
+
+	/** @brief 保证同一时间只有一个parallelFor */
+	std::mutex _callMutex;
+
+	/** @brief 保护下列状态 */
+	std::mutex _mutex;
+	std::condition_variable _start;
+	std::condition_variable _done;
+
+	/** @brief 任务编号, 工作线程据此判断是否有新任务 */
+	unsigned long long _generation;
+
+	/** @brief 尚未完成当前任务的工作线程数 */
+	unsigned int _busy;
+
+	/** @brief 是否退出 */
+	bool _stop;
+
+	/** @brief 当前任务 */
+	const std::function<void(int, int)>* _func;
+	int _count;
+	int _chunk;
+	std::atomic<int> _next;
+
+	/** @brief 第一个异常 */
+	std::exception_ptr _error;
+};
+
+/**
+ * @brief 批量计算的执行策略
+ */
+class ExecPolicy{
+public:
+	/** @brief 执行方式 */
+	enum Mode{
+		sequential = 0, /**< 在调用线程中顺序执行 */
+		parallel /**< 分块后在线程池中并行执行 */
+	};
+
+	/**
+	 * @brief 构造函数
+	 * @param mode [in] 执行方式
+	 * @param chunk [in] 每块的个数
+	 * @param pool [in] 使用的线程池, 为NULL时使用ThreadPool::global()
+	 */
+	ExecPolicy(Mode mode=parallel, int chunk=1024, ThreadPool* pool=NULL) :
+		mode(mode), chunk(chunk), pool(pool){}
+
+	/**
+	 * @brief 按策略执行
+	 * @param count [in] 总个数
+	 * @param func [in] 执行函数, 参数为分块的范围[begin, end)
+	 *
+	 * 顺序执行时同样按chunk分块调用func
+	 */
+	void run(int count, const std::function<void(int, int)>& func) const;
+
+	Mode mode;
+	int chunk;
+	ThreadPool* pool;
+};
+
+/** @} */
+}
+}
+
+#endif /* THREADPOOL_H_ */
@@ -0,0 +1,165 @@
+/*
+ * baketest.cpp
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: a1994846931931
+ *
+ *  BakedTrajectory的测试: 烘焙LinePlanner, MultiLineArcBlendPlanner和QtoQPlanner的轨迹, 统计烘焙用时和分段数,
+ *  以1ms插补周期比较烘焙前后的关节角, 速度和加速度, 以及每个周期getState的用时. 关节空间的直线轨迹
+ *  (LinearInterpolator与SmoothMotionPlanner的速度策略复合)不经过逆解, 再比较顺序和并行烘焙.
+ *  烘焙误差超过允许误差时输出BakedTrajectory拒绝烘焙的信息. 最后比较MotionStack不烘焙和烘焙时addPlanner和每个周期state的用时.
+ */
+
+# include "baketest.h"
+# include "../../trajectory/BakedTrajectory.h"
+# include "../../ik/SiasunSR4CSolver.h"
+# include "../../pathplanner/LinePlanner.h"
+# include "../../pathplanner/MultiLineArcBlendPlanner.h"
+# include "../../pathplanner/SmoothMotionPlanner.h"
+# include "../../trajectory/LinearInterpolator.h"
+# include "../../trajectory/CompositeInterpolator.h"
+# include "../../parse/RobotXMLParser.h"
+# include "../../simulation/MotionStack.h"
+# include "../../common/common.h"
+# include <vector>
+# include <algorithm>
+# include <iostream>
+# include <string>
+
+using namespace robot::math;
+using namespace robot::model;
+using namespace robot::ik;
+using namespace robot::common;
+using namespace robot::trajectory;
+using namespace robot::pathplanner;
+using robot::kinematic::State;
+using robot::simulation::MotionStack;
+using std::vector;
+using std::cout;
+using std::endl;
+
+namespace {
+
+/** @brief 两个关节量之差的最大绝对值 */
+double maxDifference(const Q& a, const Q& b)
+{
+	Q delta = a - b;
+	delta.abs();
+	return delta.getMax();
+}
+
+/**
+ * @brief 烘焙一条轨迹, 比较结果和用时
+ */
+BakedTrajectory::ptr bake(const char* name, Interpolator<Q>::ptr source, const ExecPolicy& policy=ExecPolicy(ExecPolicy::sequential, 64))
+{
+	unsigned long long t0 = getUTime();
+	BakedTrajectory::ptr baked;
+	try
+	{
+		baked.reset(new BakedTrajectory(source, 0.004, 1e-6, policy));
+	}
+	catch (std::string& message)
+	{
+		cout << name << ": " << message << endl;
+		return baked;
+	}
+	unsigned long long t1 = getUTime();
+
+	vector<double> times;
+	for (double t=0; t<source->duration(); t+=0.001)
+		times.push_back(t);
+	double error[3] = {0, 0, 0};
+	PlaybackCursor cursor;
+	for (size_t i=0; i<times.size(); i++)
+	{
+		State a = source->getState(times[i]);
+		State b = baked->getState(times[i], cursor);
+		error[0] = std::max(error[0], maxDifference(a.getAngle(), b.getAngle()));
+		error[1] = std::max(error[1], maxDifference(a.getVelocity(), b.getVelocity()));
+		error[2] = std::max(error[2], maxDifference(a.getAcceleration(), b.getAcceleration()));
+	}
+	double sum = 0;
+	unsigned long long t2 = getUTime();
+	for (size_t i=0; i<times.size(); i++)
+		sum += source->getState(times[i]).getAngle()[0];
+	unsigned long long t3 = getUTime();
+	cursor.reset();
+	for (size_t i=0; i<times.size(); i++)
+		sum += baked->getState(times[i], cursor).getAngle()[0];
+	unsigned long long t4 = getUTime();
+	cout << name << ": 时长" << source->duration() << "s, 烘焙" << (t1 - t0)/1000 << "ms, " << baked->size() << "段, 中点误差"
+			<< baked->getMaxError() << "; 1ms周期最大差: 关节角" << error[0] << ", 速度" << error[1] << ", 加速度" << error[2]
+			<< "; getState " << (double)(t3 - t2)/times.size() << "us, 烘焙后 " << (double)(t4 - t3)/times.size() << "us ("
+			<< sum << ")" << endl;
+	return baked;
+}
+
+/**
+ * @brief 把规划器加入运动堆栈, 以1ms周期获取State直到结束, 统计用时
+ */
+void play(const char* name, Planner::ptr planner, double resolution)
+{
+	Q initial = planner->getQTrajectory()->start();
+	std::mutex mutex;
+	MotionStack stack(initial, &mutex);
+	stack.setBaking(resolution);
+	unsigned long long t0 = getUTime();
+	stack.addPlanner(planner);
+	unsigned long long t1 = getUTime();
+	stack.start();
+	const unsigned long long begin = getUTime();
+	State state;
+	int cycles = 0;
+	unsigned long long t2 = getUTime();
+	while (stack.state(begin + cycles*1000, state) == 0)
+		cycles++;
+	unsigned long long t3 = getUTime();
+	cout << name << ": addPlanner " << (t1 - t0)/1000 << "ms, " << cycles << "个周期, 每周期state " << (double)(t3 - t2)/cycles
+			<< "us, 终点" << state.getAngle()[0] << endl;
+}
+
+}
+
+void baketest()
+{
+	robot::parse::RobotXMLParser modelParser;
+	SerialLink::ptr robot = modelParser.parse("src/example/modelData/siasun6.xml");
+	std::shared_ptr<SiasunSR4CSolver> solver(new SiasunSR4CSolver(robot));
+	const Q dqLim(3, 3, 3, 3, 5, 5), ddqLim(20, 20, 20, 20, 20, 20);
+	const Q start = Q::zero(6);
+
+	LinePlanner line(dqLim, ddqLim, 1.0, 20.0, 50, solver, start, Q(1.5, 0, 0, 0, -1.5, 0));
+	bake("LinePlanner", line.query());
+
+	const Q corners[4] = {Q(-0.3, 0, 0, 0, -1, 0), Q(0.3, 0, 0, 0, -1, 0), Q(0.3, 0.3, 0, 0, -1.2, 0), Q(-0.3, 0.3, 0, 0, -1.2, 0)};
+	const int count = 20;
+	vector<Q> qPath;
+	for (int i=0; i<count; i++)
+		qPath.push_back(corners[i%4]);
+	vector<double> arcRatio(count - 2, 0.3);
+	vector<double> velocity(count - 1, 1.0);
+	vector<double> acceleration(count - 1, 15.0);
+	vector<double> jerk(count - 1, 50.0);
+	MultiLineArcBlendPlanner mlab(dqLim, ddqLim, solver, qPath, arcRatio, velocity, acceleration, jerk);
+	bake("MultiLineArcBlendPlanner", mlab.query());
+
+	SmoothMotionPlanner smPlanner;
+	auto path = std::make_shared<LinearInterpolator<Q> >(start, Q(2, 0.5, 0.5, 0, -1.2, 2), 2);
+	Interpolator<Q>::ptr joint(new CompositeInterpolator<Q>(path, smPlanner.query(2, 100, 10, 1.5)));
+	BakedTrajectory::ptr sequential = bake("关节直线顺序", joint);
+	BakedTrajectory::ptr parallel = bake("关节直线并行", joint, ExecPolicy(ExecPolicy::parallel, 16));
+	if (sequential.get() == NULL || parallel.get() == NULL)
+		return;
+	double difference = 0;
+	for (double t=0; t<joint->duration(); t+=0.001)
+		difference = std::max(difference, maxDifference(sequential->x(t), parallel->x(t)));
+	cout << "顺序与并行烘焙的最大差: " << difference << " (线程池" << ThreadPool::global().size() << "个线程)" << endl;
+
+	for (double resolution : {0.0, 0.004})
+	{
+		Planner::ptr planner(new LinePlanner(dqLim, ddqLim, 1.0, 20.0, 50, solver, start, Q(1.5, 0, 0, 0, -1.5, 0)));
+		planner->doQuery();
+		play((resolution > 0)? "MotionStack烘焙" : "MotionStack不烘焙", planner, resolution);
+	}
+}
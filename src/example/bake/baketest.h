@@ -0,0 +1,15 @@
+/*
+ * baketest.h
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: a1994846931931
+ */
+
+#ifndef BAKETEST_H_
+#define BAKETEST_H_
+
+
+void baketest();
+
+
+#endif /* BAKETEST_H_ */
@@ -0,0 +1,70 @@
+/*
+ * batchfktest.cpp
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: a1994846931931
+ *
+ *  对一百万组关节角度计算末端位姿: 比较逐个调用getEndTransform与getEndTransforms
+ *  (顺序执行, 不同线程数的线程池)的用时, 并检查结果完全相同.
+ */
+
+# include "batchfktest.h"
+# include "../../model/SerialLink.h"
+# include "../../common/ThreadPool.h"
+# include "../../common/common.h"
+# include "../../parse/RobotXMLParser.h"
+# include <vector>
+# include <iostream>
+
+using namespace robot::math;
+using namespace robot::model;
+using namespace robot::common;
+using std::vector;
+using std::cout;
+using std::endl;
+
+void batchfktest()
+{
+	robot::parse::RobotXMLParser modelParser;
+	SerialLink::ptr robot = modelParser.parse("src/example/modelData/siasun6.xml");
+
+	const int size = 1000000;
+	vector<Q> q;
+	q.reserve(size);
+	for (int i=0; i<size; i++)
+		q.push_back(Q(fRand(-3, 3), fRand(-2, 2), fRand(-2, 2), fRand(-3, 3), fRand(-2, 2), fRand(-3, 3)));
+
+	vector<HTransform3D<double> > single(size);
+	unsigned long long start = getUTime();
+	for (int i=0; i<size; i++)
+		single[i] = robot->getEndTransform(q[i]);
+	cout << "逐个getEndTransform: " << (getUTime() - start)/1000.0 << "ms" << endl;
+
+	vector<HTransform3D<double> > batch(size);
+	start = getUTime();
+	robot->getEndTransforms(q, batch, ExecPolicy(ExecPolicy::sequential));
+	cout << "getEndTransforms(顺序, " << TransformBatch::instructionSet() << "): " << (getUTime() - start)/1000.0 << "ms" << endl;
+
+	const unsigned int threads[] = {2, 4, 8};
+	for (int k=0; k<3; k++)
+	{
+		ThreadPool pool(threads[k]);
+		start = getUTime();
+		robot->getEndTransforms(q, batch, ExecPolicy(ExecPolicy::parallel, 4096, &pool));
+		cout << "getEndTransforms(" << threads[k] << "线程): " << (getUTime() - start)/1000.0 << "ms" << endl;
+	}
+
+	bool same = true;
+	for (int i=0; i<size && same; i++)
+	{
+		const HTransform3D<double>& a = single[i];
+		const HTransform3D<double>& b = batch[i];
+		for (int r=0; r<3; r++)
+		{
+			same = same && (a.getPosition()(r) == b.getPosition()(r));
+			for (int c=0; c<3; c++)
+				same = same && (a.getRotation()(r, c) == b.getRotation()(r, c));
+		}
+	}
+	cout << "结果与逐个计算" << (same ? "完全相同" : "不同") << " (硬件线程数: " << ThreadPool::global().size() << ")" << endl;
+}
@@ -0,0 +1,15 @@
+/*
+ * batchfktest.h
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: a1994846931931
+ */
+
+#ifndef BATCHFKTEST_H_
+#define BATCHFKTEST_H_
+
+
+void batchfktest();
+
+
+#endif /* BATCHFKTEST_H_ */
@@ -0,0 +1,110 @@
+/*
+ * codegentest.cpp
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: a1994846931931
+ *
+ *  根据模型文件重新生成model/generated中的运动学代码, 然后比较生成代码与通用SerialLink
+ *  计算的末端位姿, 末端位置和雅克比矩阵(误差应在1e-15量级), 以及两者的用时.
+ */
+
+# include "codegentest.h"
+# include "../../model/SerialLink.h"
+# include "../../model/generated/Siasun6Kinematics.h"
+# include "../../model/generated/Siasun4Kinematics.h"
+# include "../../parse/KinematicsCodeGenerator.h"
+# include "../../parse/RobotXMLParser.h"
+# include "../../common/common.h"
+# include <math.h>
+# include <algorithm>
+# include <iostream>
+
+using namespace robot::math;
+using namespace robot::model;
+using namespace robot::common;
+using std::cout;
+using std::endl;
+
+namespace {
+
+void compare(SerialLink::ptr robot, KinematicsKernel::ptr kernel)
+{
+	const int loop = 1000000;
+	HTransform3D<double> toolTransform(Vector3D<double>(0.01, -0.02, 0.15));
+	Frame tool(toolTransform);
+	robot->setTool(&tool);
+
+	/**> 结果比较 */
+	double fkError = 0, positionError = 0, jacobianError = 0;
+	for (int i=0; i<1000; i++)
+	{
+		Q q(fRand(-3, 3), fRand(-2, 2), fRand(-2, 2), fRand(-3, 3), fRand(-2, 2), fRand(-3, 3));
+		JointTrig trig = robot->getJointTrig(q);
+		robot->setKinematicsKernel(KinematicsKernel::ptr());
+		HTransform3D<double> T1 = robot->getEndTransform(trig);
+		Vector3D<double> p1 = robot->getEndPosition(trig);
+		FixedJacobian<6, 6> J1;
+		robot->getJacobian(trig, J1);
+		robot->setKinematicsKernel(kernel);
+		HTransform3D<double> T2 = robot->getEndTransform(trig);
+		Vector3D<double> p2 = robot->getEndPosition(trig);
+		FixedJacobian<6, 6> J2;
+		robot->getJacobian(trig, J2);
+		for (int r=0; r<3; r++)
+		{
+			for (int c=0; c<4; c++)
+				fkError = std::max(fkError, fabs(T1(r, c) - T2(r, c)));
+			positionError = std::max(positionError, fabs(p1(r) - p2(r)));
+		}
+		for (int k=0; k<36; k++)
+			jacobianError = std::max(jacobianError, fabs(J1.data()[k] - J2.data()[k]));
+	}
+	cout << kernel->getName() << " 最大误差: 位姿 " << fkError << ", 位置 " << positionError
+			<< ", 雅克比矩阵 " << jacobianError << endl;
+
+	/**> 用时比较 */
+	JointTrig trig = robot->getJointTrig(Q(0.3, -0.5, 0.7, 1.1, -0.9, 0.2));
+	double sink = 0;
+	for (int k=0; k<2; k++)
+	{
+		robot->setKinematicsKernel((k == 0) ? KinematicsKernel::ptr() : kernel);
+		const char* name = (k == 0) ? "通用" : "生成";
+		unsigned long long start = getUTime();
+		for (int i=0; i<loop; i++)
+			sink += robot->getEndTransform(trig)(0, 3);
+		cout << "\t" << name << "getEndTransform: " << (getUTime() - start)/1000.0 << "ms" << endl;
+		start = getUTime();
+		for (int i=0; i<loop; i++)
+			sink += robot->getEndPosition(trig)(1);
+		cout << "\t" << name << "getEndPosition: " << (getUTime() - start)/1000.0 << "ms" << endl;
+		start = getUTime();
+		FixedJacobian<6, 6> J;
+		for (int i=0; i<loop; i++)
+		{
+			robot->getJacobian(trig, J);
+			sink += J.data()[i%36];
+		}
+		cout << "\t" << name << "getJacobian: " << (getUTime() - start)/1000.0 << "ms" << endl;
+	}
+	cout << "\t(" << sink << ")" << endl;
+	robot->setKinematicsKernel(KinematicsKernel::ptr());
+	robot->setDefaultTool();
+}
+
+}
+
+void codegentest()
+{
+	robot::parse::RobotXMLParser modelParser;
+	SerialLink::ptr siasun6 = modelParser.parse("src/example/modelData/siasun6.xml");
+	SerialLink::ptr siasun4 = modelParser.parse("src/example/modelData/siasun4.xml");
+
+	/**> 重新生成(模型文件修改后需要重新编译) */
+	robot::parse::KinematicsCodeGenerator(siasun6, "Siasun6Kinematics", "src/example/modelData/siasun6.xml")
+			.write("src/model/generated/Siasun6Kinematics.h");
+	robot::parse::KinematicsCodeGenerator(siasun4, "Siasun4Kinematics", "src/example/modelData/siasun4.xml")
+			.write("src/model/generated/Siasun4Kinematics.h");
+
+	compare(siasun6, KinematicsKernel::ptr(new generated::Siasun6Kinematics()));
+	compare(siasun4, KinematicsKernel::ptr(new generated::Siasun4Kinematics()));
+}
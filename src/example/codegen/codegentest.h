@@ -0,0 +1,15 @@
+/*
+ * codegentest.h
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: a1994846931931
+ */
+
+#ifndef CODEGENTEST_H_
+#define CODEGENTEST_H_
+
+
+void codegentest();
+
+
+#endif /* CODEGENTEST_H_ */
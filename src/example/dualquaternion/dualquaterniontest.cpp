@@ -0,0 +1,118 @@
+/*
+ * dualquaterniontest.cpp
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: a1994846931931
+ *
+ *  比较对偶四元数与变换矩阵计算末端位姿的结果和用时, 并检查ScLERP插补器的起点和终点,
+ *  以及dx, ddx与中心差分的差别.
+ */
+
+# include "dualquaterniontest.h"
+# include "../../model/SerialLink.h"
+# include "../../math/DualQuaternion.h"
+# include "../../trajectory/LinearInterpolator.h"
+# include "../../parse/RobotXMLParser.h"
+# include <time.h>
+# include <algorithm>
+# include <math.h>
+# include <iostream>
+
+using namespace robot::math;
+using namespace robot::model;
+using namespace robot::trajectory;
+using std::cout;
+using std::endl;
+
+namespace {
+
+/**
+ * @brief 两个变换矩阵对应元素之差的最大绝对值
+ */
+double maxError(const HTransform3D<double>& a, const HTransform3D<double>& b)
+{
+	double error = 0;
+	for (int i=0; i<3; i++)
+	{
+		for (int j=0; j<3; j++)
+			error = std::max(error, fabs(a.getRotation()(i, j) - b.getRotation()(i, j)));
+		error = std::max(error, fabs(a.getPosition()(i) - b.getPosition()(i)));
+	}
+	return error;
+}
+
+/**
+ * @brief 两个对偶四元数对应分量之差的最大绝对值
+ */
+double maxError(const DualQuaternion& a, const DualQuaternion& b)
+{
+	double error = 0;
+	for (int i=0; i<4; i++)
+	{
+		error = std::max(error, fabs(a.real(i) - b.real(i)));
+		error = std::max(error, fabs(a.dual(i) - b.dual(i)));
+	}
+	return error;
+}
+
+}
+
+void dualquaterniontest()
+{
+	robot::parse::RobotXMLParser modelParser;
+	SerialLink::ptr robot = modelParser.parse("src/example/modelData/siasun6.xml");
+
+	double error = 0;
+	for (int i=0; i<100; i++)
+	{
+		Q q(i*0.05, 0.5 - i*0.01, -0.5, 0.3 + i*0.02, -1.2, 2 - i*0.03);
+		error = std::max(error, maxError(robot->getEndDualQuaternion(q).toHTransform3D(), robot->getEndTransform(q)));
+	}
+	cout << "对偶四元数与变换矩阵的最大误差: " << error << endl;
+
+	const int loop = 1000000;
+	double sink = 0;
+
+	clock_t start = clock();
+	for (int i=0; i<loop; i++)
+	{
+		Q q(i*1e-5, 0.5, -0.5, 0.3, -1.2, 2);
+		sink += robot->getEndTransform(q).getPosition()(0);
+	}
+	clock_t end = clock();
+	cout << "getEndTransform:      " << (end - start)/(double)loop << "us" << endl;
+
+	start = clock();
+	for (int i=0; i<loop; i++)
+	{
+		Q q(i*1e-5, 0.5, -0.5, 0.3, -1.2, 2);
+		sink += robot->getEndDualQuaternion(q).dual(1);
+	}
+	end = clock();
+	cout << "getEndDualQuaternion: " << (end - start)/(double)loop << "us" << endl;
+	cout << "(" << sink << ")" << endl;
+
+	/**> 一个插补器同时插补位移和姿态 */
+	HTransform3D<double> startPose = robot->getEndTransform(Q(0, 0.5, -0.5, 0.3, -1.2, 2));
+	HTransform3D<double> endPose = robot->getEndTransform(Q(1, 0.2, -0.8, 0.6, -0.9, 1));
+	LinearInterpolator<DualQuaternion> sclerp(DualQuaternion(startPose), DualQuaternion(endPose), 2);
+	cout << "ScLERP起点误差: " << maxError(sclerp.x(0).toHTransform3D(), startPose) << endl;
+	cout << "ScLERP终点误差: " << maxError(sclerp.x(2).toHTransform3D(), endPose) << endl;
+	cout << "ScLERP中点位置: ";
+	sclerp.x(1).getPosition().print();
+
+	/**> dx, ddx与中心差分比较 */
+	const double h = 1e-4;
+	double dxError = 0, ddxError = 0;
+	for (double t=h; t<=2 - h; t+=0.01)
+	{
+		const DualQuaternion before = sclerp.x(t - h), current = sclerp.x(t), after = sclerp.x(t + h);
+		Derivatives<DualQuaternion> d;
+		sclerp.evaluate(t, d);
+		dxError = std::max(dxError, maxError(d.dx, (after + (-before))*(0.5/h)));
+		ddxError = std::max(ddxError, maxError(d.ddx, (after + current*(-2.0) + before)*(1/(h*h))));
+		dxError = std::max(dxError, maxError(d.dx, sclerp.dx(t)));
+		ddxError = std::max(ddxError, maxError(d.ddx, sclerp.ddx(t)));
+	}
+	cout << "ScLERP dx与中心差分的最大差: " << dxError << ", ddx与中心差分的最大差: " << ddxError << endl;
+}
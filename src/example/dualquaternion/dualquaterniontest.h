@@ -0,0 +1,15 @@
+/*
+ * dualquaterniontest.h
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: a1994846931931
+ */
+
+#ifndef DUALQUATERNIONTEST_H_
+#define DUALQUATERNIONTEST_H_
+
+
+void dualquaterniontest();
+
+
+#endif /* DUALQUATERNIONTEST_H_ */
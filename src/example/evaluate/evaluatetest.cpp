@@ -0,0 +1,88 @@
+/*
+ * evaluatetest.cpp
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: a1994846931931
+ *
+ *  Interpolator::evaluate的测试: 在LinePlanner(微分运动学模式)和QtoQPlanner的轨迹上, 检查evaluate与
+ *  分别调用x, dx, ddx的结果相同, 并比较每个插补周期分别求值, getState和evaluate的用时.
+ */
+
+# include "evaluatetest.h"
+# include "../../ik/SiasunSR4CSolver.h"
+# include "../../pathplanner/LinePlanner.h"
+# include "../../pathplanner/QtoQPlanner.h"
+# include "../../parse/RobotXMLParser.h"
+# include "../../common/common.h"
+# include <algorithm>
+# include <iostream>
+
+using namespace robot::math;
+using namespace robot::model;
+using namespace robot::ik;
+using namespace robot::common;
+using namespace robot::trajectory;
+using namespace robot::pathplanner;
+using robot::kinematic::State;
+using std::cout;
+using std::endl;
+
+namespace {
+
+/**
+ * @brief 比较一条轨迹上分别求值与evaluate的结果和用时
+ */
+void compare(const char* name, Interpolator<Q>::ptr ipr)
+{
+	const int count = 2000;
+	const double T = ipr->duration();
+	double error = 0;
+	Derivatives<Q> result;
+	for (int i=0; i<count; i++)
+	{
+		const double t = T*i/(count - 1);
+		ipr->evaluate(t, result);
+		const Q x = ipr->x(t), dx = ipr->dx(t), ddx = ipr->ddx(t);
+		for (int k=0; k<(int)x.size(); k++)
+		{
+			error = std::max(error, fabs(result.x[k] - x[k]));
+			error = std::max(error, fabs(result.dx[k] - dx[k]));
+			error = std::max(error, fabs(result.ddx[k] - ddx[k]));
+		}
+	}
+	unsigned long long t0 = getUTime();
+	for (int i=0; i<count; i++)
+	{
+		const double t = T*i/(count - 1);
+		ipr->x(t);
+		ipr->dx(t);
+		ipr->ddx(t);
+	}
+	unsigned long long t1 = getUTime();
+	for (int i=0; i<count; i++)
+		ipr->getState(T*i/(count - 1));
+	unsigned long long t2 = getUTime();
+	for (int i=0; i<count; i++)
+		ipr->evaluate(T*i/(count - 1), result);
+	unsigned long long t3 = getUTime();
+	cout << name << ": evaluate与x, dx, ddx的最大差值" << error << "; 每周期用时: x+dx+ddx " << (double)(t1 - t0)/count
+			<< "us, getState " << (double)(t2 - t1)/count << "us, evaluate " << (double)(t3 - t2)/count << "us" << endl;
+}
+
+}
+
+void evaluatetest()
+{
+	robot::parse::RobotXMLParser modelParser;
+	SerialLink::ptr robot = modelParser.parse("src/example/modelData/siasun6.xml");
+	std::shared_ptr<SiasunSR4CSolver> solver(new SiasunSR4CSolver(robot));
+	const Q dqLim(3, 3, 3, 3, 5, 5), ddqLim(20, 20, 20, 20, 20, 20);
+	const Q start = Q::zero(6);
+	const Q end(1.5, 0, 0, 0, -1.5, 0);
+
+	LinePlanner line(dqLim, ddqLim, 1.0, 20.0, 50, solver, start, end);
+	compare("LinePlanner", line.query());
+
+	QtoQPlanner q2q(Q(1.5, 1.5, 1.5, 1.5, 1, 1), Q(30, 30, 30, 30, 50, 50), start, Q(2, 0.5, 0.5, 0, -1.2, 2));
+	compare("QtoQPlanner", q2q.query());
+}
@@ -0,0 +1,15 @@
+/*
+ * evaluatetest.h
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: a1994846931931
+ */
+
+#ifndef EVALUATETEST_H_
+#define EVALUATETEST_H_
+
+
+void evaluatetest();
+
+
+#endif /* EVALUATETEST_H_ */
@@ -0,0 +1,58 @@
+/*
+ * fkbatchtest.cpp
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: a1994846931931
+ *
+ *  比较逐个计算与TransformBatch批量计算多组关节角度正运动学的用时, 并检查结果是否一致.
+ */
+
+# include "fkbatchtest.h"
+# include "../../model/SerialLink.h"
+# include "../../math/TransformBatch.h"
+# include "../../parse/RobotXMLParser.h"
+# include <time.h>
+# include <vector>
+# include <iostream>
+
+using namespace robot::math;
+using namespace robot::model;
+using std::cout;
+using std::endl;
+
+void fkbatchtest()
+{
+	robot::parse::RobotXMLParser modelParser;
+	SerialLink::ptr robot = modelParser.parse("src/example/modelData/siasun6.xml");
+
+	/**> 一条路径上的关节角度 */
+	const int count = 500;
+	std::vector<Q> path;
+	for (int i=0; i<count; i++)
+	{
+		double s = i/(double)(count - 1);
+		path.push_back(Q(2*s, 0.5*s, -0.5*s, 0.3*s, -1.2*s, 2*s));
+	}
+	const int loop = 200;
+
+	std::vector<HTransform3D<double> > single(count);
+	clock_t start = clock();
+	for (int l=0; l<loop; l++)
+		for (int i=0; i<count; i++)
+			single[i] = robot->getEndTransform(path[i]);
+	clock_t end = clock();
+	cout << "逐个计算: " << (end - start)/(double)(loop*count)*1000.0 << "ns/组" << endl;
+
+	TransformBatch batch;
+	start = clock();
+	for (int l=0; l<loop; l++)
+		robot->getEndTransform(path, batch);
+	end = clock();
+	cout << "批量计算(" << TransformBatch::instructionSet() << "): " << (end - start)/(double)(loop*count)*1000.0 << "ns/组" << endl;
+
+	int mismatch = 0;
+	for (int i=0; i<count; i++)
+		if (!(batch.get(i) == single[i]))
+			mismatch++;
+	cout << "结果不一致的个数: " << mismatch << endl;
+}
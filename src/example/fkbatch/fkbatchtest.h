@@ -0,0 +1,15 @@
+/*
+ * fkbatchtest.h
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: a1994846931931
+ */
+
+#ifndef FKBATCHTEST_H_
+#define FKBATCHTEST_H_
+
+
+void fkbatchtest();
+
+
+#endif /* FKBATCHTEST_H_ */
@@ -0,0 +1,75 @@
+/*
+ * ikbatchtest.cpp
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: a1994846931931
+ *
+ *  对十万个末端位姿(其中一部分不可达)逆解: 比较逐个调用solveInto与IKSolver::solveBatch(逐个调用
+ *  solveInto, 没有解时只标记状态)的用时, 并检查两者的状态和结果完全相同.
+ */
+
+# include "ikbatchtest.h"
+# include "../../ik/SiasunSR4CSolver.h"
+# include "../../math/TransformBatch.h"
+# include "../../parse/RobotXMLParser.h"
+# include "../../common/common.h"
+# include <vector>
+# include <iostream>
+
+using namespace robot::math;
+using namespace robot::model;
+using namespace robot::ik;
+using namespace robot::common;
+using std::vector;
+using std::cout;
+using std::endl;
+
+void ikbatchtest()
+{
+	robot::parse::RobotXMLParser modelParser;
+	SerialLink::ptr robot = modelParser.parse("src/example/modelData/siasun6.xml");
+	SiasunSR4CSolver solver(robot);
+
+	const int size = 100000;
+	TransformBatch poses(size);
+	for (int i=0; i<size; i++)
+	{
+		HTransform3D<double> pose = robot->getEndTransform(Q(fRand(-3, 3), fRand(-2, 1.3), fRand(-1.2, 2.7), fRand(-3, 3), fRand(-3, 0.5), fRand(-3, 3)));
+		if (i%10 == 0)
+			pose = HTransform3D<double>(Vector3D<double>(3, 0, 0.5), pose.getRotation()); // 不可达
+		poses.set(i, pose);
+	}
+	const Config config(Config::lefty, Config::epositive, Config::wnegative);
+
+	vector<Q> single(size);
+	vector<IKStatus> singleStatus(size);
+	IKSolutionSet solutions;
+	unsigned long long start = getUTime();
+	for (int i=0; i<size; i++)
+	{
+		singleStatus[i] = solver.solveInto(poses.get(i), config, solutions);
+		if (singleStatus[i] == ikSuccess)
+			solutions.get(0, single[i]);
+	}
+	cout << "逐个solveInto: " << (getUTime() - start)/1000.0 << "ms" << endl;
+
+	vector<Q> batch(size);
+	vector<IKStatus> batchStatus(size);
+	start = getUTime();
+	solver.solveBatch(poses, config, batch.data(), batchStatus.data());
+	cout << "solveBatch: " << (getUTime() - start)/1000.0 << "ms" << endl;
+
+	int success = 0;
+	bool same = true;
+	for (int i=0; i<size && same; i++)
+	{
+		same = (singleStatus[i] == batchStatus[i]);
+		if (same && singleStatus[i] == ikSuccess)
+		{
+			success++;
+			for (int k=0; k<6; k++)
+				same = same && (single[i][k] == batch[i][k]);
+		}
+	}
+	cout << "有解: " << success << "/" << size << ", 结果" << (same ? "完全相同" : "不同") << endl;
+}
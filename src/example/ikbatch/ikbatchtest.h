@@ -0,0 +1,15 @@
+/*
+ * ikbatchtest.h
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: a1994846931931
+ */
+
+#ifndef IKBATCHTEST_H_
+#define IKBATCHTEST_H_
+
+
+void ikbatchtest();
+
+
+#endif /* IKBATCHTEST_H_ */
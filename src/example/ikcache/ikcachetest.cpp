@@ -0,0 +1,78 @@
+/*
+ * ikcachetest.cpp
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: a1994846931931
+ *
+ *  模拟重复运行的搬运程序: 在两个点之间来回规划直线(LinePlanner)并按插补周期执行(getState),
+ *  比较直接使用SiasunSR4CSolver和使用CachedIKSolver包装后的用时, 命中率, 以及执行结果是否相同.
+ */
+
+# include "ikcachetest.h"
+# include "../../ik/SiasunSR4CSolver.h"
+# include "../../ik/CachedIKSolver.h"
+# include "../../pathplanner/LinePlanner.h"
+# include "../../parse/RobotXMLParser.h"
+# include "../../common/common.h"
+# include <iostream>
+
+using namespace robot::math;
+using namespace robot::model;
+using namespace robot::ik;
+using namespace robot::common;
+using namespace robot::trajectory;
+using namespace robot::pathplanner;
+using std::cout;
+using std::endl;
+
+namespace {
+
+/**
+ * @brief 来回运行cycles次, 返回执行时所有关节角之和(用于比较结果)
+ */
+double run(IKSolver::ptr solver, int cycles)
+{
+	const Q pick(0.3, -0.5, 0.7, 1.1, -0.9, 0.2);
+	const Q place(0.8, -0.2, 0.4, 0.9, -1.2, 0.5);
+	double sum = 0;
+	for (int i=0; i<cycles; i++)
+	{
+		const Q& qStart = (i%2 == 0) ? pick : place;
+		const Q& qEnd = (i%2 == 0) ? place : pick;
+		LinePlanner planner(Q(3, 3, 3, 3, 5, 5), Q(20, 20, 20, 20, 20, 20), 1.0, 20.0, 50, solver, qStart, qEnd);
+		LineTrajectory::ptr trajectory = planner.query();
+		const double T = trajectory->duration();
+		for (double t=0; t<T; t+=0.001)
+			sum += trajectory->getState(t).getAngle()[0];
+	}
+	return sum;
+}
+
+}
+
+void ikcachetest()
+{
+	robot::parse::RobotXMLParser modelParser;
+	SerialLink::ptr robot = modelParser.parse("src/example/modelData/siasun6.xml");
+	IKSolver::ptr solver(new SiasunSR4CSolver(robot));
+	CachedIKSolver::ptr cached(new CachedIKSolver(solver));
+	const int cycles = 20;
+
+	unsigned long long start = getUTime();
+	const double direct = run(solver, cycles);
+	cout << "SiasunSR4CSolver: " << (getUTime() - start)/1000.0 << "ms" << endl;
+
+	start = getUTime();
+	const double first = run(cached, 2);
+	CachedIKSolver::Statistics statistics = cached->getStatistics();
+	cout << "CachedIKSolver(第一个来回): " << (getUTime() - start)/1000.0 << "ms, 命中率" << statistics.hitRate()
+			<< ", 缓存" << statistics.size << "项" << endl;
+
+	cached->resetStatistics();
+	start = getUTime();
+	const double repeated = run(cached, cycles);
+	statistics = cached->getStatistics();
+	cout << "CachedIKSolver(重复" << cycles << "次): " << (getUTime() - start)/1000.0 << "ms, 命中率" << statistics.hitRate()
+			<< ", 淘汰" << statistics.evictions << "项" << endl;
+	cout << "结果" << ((repeated == direct) ? "相同" : "不同") << " (" << direct << ", " << repeated << ", " << first << ")" << endl;
+}
@@ -0,0 +1,15 @@
+/*
+ * ikcachetest.h
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: a1994846931931
+ */
+
+#ifndef IKCACHETEST_H_
+#define IKCACHETEST_H_
+
+
+void ikcachetest();
+
+
+#endif /* IKCACHETEST_H_ */
@@ -0,0 +1,126 @@
+/*
+ * ikseedtest.cpp
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: a1994846931931
+ *
+ *  IKSeedIndex的测试: 在siasun6.xml上建立初值索引, 检查保存和加载, 用线性查找验证k-d树的结果,
+ *  统计查询用时. 再对随机的目标位姿(与上一次的解无关, 相当于视觉给出的位姿), 比较NumericIKSolver
+ *  不用索引和使用索引时的收敛率, 平均迭代次数和用时.
+ */
+
+# include "ikseedtest.h"
+# include "../../ik/IKSeedIndex.h"
+# include "../../ik/NumericIKSolver.h"
+# include "../../parse/RobotXMLParser.h"
+# include "../../common/common.h"
+# include <vector>
+# include <algorithm>
+# include <iostream>
+# include <stdio.h>
+
+using namespace robot::math;
+using namespace robot::model;
+using namespace robot::ik;
+using namespace robot::common;
+using std::vector;
+using std::cout;
+using std::endl;
+
+namespace {
+
+/**
+ * @brief 连续求解一组目标位姿, 统计收敛个数, 总迭代次数和用时
+ */
+void solveAll(const char* name, NumericIKSolver& solver, const vector<HTransform3D<double> >& poses)
+{
+	const Config freeConfig(Config::sfree, Config::efree, Config::wfree);
+	IKSolutionSet solutions;
+	int success = 0;
+	long long iterations = 0;
+	unsigned long long start = getUTime();
+	for (size_t i=0; i<poses.size(); i++)
+	{
+		success += (solver.solveInto(poses[i], freeConfig, solutions) == ikSuccess);
+		iterations += solver.getLastIterations();
+	}
+	unsigned long long time = getUTime() - start;
+	cout << name << ": 收敛" << success << "/" << poses.size() << ", 平均迭代" << (double)iterations/poses.size()
+			<< "次, 平均用时" << (double)time/poses.size() << "us" << endl;
+}
+
+}
+
+void ikseedtest()
+{
+	robot::parse::RobotXMLParser modelParser;
+	SerialLink::ptr robot = modelParser.parse("src/example/modelData/siasun6.xml");
+
+	/**> 建立, 保存和加载 */
+	const int samples = 100000;
+	unsigned long long t0 = getUTime();
+	IKSeedIndex::ptr index(new IKSeedIndex(robot, samples));
+	unsigned long long t1 = getUTime();
+	index->save("/tmp/siasun6.ikseed");
+	unsigned long long t2 = getUTime();
+	IKSeedIndex::ptr loaded = IKSeedIndex::load("/tmp/siasun6.ikseed", *robot);
+	unsigned long long t3 = getUTime();
+	cout << "索引" << samples << "个: 建立" << (t1 - t0)/1000 << "ms, 保存" << (t2 - t1)/1000 << "ms, 加载" << (t3 - t2)/1000 << "ms" << endl;
+
+	/**> 随机目标位姿 */
+	const int count = 2000;
+	const Q qMin = robot->getJointMin();
+	const Q qMax = robot->getJointMax();
+	vector<HTransform3D<double> > poses;
+	for (int i=0; i<count; i++)
+	{
+		Q q = Q::zero(6);
+		for (int k=0; k<6; k++)
+			q(k) = fRand(std::max(qMin[k], -M_PI), std::min(qMax[k], M_PI));
+		poses.push_back(robot->getEndTransform(q));
+	}
+
+	/**> 与线性查找比较 */
+	const int checks = 20;
+	int same = 0;
+	Q q;
+	for (int i=0; i<checks; i++)
+	{
+		loaded->nearest(poses[i], q);
+		const double found = loaded->distance(robot->getEndTransform(q), poses[i]);
+		double best = found;
+		for (int j=0; j<loaded->size(); j++)
+			best = std::min(best, loaded->distance(robot->getEndTransform(loaded->sample(j)), poses[i]));
+		same += (found - best < 1e-6);
+	}
+	cout << "与线性查找相同: " << same << "/" << checks << endl;
+
+	/**> 查询用时 */
+	Q seeds[IKSeedIndex::maxNeighbours];
+	double distance = 0;
+	t0 = getUTime();
+	for (int i=0; i<count; i++)
+		loaded->nearest(poses[i], 1, seeds);
+	t1 = getUTime();
+	for (int i=0; i<count; i++)
+	{
+		loaded->nearest(poses[i], 1, seeds);
+		distance += loaded->distance(robot->getEndTransform(seeds[0]), poses[i]);
+	}
+	unsigned long long t4 = getUTime();
+	for (int i=0; i<count; i++)
+		loaded->nearest(poses[i], 4, seeds);
+	unsigned long long t5 = getUTime();
+	cout << "查询: 最近1个平均" << (double)(t1 - t0)/count << "us, 最近4个平均" << (double)(t5 - t4)/count
+			<< "us, 最近点的平均距离" << distance/count << endl;
+
+	/**> 数值逆解: 不用索引与使用索引 */
+	NumericIKSolver cold(robot);
+	solveAll("不用索引", cold, poses);
+	NumericIKSolver seeded(robot);
+	seeded.setSeedIndex(loaded, 1);
+	solveAll("索引初值1个", seeded, poses);
+	seeded.setSeedIndex(loaded, 4);
+	solveAll("索引初值4个", seeded, poses);
+	remove("/tmp/siasun6.ikseed");
+}
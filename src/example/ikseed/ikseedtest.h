@@ -0,0 +1,15 @@
+/*
+ * ikseedtest.h
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: a1994846931931
+ */
+
+#ifndef IKSEEDTEST_H_
+#define IKSEEDTEST_H_
+
+
+void ikseedtest();
+
+
+#endif /* IKSEEDTEST_H_ */
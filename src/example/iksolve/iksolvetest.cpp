@@ -0,0 +1,110 @@
+/*
+ * iksolvetest.cpp
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: a1994846931931
+ *
+ *  比较SiasunSR4CSolver::solve(返回std::vector, 无解时抛出异常)与solveInto(写入IKSolutionSet,
+ *  返回状态)的结果和用时, 分别测试有解和不可达两种末端位姿. 最后沿一条连续的关节轨迹比较
+ *  solveInto(Config不限制时求出全部分支)与solveNearest(只计算一个分支)的用时.
+ */
+
+# include "iksolvetest.h"
+# include "../../ik/SiasunSR4CSolver.h"
+# include "../../parse/RobotXMLParser.h"
+# include "../../common/common.h"
+# include <vector>
+# include <iostream>
+
+using namespace robot::math;
+using namespace robot::model;
+using namespace robot::ik;
+using namespace robot::common;
+using std::vector;
+using std::cout;
+using std::endl;
+
+void iksolvetest()
+{
+	robot::parse::RobotXMLParser modelParser;
+	SerialLink::ptr robot = modelParser.parse("src/example/modelData/siasun6.xml");
+	SiasunSR4CSolver solver(robot);
+
+	const int loop = 100000;
+	const Q q(0.3, -0.5, 0.7, 1.1, -0.9, 0.2);
+	const Config config = solver.getConfig(q);
+	const HTransform3D<double> reachable = robot->getEndTransform(q);
+	const HTransform3D<double> unreachable(Vector3D<double>(3, 0, 0.5), reachable.getRotation());
+
+	/**> 结果比较 */
+	vector<Q> result = solver.solve(reachable, config);
+	IKSolutionSet solutions;
+	IKStatus status = solver.solveInto(reachable, config, solutions);
+	bool same = (status == ikSuccess) && (solutions.size() == (int)result.size());
+	for (int i=0; i<solutions.size() && same; i++)
+		same = (solutions[i] == result[i]);
+	cout << "解的个数: " << result.size() << "(基本解" << solutions.baseSize() << "个), 结果" << (same ? "相同" : "不同") << endl;
+	cout << "不可达位姿的状态: " << solver.solveInto(unreachable, config, solutions) << endl;
+
+	/**> 用时比较 */
+	double sink = 0;
+	unsigned long long start = getUTime();
+	for (int i=0; i<loop; i++)
+		sink += solver.solve(reachable, config)[0][0];
+	cout << "solve(有解): " << (getUTime() - start)/1000.0 << "ms" << endl;
+	start = getUTime();
+	Q first;
+	for (int i=0; i<loop; i++)
+	{
+		solver.solveInto(reachable, config, solutions);
+		solutions.get(0, first);
+		sink += first[0];
+	}
+	cout << "solveInto(有解): " << (getUTime() - start)/1000.0 << "ms" << endl;
+	start = getUTime();
+	for (int i=0; i<loop; i++)
+	{
+		try
+		{
+			sink += solver.solve(unreachable, config)[0][0];
+		}
+		catch (std::string&)
+		{
+			sink -= 1;
+		}
+	}
+	cout << "solve(无解, 异常): " << (getUTime() - start)/1000.0 << "ms" << endl;
+	start = getUTime();
+	for (int i=0; i<loop; i++)
+	{
+		if (solver.solveInto(unreachable, config, solutions) != ikSuccess)
+			sink -= 1;
+	}
+	cout << "solveInto(无解, 状态): " << (getUTime() - start)/1000.0 << "ms" << endl;
+
+	/**> 连续轨迹: solveNearest */
+	vector<HTransform3D<double> > path;
+	for (int i=0; i<loop; i++)
+		path.push_back(robot->getEndTransform(Q(0.3 + i*1e-5, -0.5, 0.7, 1.1 + i*2e-5, -0.9, 0.2 + i*3e-5)));
+	const Config freeConfig(Config::sfree, Config::efree, Config::wfree);
+	start = getUTime();
+	for (int i=0; i<loop; i++)
+	{
+		solver.solveInto(path[i], freeConfig, solutions);
+		solutions.get(0, first);
+		sink += first[5];
+	}
+	cout << "solveInto(连续轨迹): " << (getUTime() - start)/1000.0 << "ms" << endl;
+	Q previous = q;
+	double error = 0;
+	start = getUTime();
+	for (int i=0; i<loop; i++)
+	{
+		solver.solveNearest(path[i], freeConfig, previous, previous);
+		sink += previous[5];
+	}
+	cout << "solveNearest(连续轨迹): " << (getUTime() - start)/1000.0 << "ms" << endl;
+	error = Q::distance(previous, Q(0.3 + (loop - 1)*1e-5, -0.5, 0.7, 1.1 + (loop - 1)*2e-5, -0.9, 0.2 + (loop - 1)*3e-5), 6);
+	cout << "solveNearest终点误差: " << error << endl;
+	cout << "(" << sink << ")" << endl;
+}
@@ -0,0 +1,15 @@
+/*
+ * iksolvetest.h
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: a1994846931931
+ */
+
+#ifndef IKSOLVETEST_H_
+#define IKSOLVETEST_H_
+
+
+void iksolvetest();
+
+
+#endif /* IKSOLVETEST_H_ */
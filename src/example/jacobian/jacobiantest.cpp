@@ -0,0 +1,98 @@
+/*
+ * jacobiantest.cpp
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: a1994846931931
+ *
+ *  由末端速度求关节速度: 比较Jacobian(动态矩阵, 求逆后相乘)与FixedJacobian<6, 6>
+ *  (定长矩阵, LU分解和阻尼最小二乘)的结果和用时. Jacobian每次构造和求逆都会为Eigen::MatrixXd
+ *  申请内存, FixedJacobian全部在栈上计算.
+ */
+
+# include "jacobiantest.h"
+# include "../../model/SerialLink.h"
+# include "../../model/FixedJacobian.h"
+# include "../../parse/RobotXMLParser.h"
+# include <time.h>
+# include <math.h>
+# include <algorithm>
+# include <iostream>
+
+using namespace robot::math;
+using namespace robot::model;
+using std::cout;
+using std::endl;
+
+void jacobiantest()
+{
+	robot::parse::RobotXMLParser modelParser;
+	SerialLink::ptr robot = modelParser.parse("src/example/modelData/siasun6.xml");
+
+	const int loop = 100000;
+	const Q endVelocity(0.1, -0.2, 0.05, 0.01, 0.02, -0.03);
+	double sink = 0;
+
+	/**> 结果比较 */
+	double error = 0;
+	for (int i=0; i<100; i++)
+	{
+		Q q(i*0.05, 0.5 - i*0.01, -0.5, 0.3 + i*0.02, -1.2, 2 - i*0.03);
+		Jacobian J = robot->getJacobian(q);
+		J.doInverse();
+		Q dq1 = J*endVelocity;
+		FixedJacobian<6, 6> fixed;
+		FixedJacobian<6, 6>::Workspace ws;
+		robot->getJacobian(robot->getJointTrig(q), fixed);
+		Q dq2;
+		fixed.solveLU(endVelocity, dq2, ws);
+		for (int k=0; k<6; k++)
+			error = std::max(error, fabs(dq1[k] - dq2[k]));
+	}
+	cout << "LU分解与求逆的最大误差: " << error << endl;
+
+	/**> Jacobian: 动态矩阵求逆 */
+	clock_t start = clock();
+	for (int i=0; i<loop; i++)
+	{
+		Q q(i*1e-5, 0.5, -0.5, 0.3, -1.2, 2);
+		Jacobian J = robot->getJacobian(q);
+		J.doInverse();
+		sink += (J*endVelocity)[0];
+	}
+	clock_t end = clock();
+	cout << "Jacobian求逆:            " << (end - start)/(double)loop << "us" << endl;
+
+	/**> FixedJacobian: LU分解 */
+	FixedJacobian<6, 6> J;
+	FixedJacobian<6, 6>::Workspace ws;
+	Q dq;
+	start = clock();
+	for (int i=0; i<loop; i++)
+	{
+		Q q(i*1e-5, 0.5, -0.5, 0.3, -1.2, 2);
+		robot->getJacobian(robot->getJointTrig(q), J);
+		J.solveLU(endVelocity, dq, ws);
+		sink += dq[0];
+	}
+	end = clock();
+	cout << "FixedJacobian LU分解:    " << (end - start)/(double)loop << "us" << endl;
+
+	/**> FixedJacobian: 阻尼最小二乘 */
+	start = clock();
+	for (int i=0; i<loop; i++)
+	{
+		Q q(i*1e-5, 0.5, -0.5, 0.3, -1.2, 2);
+		robot->getJacobian(robot->getJointTrig(q), J);
+		J.solveDLS(endVelocity, 0.01, dq, ws);
+		sink += dq[0];
+	}
+	end = clock();
+	cout << "FixedJacobian 阻尼最小二乘: " << (end - start)/(double)loop << "us" << endl;
+
+	/**> 奇异位形(关节5为0)附近的阻尼最小二乘 */
+	robot->getJacobian(robot->getJointTrig(Q(0, 0.5, -0.5, 0, 1e-6, 0)), J);
+	J.solveDLS(endVelocity, 0.01, dq, ws);
+	cout << "奇异位形附近的阻尼最小二乘解:" << endl;
+	dq.print();
+	cout << "(" << sink << ")" << endl;
+}
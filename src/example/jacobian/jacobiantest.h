@@ -0,0 +1,15 @@
+/*
+ * jacobiantest.h
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: a1994846931931
+ */
+
+#ifndef JACOBIANTEST_H_
+#define JACOBIANTEST_H_
+
+
+void jacobiantest();
+
+
+#endif /* JACOBIANTEST_H_ */
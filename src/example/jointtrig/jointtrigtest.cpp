@@ -0,0 +1,54 @@
+/*
+ * jointtrigtest.cpp
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: a1994846931931
+ *
+ *  同一组关节角度同时计算末端位姿, 四元数和雅克比矩阵时, 比较每个函数各自计算三角函数与
+ *  共用JointTrig缓存的用时.
+ */
+
+# include "jointtrigtest.h"
+# include "../../model/SerialLink.h"
+# include "../../model/JointTrig.h"
+# include "../../parse/RobotXMLParser.h"
+# include <time.h>
+# include <iostream>
+
+using namespace robot::math;
+using namespace robot::model;
+using std::cout;
+using std::endl;
+
+void jointtrigtest()
+{
+	robot::parse::RobotXMLParser modelParser;
+	SerialLink::ptr robot = modelParser.parse("src/example/modelData/siasun6.xml");
+
+	const int loop = 100000;
+	double sink = 0;
+
+	clock_t start = clock();
+	for (int i=0; i<loop; i++)
+	{
+		Q q(i*1e-5, 0.5, -0.5, 0.3, -1.2, 2);
+		sink += robot->getEndTransform(q).getPosition()(0);
+		sink += robot->getEndQuaternion(q).r();
+		sink += robot->getJacobian(q)(0, 0);
+	}
+	clock_t end = clock();
+	cout << "各自计算三角函数: " << (end - start)/(double)loop << "us" << endl;
+
+	start = clock();
+	for (int i=0; i<loop; i++)
+	{
+		Q q(i*1e-5, 0.5, -0.5, 0.3, -1.2, 2);
+		JointTrig trig = robot->getJointTrig(q, true);
+		sink += robot->getEndTransform(trig).getPosition()(0);
+		sink += robot->getEndQuaternion(trig).r();
+		sink += robot->getJacobian(trig)(0, 0);
+	}
+	end = clock();
+	cout << "共用JointTrig:    " << (end - start)/(double)loop << "us" << endl;
+	cout << "(" << sink << ")" << endl;
+}
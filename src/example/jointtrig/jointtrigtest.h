@@ -0,0 +1,15 @@
+/*
+ * jointtrigtest.h
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: a1994846931931
+ */
+
+#ifndef JOINTTRIGTEST_H_
+#define JOINTTRIGTEST_H_
+
+
+void jointtrigtest();
+
+
+#endif /* JOINTTRIGTEST_H_ */
@@ -0,0 +1,92 @@
+/*
+ * kinematicstest.cpp
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: a1994846931931
+ *
+ *  检查SerialLink::computeKinematics的末端位姿, 雅克比矩阵与单独调用的结果一致, 用差分检查
+ *  dJ*dq, 并与分别调用getEndTransform, getJacobian(差分求dJ)的用时比较.
+ */
+
+# include "kinematicstest.h"
+# include "../../model/SerialLink.h"
+# include "../../model/KinematicsResult.h"
+# include "../../parse/RobotXMLParser.h"
+# include <time.h>
+# include <math.h>
+# include <algorithm>
+# include <iostream>
+
+using namespace robot::math;
+using namespace robot::model;
+using std::cout;
+using std::endl;
+
+void kinematicstest()
+{
+	robot::parse::RobotXMLParser modelParser;
+	SerialLink::ptr robot = modelParser.parse("src/example/modelData/siasun6.xml");
+
+	const Q dq(0.3, -0.2, 0.5, 0.4, -0.6, 0.8);
+	const double h = 1e-6;
+	KinematicsResult result;
+	double poseError = 0, jacobianError = 0, dJError = 0;
+	for (int i=0; i<100; i++)
+	{
+		Q q(i*0.05, 0.5 - i*0.01, -0.5, 0.3 + i*0.02, -1.2, 2 - i*0.03);
+		robot->computeKinematics(q, dq, result);
+		HTransform3D<double> T = robot->getEndTransform(q);
+		Jacobian J = robot->getJacobian(q);
+		Jacobian J1 = robot->getJacobian(q + dq*h);
+		Jacobian J0 = robot->getJacobian(q - dq*h);
+		for (int r=0; r<3; r++)
+		{
+			poseError = std::max(poseError, fabs(result.endTransform.getPosition()(r) - T.getPosition()(r)));
+			for (int c=0; c<3; c++)
+				poseError = std::max(poseError, fabs(result.endTransform.getRotation()(r, c) - T.getRotation()(r, c)));
+		}
+		for (int r=0; r<6; r++)
+		{
+			double dJdq = 0;
+			for (int c=0; c<6; c++)
+			{
+				jacobianError = std::max(jacobianError, fabs(result.jacobian(r, c) - J(r, c)));
+				dJdq += (J1(r, c) - J0(r, c))/(2*h)*dq[c];
+			}
+			dJError = std::max(dJError, fabs(result.jacobianDotQd(r) - dJdq));
+		}
+	}
+	cout << "末端位姿最大误差: " << poseError << endl;
+	cout << "雅克比矩阵最大误差: " << jacobianError << endl;
+	cout << "dJ*dq与差分的最大误差: " << dJError << endl;
+
+	/**> 末端加速度与关节加速度互逆 */
+	Q ddq(1, -0.5, 0.2, 0.3, 0.1, -0.4);
+	robot->computeKinematics(Q(0.2, 0.5, -0.5, 0.3, -1.2, 2), dq, result);
+	cout << "由末端加速度反求关节加速度:" << endl;
+	result.getJointAcceleration(result.getEndAcceleration(ddq)).print();
+
+	const int loop = 100000;
+	double sink = 0;
+	clock_t start = clock();
+	for (int i=0; i<loop; i++)
+	{
+		Q q(i*1e-5, 0.5, -0.5, 0.3, -1.2, 2);
+		sink += robot->getEndTransform(q).getPosition()(0);
+		sink += robot->getJacobian(q)(0, 0);
+		sink += robot->getJacobian(q + dq*h)(0, 0) - robot->getJacobian(q - dq*h)(0, 0);
+	}
+	clock_t end = clock();
+	cout << "分别计算(差分求dJ): " << (end - start)/(double)loop << "us" << endl;
+
+	start = clock();
+	for (int i=0; i<loop; i++)
+	{
+		Q q(i*1e-5, 0.5, -0.5, 0.3, -1.2, 2);
+		robot->computeKinematics(q, dq, result);
+		sink += result.endTransform.getPosition()(0) + result.jacobian(0, 0) + result.jacobianDotQd(0);
+	}
+	end = clock();
+	cout << "computeKinematics:  " << (end - start)/(double)loop << "us" << endl;
+	cout << "(" << sink << ")" << endl;
+}
@@ -0,0 +1,15 @@
+/*
+ * kinematicstest.h
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: a1994846931931
+ */
+
+#ifndef KINEMATICSTEST_H_
+#define KINEMATICSTEST_H_
+
+
+void kinematicstest();
+
+
+#endif /* KINEMATICSTEST_H_ */
@@ -0,0 +1,90 @@
+/*
+ * kinematicscachetest.cpp
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: a1994846931931
+ *
+ *  腕部点动(只有关节4~6变化)与重复查询同一位置时, 比较SerialLink与KinematicsCache
+ *  计算末端位姿的用时, 并打印缓存的命中计数.
+ */
+
+# include "kinematicscachetest.h"
+# include "../../model/SerialLink.h"
+# include "../../model/KinematicsCache.h"
+# include "../../parse/RobotXMLParser.h"
+# include <time.h>
+# include <iostream>
+
+using namespace robot::math;
+using namespace robot::model;
+using std::cout;
+using std::endl;
+
+void kinematicscachetest()
+{
+	robot::parse::RobotXMLParser modelParser;
+	SerialLink::ptr robot = modelParser.parse("src/example/modelData/siasun6.xml");
+	KinematicsCache cache(robot);
+
+	const int loop = 100000;
+	double sink = 0;
+	bool same = true;
+	for (int i=0; i<1000; i++)
+	{
+		Q q(0.2, 0.5, -0.5, 0.3 + i*1e-3, -1.2 + (i%7)*1e-3, 2 - i*1e-3);
+		same = same && (cache.getEndTransform(q) == robot->getEndTransform(q));
+		same = same && (cache.getEndPosition(q) == robot->getEndPosition(q));
+	}
+	cout << "与SerialLink结果" << (same ? "一致" : "不一致") << endl;
+
+	/**> 腕部点动 */
+	clock_t start = clock();
+	for (int i=0; i<loop; i++)
+	{
+		Q q(0.2, 0.5, -0.5, 0.3 + i*1e-6, -1.2, 2 - i*1e-6);
+		sink += robot->getEndTransform(q).getPosition()(0);
+	}
+	clock_t end = clock();
+	cout << "腕部点动 SerialLink:      " << (end - start)/(double)loop << "us" << endl;
+
+	cache.resetCounters();
+	start = clock();
+	for (int i=0; i<loop; i++)
+	{
+		Q q(0.2, 0.5, -0.5, 0.3 + i*1e-6, -1.2, 2 - i*1e-6);
+		sink += cache.getEndTransform(q).getPosition()(0);
+	}
+	end = clock();
+	cout << "腕部点动 KinematicsCache: " << (end - start)/(double)loop << "us, 命中: " << cache.hitCount()
+			<< ", 未命中: " << cache.missCount() << ", 复用/重新计算的关节变换: "
+			<< cache.reusedLinkCount() << "/" << cache.recomputedLinkCount() << endl;
+
+	/**> 同一位置多次查询(位姿, 位置, 雅克比矩阵) */
+	FixedJacobian<6, 6> J;
+	start = clock();
+	for (int i=0; i<loop; i++)
+	{
+		Q q(0.2, 0.5, -0.5, 0.3 + i*1e-6, -1.2, 2);
+		sink += robot->getEndTransform(q).getPosition()(0);
+		sink += robot->getEndPosition(q)(1);
+		robot->getJacobian(robot->getJointTrig(q), J);
+		sink += J(0, 0);
+	}
+	end = clock();
+	cout << "同一位置三次查询 SerialLink:      " << (end - start)/(double)loop << "us" << endl;
+
+	cache.resetCounters();
+	start = clock();
+	for (int i=0; i<loop; i++)
+	{
+		Q q(0.2, 0.5, -0.5, 0.3 + i*1e-6, -1.2, 2);
+		sink += cache.getEndTransform(q).getPosition()(0);
+		sink += cache.getEndPosition(q)(1);
+		cache.getJacobian(q, J);
+		sink += J(0, 0);
+	}
+	end = clock();
+	cout << "同一位置三次查询 KinematicsCache: " << (end - start)/(double)loop << "us, 命中: " << cache.hitCount()
+			<< ", 未命中: " << cache.missCount() << endl;
+	cout << "(" << sink << ")" << endl;
+}
@@ -0,0 +1,15 @@
+/*
+ * kinematicscachetest.h
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: a1994846931931
+ */
+
+#ifndef KINEMATICSCACHETEST_H_
+#define KINEMATICSCACHETEST_H_
+
+
+void kinematicscachetest();
+
+
+#endif /* KINEMATICSCACHETEST_H_ */
@@ -0,0 +1,146 @@
+/*
+ * numericiktest.cpp
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: a1994846931931
+ *
+ *  在siasun6.xml上比较NumericIKSolver与SiasunSR4CSolver: 随机关节角的末端位姿, 数值逆解分别以
+ *  附近的关节角(热启动)和默认初值(冷启动)开始, 统计收敛率, 平均迭代次数, 末端误差和每次逆解的用时.
+ *  最后用数值逆解器规划一条直线轨迹(LinePlanner不做修改), 检查轨迹终点.
+ */
+
+# include "numericiktest.h"
+# include "../../ik/NumericIKSolver.h"
+# include "../../ik/SiasunSR4CSolver.h"
+# include "../../pathplanner/LinePlanner.h"
+# include "../../parse/RobotXMLParser.h"
+# include "../../common/common.h"
+# include <vector>
+# include <algorithm>
+# include <iostream>
+
+using namespace robot::math;
+using namespace robot::model;
+using namespace robot::ik;
+using namespace robot::common;
+using namespace robot::trajectory;
+using namespace robot::pathplanner;
+using std::vector;
+using std::cout;
+using std::endl;
+
+namespace {
+
+double poseError(const HTransform3D<double>& a, const HTransform3D<double>& b)
+{
+	double error = 0;
+	for (int r=0; r<3; r++)
+		for (int c=0; c<4; c++)
+			error = std::max(error, fabs(a(r, c) - b(r, c)));
+	return error;
+}
+
+}
+
+void numericiktest()
+{
+	robot::parse::RobotXMLParser modelParser;
+	SerialLink::ptr robot = modelParser.parse("src/example/modelData/siasun6.xml");
+	SiasunSR4CSolver analytic(robot);
+	std::shared_ptr<NumericIKSolver> numeric(new NumericIKSolver(robot));
+	const Config freeConfig(Config::sfree, Config::efree, Config::wfree);
+
+	const int count = 2000;
+	vector<Q> qs, seeds;
+	vector<HTransform3D<double> > poses;
+	const Q qMin = robot->getJointMin();
+	const Q qMax = robot->getJointMax();
+	for (int i=0; i<count; i++)
+	{
+		Q q = Q::zero(6), seed = Q::zero(6);
+		for (int k=0; k<6; k++)
+		{
+			q(k) = fRand(std::max(qMin[k], -M_PI), std::min(qMax[k], M_PI));
+			seed(k) = std::min(std::max(q[k] + fRand(-0.05, 0.05), qMin[k]), qMax[k]);
+		}
+		qs.push_back(q);
+		seeds.push_back(seed);
+		poses.push_back(robot->getEndTransform(q));
+	}
+
+	/**> 解析解 */
+	IKSolutionSet solutions;
+	int converged = 0;
+	unsigned long long start = getUTime();
+	for (int i=0; i<count; i++)
+		converged += (analytic.solveInto(poses[i], freeConfig, solutions) == ikSuccess);
+	cout << "SiasunSR4CSolver::solveInto: 有解 " << converged << "/" << count << ", "
+			<< (double)(getUTime() - start)/count << "us/次" << endl;
+
+	/**> 数值解, 热启动 */
+	Q q;
+	double error = 0;
+	long iterations = 0;
+	converged = 0;
+	start = getUTime();
+	for (int i=0; i<count; i++)
+	{
+		if (numeric->solveNearest(poses[i], freeConfig, seeds[i], q) == ikSuccess)
+		{
+			converged++;
+			iterations += numeric->getLastIterations();
+			error = std::max(error, poseError(robot->getEndTransform(q), poses[i]));
+		}
+	}
+	cout << "NumericIKSolver::solveNearest(初值误差0.05rad): 收敛 " << converged << "/" << count << ", "
+			<< (double)(getUTime() - start)/count << "us/次, 平均迭代" << (double)iterations/std::max(converged, 1)
+			<< "次, 最大误差" << error << endl;
+
+	/**> 数值解, 冷启动(从上一次的解, 当前关节角和伪随机关节角开始) */
+	error = 0;
+	iterations = 0;
+	converged = 0;
+	start = getUTime();
+	for (int i=0; i<count; i++)
+	{
+		if (numeric->solveInto(poses[i], freeConfig, solutions) == ikSuccess)
+		{
+			converged++;
+			iterations += numeric->getLastIterations();
+			solutions.get(0, q);
+			error = std::max(error, poseError(robot->getEndTransform(q), poses[i]));
+		}
+	}
+	cout << "NumericIKSolver::solveInto(冷启动): 收敛 " << converged << "/" << count << ", "
+			<< (double)(getUTime() - start)/count << "us/次, 平均迭代" << (double)iterations/std::max(converged, 1)
+			<< "次, 最大误差" << error << endl;
+
+	/**> 时间上限 */
+	numeric->setTimeBudget(20);
+	converged = 0;
+	start = getUTime();
+	for (int i=0; i<count; i++)
+		converged += (numeric->solveInto(poses[i], freeConfig, solutions) == ikSuccess);
+	cout << "NumericIKSolver::solveInto(上限20us): 收敛 " << converged << "/" << count << ", "
+			<< (double)(getUTime() - start)/count << "us/次" << endl;
+	numeric->setTimeBudget(0);
+
+	/**> 直线规划 */
+	try
+	{
+		const Q qStart(0.3, -0.5, 0.7, 1.1, -0.9, 0.2);
+		const Q qEnd(0.8, -0.2, 0.4, 0.9, -1.2, 0.5);
+		LinePlanner planner(Q(3, 3, 3, 3, 5, 5), Q(20, 20, 20, 20, 20, 20), 1.0, 20.0, 50, numeric, qStart, qEnd);
+		LineTrajectory::ptr trajectory = planner.query();
+		cout << "LinePlanner(NumericIKSolver): 时长" << trajectory->duration() << "s, 终点误差"
+				<< Q::distance(trajectory->x(trajectory->duration()), qEnd, 6) << endl;
+	}
+	catch (char const* msg)
+	{
+		cout << msg << endl;
+	}
+	catch (std::string& msg)
+	{
+		cout << msg << endl;
+	}
+}
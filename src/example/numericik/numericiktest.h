@@ -0,0 +1,15 @@
+/*
+ * numericiktest.h
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: a1994846931931
+ */
+
+#ifndef NUMERICIKTEST_H_
+#define NUMERICIKTEST_H_
+
+
+void numericiktest();
+
+
+#endif /* NUMERICIKTEST_H_ */
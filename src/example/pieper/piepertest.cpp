@@ -0,0 +1,194 @@
+/*
+ * piepertest.cpp
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: a1994846931931
+ *
+ *  PieperSolver的测试: 在siasun6.xml上与SiasunSR4CSolver比较结果和用时, 再在有肩部偏置d2的
+ *  puma560.xml, 以及同时有a1和d2的机器人(siasun6加上d2)上检查逆解的精度和完整性.
+ *  wfree时SiasunSR4CSolver每组前三轴只给出一个手腕的解, PieperSolver给出两个, 因此基本解的个数约为两倍.
+ */
+
+# include "piepertest.h"
+# include "../../ik/PieperSolver.h"
+# include "../../ik/SiasunSR4CSolver.h"
+# include "../../pathplanner/LinePlanner.h"
+# include "../../parse/RobotXMLParser.h"
+# include "../../common/common.h"
+# include <vector>
+# include <algorithm>
+# include <iostream>
+
+using namespace robot::math;
+using namespace robot::model;
+using namespace robot::ik;
+using namespace robot::common;
+using namespace robot::trajectory;
+using namespace robot::pathplanner;
+using std::vector;
+using std::cout;
+using std::endl;
+
+namespace {
+
+double poseError(const HTransform3D<double>& a, const HTransform3D<double>& b)
+{
+	double error = 0;
+	for (int r=0; r<3; r++)
+		for (int c=0; c<4; c++)
+			error = std::max(error, fabs(a(r, c) - b(r, c)));
+	return error;
+}
+
+/**
+ * @brief 两组关节角在加减2pi后的最大差
+ */
+double angleDistance(const Q& a, const Q& b)
+{
+	double distance = 0;
+	for (int i=0; i<6; i++)
+		distance = std::max(distance, fabs(fixAngle(a[i] - b[i])));
+	return distance;
+}
+
+void randomPoses(SerialLink::ptr robot, int count, vector<Q>& qs, vector<HTransform3D<double> >& poses)
+{
+	const Q qMin = robot->getJointMin();
+	const Q qMax = robot->getJointMax();
+	qs.clear();
+	poses.clear();
+	for (int i=0; i<count; i++)
+	{
+		Q q = Q::zero(6);
+		for (int k=0; k<6; k++)
+			q(k) = fRand(std::max(qMin[k], -M_PI), std::min(qMax[k], M_PI));
+		qs.push_back(q);
+		poses.push_back(robot->getEndTransform(q));
+	}
+}
+
+/**
+ * @brief 检查逆解: 每个解的末端误差, 以及生成位姿的关节角是否在解中
+ */
+void check(const char* name, SerialLink::ptr robot, const IKSolver& solver, const vector<Q>& qs, const vector<HTransform3D<double> >& poses)
+{
+	const Config freeConfig(Config::sfree, Config::efree, Config::wfree);
+	IKSolutionSet solutions;
+	int found = 0, total = 0;
+	double error = 0;
+	Q q;
+	for (size_t i=0; i<qs.size(); i++)
+	{
+		if (solver.solveInto(poses[i], freeConfig, solutions) != ikSuccess)
+			continue;
+		bool contains = false;
+		for (int k=0; k<solutions.baseSize(); k++)
+		{
+			error = std::max(error, poseError(robot->getEndTransform(solutions.base(k)), poses[i]));
+			contains = contains || (angleDistance(solutions.base(k), qs[i]) < 1e-6);
+		}
+		total += solutions.baseSize();
+		found += contains;
+	}
+	cout << name << ": 找到原关节角 " << found << "/" << qs.size() << ", 平均" << (double)total/qs.size()
+			<< "个基本解, 最大末端误差" << error << endl;
+}
+
+double timing(const IKSolver& solver, const vector<HTransform3D<double> >& poses,
+		const Config& config=Config(Config::sfree, Config::efree, Config::wfree))
+{
+	IKSolutionSet solutions;
+	int rounds = 5;
+	unsigned long long start = getUTime();
+	for (int round=0; round<rounds; round++)
+		for (size_t i=0; i<poses.size(); i++)
+			solver.solveInto(poses[i], config, solutions);
+	return (double)(getUTime() - start)/(rounds*poses.size());
+}
+
+}
+
+void piepertest()
+{
+	robot::parse::RobotXMLParser modelParser;
+	const int count = 2000;
+	vector<Q> qs;
+	vector<HTransform3D<double> > poses;
+
+	/**> siasun6: 与SiasunSR4CSolver比较 */
+	SerialLink::ptr siasun = modelParser.parse("src/example/modelData/siasun6.xml");
+	SiasunSR4CSolver analytic(siasun);
+	PieperSolver pieper(siasun);
+	randomPoses(siasun, count, qs, poses);
+	check("siasun6 SiasunSR4CSolver", siasun, analytic, qs, poses);
+	check("siasun6 PieperSolver", siasun, pieper, qs, poses);
+
+	const Config freeConfig(Config::sfree, Config::efree, Config::wfree);
+	IKSolutionSet a, b;
+	int same = 0, configSame = 0;
+	for (int i=0; i<count; i++)
+	{
+		analytic.solveInto(poses[i], freeConfig, a);
+		pieper.solveInto(poses[i], freeConfig, b);
+		bool equal = true;
+		for (int k=0; k<a.baseSize() && equal; k++)
+		{
+			bool contains = false;
+			for (int j=0; j<b.baseSize(); j++)
+				contains = contains || (angleDistance(a.base(k), b.base(j)) < 1e-6);
+			equal = contains;
+		}
+		same += equal;
+		const Config ca = analytic.getConfig(qs[i]), cb = pieper.getConfig(qs[i]);
+		configSame += (ca.getShoulder() == cb.getShoulder() && ca.getElbow() == cb.getElbow() && ca.getWrist() == cb.getWrist());
+	}
+	cout << "siasun6: SiasunSR4CSolver的基本解都在PieperSolver的解中 " << same << "/" << count << ", getConfig相同 " << configSame << "/" << count << endl;
+	cout << "siasun6 用时: SiasunSR4CSolver " << timing(analytic, poses) << "us/次, PieperSolver "
+			<< timing(pieper, poses) << "us/次" << endl;
+	const Config wrist(Config::sfree, Config::efree, Config::wpositive);
+	cout << "siasun6 用时(wpositive, 每组前三轴一个手腕解): SiasunSR4CSolver " << timing(analytic, poses, wrist) << "us/次, PieperSolver "
+			<< timing(pieper, poses, wrist) << "us/次" << endl;
+
+	/**> puma560: a1 = 0, 有肩部偏置d2 */
+	SerialLink::ptr puma = modelParser.parse("src/example/modelData/puma560.xml");
+	PieperSolver pumaSolver(puma);
+	randomPoses(puma, count, qs, poses);
+	check("puma560 PieperSolver", puma, pumaSolver, qs, poses);
+	cout << "puma560 用时: " << timing(pumaSolver, poses) << "us/次" << endl;
+
+	/**> siasun6加上d2: 一般情况(四次方程), 同时有a1和d2 */
+	SerialLink::ptr offset(new SerialLink());
+	for (int i=0; i<6; i++)
+	{
+		const Link::ptr link = siasun->getLink(i);
+		offset->append(Link::ptr(new Link(link->alpha(), link->a(), (i == 1) ? 0.12 : link->d(), link->theta(), link->lmin(), link->lmax())));
+	}
+	PieperSolver offsetSolver(offset);
+	randomPoses(offset, count, qs, poses);
+	check("siasun6(d2=0.12) PieperSolver", offset, offsetSolver, qs, poses);
+	cout << "siasun6(d2=0.12) 用时: " << timing(offsetSolver, poses) << "us/次" << endl;
+
+	/**> 直线规划(LinePlanner不做修改) */
+	try
+	{
+		const Q qStart(0.3, -0.5, 0.7, 1.1, -0.9, 0.2);
+		const Q qEnd(0.8, -0.2, 0.4, 0.9, -1.2, 0.5);
+		IKSolver::ptr solvers[2] = {IKSolver::ptr(new SiasunSR4CSolver(siasun)), IKSolver::ptr(new PieperSolver(siasun))};
+		const char* names[2] = {"SiasunSR4CSolver", "PieperSolver"};
+		for (int i=0; i<2; i++)
+		{
+			LinePlanner planner(Q(3, 3, 3, 3, 5, 5), Q(20, 20, 20, 20, 20, 20), 1.0, 20.0, 50, solvers[i], qStart, qEnd);
+			LineTrajectory::ptr trajectory = planner.query();
+			cout << "LinePlanner(" << names[i] << "): 时长" << trajectory->duration() << "s, 终点误差"
+					<< Q::distance(trajectory->x(trajectory->duration()), qEnd, 6) << endl;
+		}
+	}
+	catch (char const* msg)
+	{
+		cout << msg << endl;
+	}
+	catch (std::string& msg)
+	{
+		cout << msg << endl;
+	}
+}
@@ -0,0 +1,15 @@
+/*
+ * piepertest.h
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: a1994846931931
+ */
+
+#ifndef PIEPERTEST_H_
+#define PIEPERTEST_H_
+
+
+void piepertest();
+
+
+#endif /* PIEPERTEST_H_ */
@@ -0,0 +1,159 @@
+/*
+ * playbacktest.cpp
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: a1994846931931
+ *
+ *  PlaybackCursor的测试: 规划路径点数不同的多直线圆弧混合轨迹, 以1ms插补周期按时间顺序获取State,
+ *  比较不用游标(每次二分查找)和使用游标的结果与用时; 并比较原来线性查找的getIndexFromTime
+ *  (每次复制各段时长再逐段相减)与前缀和二分查找的用时.
+ *  再对LinePlanner的直线轨迹(速度规划为分段多项式)比较不用游标和使用游标的getState.
+ */
+
+# include "playbacktest.h"
+# include "../../pathplanner/MultiLineArcBlendPlanner.h"
+# include "../../pathplanner/LinePlanner.h"
+# include "../../trajectory/PiecewisePolynomial.h"
+# include "../../ik/SiasunSR4CSolver.h"
+# include "../../parse/RobotXMLParser.h"
+# include "../../common/common.h"
+# include <vector>
+# include <string>
+# include <iostream>
+
+using namespace robot::math;
+using namespace robot::model;
+using namespace robot::ik;
+using namespace robot::trajectory;
+using namespace robot::pathplanner;
+using namespace robot::common;
+using std::vector;
+using std::cout;
+using std::endl;
+
+namespace {
+
+/**
+ * @brief 原来的线性查找
+ */
+int linearIndexFromTime(const MLABTrajectory& trajectory, double t)
+{
+	vector<double> vt = trajectory.getTimeVector();
+	for (int i=0; i<(int)vt.size(); i++)
+	{
+		if (t >= vt[i])
+			t -= vt[i];
+		else
+			return i;
+	}
+	return (int)vt.size() - 1;
+}
+
+/** @brief 两个关节量之差的最大绝对值 */
+double maxDifference(const Q& a, const Q& b)
+{
+	Q delta = a - b;
+	delta.abs();
+	return delta.getMax();
+}
+
+/**
+ * @brief 以1ms插补周期比较不用游标和使用游标的getState
+ * @param name [in] 轨迹的名字
+ * @param trajectory [in] 轨迹
+ * @param segments [in] 分段的个数
+ */
+template <class Trajectory>
+void compareCursor(const char* name, const Trajectory& trajectory, int segments)
+{
+	vector<double> times;
+	for (double t=0; t<trajectory->duration(); t+=0.001)
+		times.push_back(t);
+	double difference = 0;
+	PlaybackCursor cursor;
+	for (size_t i=0; i<times.size(); i++)
+	{
+		State a = trajectory->getState(times[i]);
+		State b = trajectory->getState(times[i], cursor);
+		difference = std::max(difference, maxDifference(a.getAngle(), b.getAngle()));
+		difference = std::max(difference, maxDifference(a.getVelocity(), b.getVelocity()));
+		difference = std::max(difference, maxDifference(a.getAcceleration(), b.getAcceleration()));
+	}
+	double sum = 0;
+	unsigned long long t0 = getUTime();
+	for (size_t i=0; i<times.size(); i++)
+		sum += trajectory->getState(times[i]).getAngle()[0];
+	unsigned long long t1 = getUTime();
+	cursor.reset();
+	for (size_t i=0; i<times.size(); i++)
+		sum += trajectory->getState(times[i], cursor).getAngle()[0];
+	unsigned long long t2 = getUTime();
+	cout << name << ", " << segments << "段, " << times.size() << "个插补周期: 最大差" << difference
+			<< ", getState " << (double)(t1 - t0)/times.size() << "us, 带游标 " << (double)(t2 - t1)/times.size()
+			<< "us (" << sum << ")" << endl;
+}
+
+}
+
+void playbacktest()
+{
+	robot::parse::RobotXMLParser modelParser;
+	SerialLink::ptr robot = modelParser.parse("src/example/modelData/siasun6.xml");
+	std::shared_ptr<SiasunSR4CSolver> solver(new SiasunSR4CSolver(robot));
+	const Q dqLim = Q(3, 3, 3, 3, 5, 5);
+	const Q ddqLim = Q(20, 20, 20, 20, 20, 20);
+
+	/**> 在四个点之间往复的路径 */
+	const Q corners[4] = {Q(-0.3, 0, 0, 0, -1, 0), Q(0.3, 0, 0, 0, -1, 0), Q(0.3, 0.3, 0, 0, -1.2, 0), Q(-0.3, 0.3, 0, 0, -1.2, 0)};
+	const int counts[3] = {5, 50, 200};
+	for (int n=0; n<3; n++)
+	{
+		const int count = counts[n];
+		vector<Q> qPath;
+		for (int i=0; i<count; i++)
+			qPath.push_back(corners[i%4]);
+		vector<double> arcRatio(count - 2, 0.3);
+		vector<double> velocity(count - 1, 1.0);
+		vector<double> acceleration(count - 1, 15.0);
+		vector<double> jerk(count - 1, 50.0);
+		MultiLineArcBlendPlanner planner(dqLim, ddqLim, solver, qPath, arcRatio, velocity, acceleration, jerk);
+		MLABTrajectory::ptr trajectory;
+		try{
+			trajectory = planner.query();
+		}
+		catch(char const* msg)
+		{
+			cout << msg << endl;
+			return;
+		}
+		const int segments = (int)trajectory->getTimeVector().size();
+		compareCursor((std::to_string(count) + "个路径点的多直线圆弧混合").c_str(), trajectory, segments);
+
+		/**> 段的索引 */
+		vector<double> times;
+		for (double t=0; t<trajectory->duration(); t+=0.001)
+			times.push_back(t);
+		double sum = 0;
+		int same = 0;
+		unsigned long long t3 = getUTime();
+		for (size_t i=0; i<times.size(); i++)
+			sum += linearIndexFromTime(*trajectory, times[i]);
+		unsigned long long t4 = getUTime();
+		for (size_t i=0; i<times.size(); i++)
+			sum += trajectory->getIndexFromTime(times[i]);
+		unsigned long long t5 = getUTime();
+		for (size_t i=0; i<times.size(); i++)
+			same += (linearIndexFromTime(*trajectory, times[i]) == trajectory->getIndexFromTime(times[i]));
+		cout << "    " << segments << "段: getIndexFromTime 线性 " << (double)(t4 - t3)/times.size() << "us, 前缀和 "
+				<< (double)(t5 - t4)/times.size() << "us, 相同" << same << "/" << times.size() << " (" << sum << ")" << endl;
+	}
+
+	/**> 直线轨迹, 游标传到速度规划的分段多项式 */
+	for (double q1 : {0.5, 1.5})
+	{
+		LinePlanner line(dqLim, ddqLim, 1.0, 20.0, 50, solver, Q::zero(6), Q(q1, 0, 0, 0, -1.5, 0));
+		LineTrajectory::ptr trajectory = line.query();
+		auto lt = std::dynamic_pointer_cast<PiecewisePolynomial<double, 3> >(trajectory->getLIpr());
+		compareCursor(("q1 = " + std::to_string(q1) + "的直线").c_str(), trajectory, lt? lt->size() : 0);
+	}
+}
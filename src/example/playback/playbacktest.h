@@ -0,0 +1,15 @@
+/*
+ * playbacktest.h
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: a1994846931931
+ */
+
+#ifndef PLAYBACKTEST_H_
+#define PLAYBACKTEST_H_
+
+
+void playbacktest();
+
+
+#endif /* PLAYBACKTEST_H_ */
@@ -0,0 +1,105 @@
+/*
+ * ppolytest.cpp
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: a1994846931931
+ *
+ *  PiecewisePolynomial的测试: 用TimeOptimalPlanner得到一个上千段的长度-时间插补器, 展开成分段多项式,
+ *  检查与原插补器的差, 比较按时间顺序(插补周期)和随机顺序查询时SequenceInterpolator, 二分查找和游标的用时.
+ */
+
+# include "ppolytest.h"
+# include "../../trajectory/PiecewisePolynomial.h"
+# include "../../pathplanner/TimeOptimalPlanner.h"
+# include "../../common/common.h"
+# include <vector>
+# include <algorithm>
+# include <iostream>
+# include <math.h>
+
+using namespace robot::trajectory;
+using namespace robot::pathplanner;
+using namespace robot::common;
+using std::vector;
+using std::cout;
+using std::endl;
+
+namespace {
+
+/**
+ * @brief 依次在times上求长度, 速度和加速度, 返回平均用时(us)
+ * @param cursor [in] 游标, 为NULL时不用游标
+ */
+double timeOf(const Interpolator<double>& lt, const vector<double>& times, double& sum, PlaybackCursor* cursor=NULL)
+{
+	Derivatives<double> d;
+	unsigned long long start = getUTime();
+	for (size_t i=0; i<times.size(); i++)
+	{
+		if (cursor == NULL)
+			lt.evaluate(times[i], d);
+		else
+			lt.evaluate(times[i], d, *cursor);
+		sum += d.x + d.dx + d.ddx;
+	}
+	return (double)(getUTime() - start)/times.size();
+}
+
+}
+
+void ppolytest()
+{
+	/**> 上下起伏的速度限制, 得到上千段的时间最优规划 */
+	const int count = 5001;
+	const double length = 10;
+	const double ds = length/(count - 1);
+	const double a = 2;
+	const double h = 20;
+	vector<double> maxSpeed(count);
+	for (int i=0; i<count; i++)
+		maxSpeed[i] = 0.6 + 0.4*sin(i*ds*6);
+	TimeOptimalPlanner::optimizeVelocityRestriction(maxSpeed, a, h, ds);
+	unsigned long long t0 = getUTime();
+	SequenceInterpolator<double>::ptr sequence = TimeOptimalPlanner::getOptimalLt(maxSpeed, length, 1, a, h, ds);
+	unsigned long long t1 = getUTime();
+	PiecewisePolynomial<double, 3>::ptr ppoly = PiecewisePolynomial<double, 3>::fromSequence(sequence);
+	unsigned long long t2 = getUTime();
+	cout << "规划" << (t1 - t0)/1000 << "ms, 展开" << (t2 - t1)/1000 << "ms, 时长" << ppoly->duration()
+			<< "s, 分段" << ppoly->size() << "个" << endl;
+
+	/**> 1ms插补周期的时间, 以及打乱顺序的时间 */
+	vector<double> times;
+	for (double t=0; t<=sequence->duration(); t+=0.001)
+		times.push_back(t);
+	vector<double> shuffled = times;
+	std::random_shuffle(shuffled.begin(), shuffled.end());
+
+	/**> 与原插补器的差 */
+	double error[3] = {0, 0, 0};
+	Derivatives<double> s, p;
+	for (size_t i=0; i<times.size(); i++)
+	{
+		sequence->evaluate(times[i], s);
+		ppoly->evaluate(times[i], p);
+		error[0] = std::max(error[0], fabs(s.x - p.x));
+		error[1] = std::max(error[1], fabs(s.dx - p.dx));
+		error[2] = std::max(error[2], fabs(s.ddx - p.ddx));
+	}
+	cout << "最大误差: x " << error[0] << ", dx " << error[1] << ", ddx " << error[2] << endl;
+
+	/**> 用时 */
+	double sum = 0;
+	const double sequenceOrdered = timeOf(*sequence, times, sum);
+	const double sequenceShuffled = timeOf(*sequence, shuffled, sum);
+	const double searchOrdered = timeOf(*ppoly, times, sum);
+	const double searchShuffled = timeOf(*ppoly, shuffled, sum);
+	PlaybackCursor cursor;
+	const double cursorOrdered = timeOf(*ppoly, times, sum, &cursor);
+	cursor.reset();
+	const double cursorShuffled = timeOf(*ppoly, shuffled, sum, &cursor);
+	cout << "按时间顺序" << times.size() << "次: SequenceInterpolator " << sequenceOrdered << "us, 二分查找 "
+			<< searchOrdered << "us, 游标 " << cursorOrdered << "us" << endl;
+	cout << "随机顺序: SequenceInterpolator " << sequenceShuffled << "us, 二分查找 "
+			<< searchShuffled << "us, 游标 " << cursorShuffled << "us" << endl;
+	cout << "(" << sum << ")" << endl;
+}
@@ -0,0 +1,15 @@
+/*
+ * ppolytest.h
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: a1994846931931
+ */
+
+#ifndef PPOLYTEST_H_
+#define PPOLYTEST_H_
+
+
+void ppolytest();
+
+
+#endif /* PPOLYTEST_H_ */
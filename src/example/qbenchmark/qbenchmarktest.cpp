@@ -0,0 +1,129 @@
+/*
+ * qbenchmarktest.cpp
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: a1994846931931
+ *
+ *  比较基于std::vector的数组, Q(内部保存)和JointVector<6>在插补周期中的运算用时.
+ *  Q和JointVector的数据保存在对象内部, 不申请堆内存; std::vector数组通过计数的分配器统计每个周期的申请次数.
+ */
+
+# include "qbenchmarktest.h"
+# include "../../math/Q.h"
+# include "../../math/JointVector.h"
+# include "../../pathplanner/QtoQPlanner.h"
+# include "../../kinematics/State.h"
+# include <time.h>
+# include <vector>
+# include <memory>
+# include <iostream>
+
+using namespace robot::math;
+using namespace robot::pathplanner;
+using namespace robot::trajectory;
+using robot::kinematic::State;
+using std::cout;
+using std::endl;
+
+namespace {
+
+/**> 计数的分配器, 只统计VectorQ的申请次数, 不影响程序的其它部分 */
+template<class T>
+struct CountingAllocator: public std::allocator<T>
+{
+	typedef T value_type;
+	template<class U> struct rebind {typedef CountingAllocator<U> other;};
+	CountingAllocator() {}
+	template<class U> CountingAllocator(const CountingAllocator<U>&) {}
+	T* allocate(std::size_t n)
+	{
+		count++;
+		return std::allocator<T>::allocate(n);
+	}
+	static unsigned long long count;
+};
+
+template<class T>
+unsigned long long CountingAllocator<T>::count = 0;
+
+/**> 旧版Q的实现方式: 数据保存在std::vector中 */
+struct VectorQ
+{
+	std::vector<double, CountingAllocator<double> > v;
+	VectorQ(double a, double b, double c, double d, double e, double f): v{a, b, c, d, e, f} {}
+	VectorQ operator+(const VectorQ& q) const
+	{
+		VectorQ r(*this);
+		for (size_t i=0; i<v.size(); i++)
+			r.v[i] += q.v[i];
+		return r;
+	}
+	VectorQ operator*(double num) const
+	{
+		VectorQ r(*this);
+		for (size_t i=0; i<v.size(); i++)
+			r.v[i] *= num;
+		return r;
+	}
+};
+
+const int loop = 1000000;
+
+template<class T>
+double axpyTest(const T& x, const T& dx, double& sink)
+{
+	clock_t start = clock();
+	T y = x;
+	for (int i=0; i<loop; i++)
+	{
+		y = x + dx*(i*1e-6);
+		sink += y[5];
+	}
+	return (clock() - start)/(double)loop*1000.0;
+}
+
+double vectorAxpyTest(const VectorQ& x, const VectorQ& dx, double& sink)
+{
+	clock_t start = clock();
+	VectorQ y = x;
+	for (int i=0; i<loop; i++)
+	{
+		y = x + dx*(i*1e-6);
+		sink += y.v[5];
+	}
+	return (clock() - start)/(double)loop*1000.0;
+}
+
+}
+
+void qbenchmarktest()
+{
+	double sink = 0;
+	Q x(0.1, 0.2, 0.3, 0.4, 0.5, 0.6);
+	Q dx(1, 1, 1, 1, 1, 1);
+
+	const unsigned long long before = CountingAllocator<double>::count;
+	const double tVector = vectorAxpyTest(VectorQ(0.1, 0.2, 0.3, 0.4, 0.5, 0.6), VectorQ(1, 1, 1, 1, 1, 1), sink);
+	const unsigned long long nVector = CountingAllocator<double>::count - before;
+	const double tQ = axpyTest(x, dx, sink);
+	const double tJoint = axpyTest(JointVector<6>(x), JointVector<6>(dx), sink);
+	cout << "std::vector数组 y=x+dx*t: " << tVector << "ns, 内存申请: " << nVector/(double)loop << "次/周期" << endl;
+	cout << "Q                y=x+dx*t: " << tQ << "ns" << endl;
+	cout << "JointVector<6>   y=x+dx*t: " << tJoint << "ns" << endl;
+
+	/**> 插补周期: getState */
+	QtoQPlanner planner(Q(1.5, 1.5, 1.5, 1.5, 1, 1), Q(30, 30, 30, 30, 50, 50), Q::zero(6), Q(2, 0.5, 0.5, 0, -1.2, 2));
+	Interpolator<Q>::ptr qIpr = planner.query();
+	const double T = qIpr->duration();
+	const int tick = 100000;
+	State state(6);
+	clock_t start = clock();
+	for (int i=0; i<tick; i++)
+	{
+		state = qIpr->getState(T*i/tick);
+		sink += state.getAngle(0);
+	}
+	clock_t end = clock();
+	cout << "getState: " << (end - start)/(double)tick << "us" << endl;
+	cout << "(" << sink << ")" << endl;
+}
@@ -0,0 +1,15 @@
+/*
+ * qbenchmarktest.h
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: a1994846931931
+ */
+
+#ifndef QBENCHMARKTEST_H_
+#define QBENCHMARKTEST_H_
+
+
+void qbenchmarktest();
+
+
+#endif /* QBENCHMARKTEST_H_ */
@@ -0,0 +1,129 @@
+/*
+ * qexpressiontest.cpp
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: a1994846931931
+ *
+ *  比较逐个运算符立即计算(旧实现, 每个运算符产生一个中间对象)与表达式模板(一次循环)
+ *  在trajectory/和pathplanner/中常见表达式上的用时.
+ */
+
+# include "qexpressiontest.h"
+# include "../../math/Q.h"
+# include "../../math/Rotation3D.h"
+# include "../../math/Vector3D.h"
+# include <time.h>
+# include <iostream>
+
+using namespace robot::math;
+using std::cout;
+using std::endl;
+
+namespace {
+
+/**> 旧实现: 复制后逐个运算, 每个运算符返回新的数组 */
+Q eagerAdd(const Q& a, const Q& b) { Q q(a); q += b; return q; }
+Q eagerSub(const Q& a, const Q& b) { Q q(a); q -= b; return q; }
+Q eagerMul(const Q& a, double num) { Q q(a); q *= num; return q; }
+Q eagerDiv(const Q& a, double num) { Q q(a); q *= 1.0/num; return q; }
+
+Vector3D<> eagerAdd(const Vector3D<>& a, const Vector3D<>& b) { return Vector3D<>(a(0) + b(0), a(1) + b(1), a(2) + b(2)); }
+Vector3D<> eagerSub(const Vector3D<>& a, const Vector3D<>& b) { return Vector3D<>(a(0) - b(0), a(1) - b(1), a(2) - b(2)); }
+Vector3D<> eagerMul(const Vector3D<>& a, double num) { return Vector3D<>(a(0)*num, a(1)*num, a(2)*num); }
+
+const int loop = 1000000;
+
+double ns(clock_t start, clock_t end)
+{
+	return (end - start)/(double)loop*1000.0;
+}
+
+}
+
+void qexpressiontest()
+{
+	Q x0(0.1, 0.2, 0.3, 0.4, 0.5, 0.6);
+	Q x1(0.2, 0.3, 0.4, 0.5, 0.6, 0.7);
+	Q x2(0.3, 0.5, 0.4, 0.6, 0.8, 0.9);
+	Q result;
+	double sink = 0;
+	const double h = 1e-4;
+
+	/**> Interpolator<Q>::getState: (x0 + x2 - x1*2.0)/(h*h) */
+	clock_t start = clock();
+	for (int i=0; i<loop; i++)
+	{
+		x0(0) = i*1e-9;
+		result = eagerDiv(eagerSub(eagerAdd(x0, x2), eagerMul(x1, 2.0)), h*h);
+		sink += result[0];
+	}
+	clock_t end = clock();
+	cout << "(x0 + x2 - x1*2)/h^2  旧实现: " << ns(start, end) << "ns";
+	start = clock();
+	for (int i=0; i<loop; i++)
+	{
+		x0(0) = i*1e-9;
+		result = (x0 + x2 - x1*2.0)/(h*h);
+		sink += result[0];
+	}
+	end = clock();
+	cout << ", 表达式模板: " << ns(start, end) << "ns" << endl;
+
+	/**> LinearInterpolator/插补: x0 + (x1 - x0)*t */
+	start = clock();
+	for (int i=0; i<loop; i++)
+	{
+		result = eagerAdd(x0, eagerMul(eagerSub(x1, x0), i*1e-6));
+		sink += result[5];
+	}
+	end = clock();
+	cout << "x0 + (x1 - x0)*t      旧实现: " << ns(start, end) << "ns";
+	start = clock();
+	for (int i=0; i<loop; i++)
+	{
+		result = x0 + (x1 - x0)*(i*1e-6);
+		sink += result[5];
+	}
+	end = clock();
+	cout << ", 表达式模板: " << ns(start, end) << "ns" << endl;
+
+	/**> Trajectory::sampleVelAcc: ((x2 - x1)/dt).getMin() */
+	start = clock();
+	for (int i=0; i<loop; i++)
+	{
+		x2(3) = 0.6 + i*1e-9;
+		sink += eagerDiv(eagerSub(x2, x1), h).getMin();
+	}
+	end = clock();
+	cout << "((x2 - x1)/dt).getMin 旧实现: " << ns(start, end) << "ns";
+	start = clock();
+	for (int i=0; i<loop; i++)
+	{
+		x2(3) = 0.6 + i*1e-9;
+		sink += ((x2 - x1)/h).getMin();
+	}
+	end = clock();
+	cout << ", 表达式模板: " << ns(start, end) << "ns" << endl;
+
+	/**> 位置插补: p0 + (p1 - p0)*t, 以及(p1 - p0).getLength() */
+	Vector3D<> p0(0.1, 0.2, 0.3);
+	Vector3D<> p1(0.4, 0.1, 0.5);
+	Vector3D<> p;
+	start = clock();
+	for (int i=0; i<loop; i++)
+	{
+		p = eagerAdd(p0, eagerMul(eagerSub(p1, p0), i*1e-6));
+		sink += p(2) + eagerSub(p, p0).getLength();
+	}
+	end = clock();
+	cout << "p0 + (p1 - p0)*t      旧实现: " << ns(start, end) << "ns";
+	start = clock();
+	for (int i=0; i<loop; i++)
+	{
+		p = p0 + (p1 - p0)*(i*1e-6);
+		sink += p(2) + (p - p0).getLength();
+	}
+	end = clock();
+	cout << ", 表达式模板: " << ns(start, end) << "ns" << endl;
+	cout << "(" << sink << ")" << endl;
+}
@@ -0,0 +1,15 @@
+/*
+ * qexpressiontest.h
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: a1994846931931
+ */
+
+#ifndef QEXPRESSIONTEST_H_
+#define QEXPRESSIONTEST_H_
+
+
+void qexpressiontest();
+
+
+#endif /* QEXPRESSIONTEST_H_ */
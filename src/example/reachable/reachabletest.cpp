@@ -0,0 +1,140 @@
+/*
+ * reachabletest.cpp
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: a1994846931931
+ *
+ *  示教最远点搜索的测试: 在siasun6.xml上, 对若干起点和x, y, z, rx, ry, rz方向, 比较原先的逐步试探
+ *  (直线1cm, 旋转0.05rad)与ReachableSearch(步长加倍+二分, 精度1e-4)的逆解次数, 用时和最远距离.
+ */
+
+# include "reachabletest.h"
+# include "../../ik/SiasunSR4CSolver.h"
+# include "../../pathplanner/LinePlanner.h"
+# include "../../pathplanner/RotationPlanner.h"
+# include "../../parse/RobotXMLParser.h"
+# include "../../common/common.h"
+# include <iostream>
+
+using namespace robot::math;
+using namespace robot::model;
+using namespace robot::ik;
+using namespace robot::common;
+using namespace robot::pathplanner;
+using std::cout;
+using std::endl;
+
+namespace {
+
+const char* limitName(ReachLimit limit)
+{
+	switch (limit)
+	{
+	case reachWorkspace:
+		return "工作空间";
+	case reachJointLimit:
+		return "关节范围";
+	case reachSingularity:
+		return "奇异点";
+	case reachDiscontinuity:
+		return "关节跳变";
+	default:
+		return "搜索范围";
+	}
+}
+
+/**
+ * @brief 原先的直线逐步试探(1cm), 返回最远距离
+ */
+double stepLine(const Q& start, Vector3D<double> direction, IKSolver::ptr solver, int& evaluations)
+{
+	const Config config = solver->getConfig(start);
+	const HTransform3D<double> startTran = solver->getRobot()->getEndTransform(start);
+	const double dl = 0.01;
+	direction.doNormalize();
+	IKSolutionSet solutions;
+	double s = 0;
+	evaluations = 0;
+	do{
+		evaluations++;
+		if (solver->solveInto(HTransform3D<double>(startTran.getPosition() + direction*(s + dl), startTran.getRotation()), config, solutions) != ikSuccess)
+			break;
+		s += dl;
+	}
+	while (s < 10);
+	return s;
+}
+
+/**
+ * @brief 原先的旋转逐步试探(0.05rad, 检查奇异点), 返回最远角度
+ */
+double stepRotation(const Q& start, const Vector3D<double>& n, IKSolver::ptr solver, int& evaluations)
+{
+	const Config config = solver->getConfig(start);
+	const HTransform3D<double> startTran = solver->getRobot()->getEndTransform(start);
+	const double da = 0.05;
+	IKSolutionSet solutions;
+	Q q;
+	double theta = 0;
+	evaluations = 0;
+	while (theta + da <= 2*M_PI)
+	{
+		evaluations++;
+		if (solver->solveInto(HTransform3D<double>(startTran.getPosition(), startTran.getRotation()*(Quaternion(theta + da, n)).toRotation3D()), config, solutions) != ikSuccess)
+			break;
+		solutions.get(0, q);
+		if (solver->singularJudge(q) != 0)
+			break;
+		theta += da;
+	}
+	return theta;
+}
+
+}
+
+void reachabletest()
+{
+	robot::parse::RobotXMLParser modelParser;
+	SerialLink::ptr robot = modelParser.parse("src/example/modelData/siasun6.xml");
+	IKSolver::ptr solver(new SiasunSR4CSolver(robot));
+	const Q starts[3] = {Q(0, -0.3, 0.5, 0, -0.8, 0), Q(0.5, 0.2, -0.4, 0.3, -1.0, 0.4), Q(-0.8, -0.6, 1.0, -0.5, -0.6, -0.2)};
+	const Vector3D<double> axes[3] = {Vector3D<double>(1, 0, 0), Vector3D<double>(0, 1, 0), Vector3D<double>(0, 0, 1)};
+	const char* names[3] = {"x", "y", "z"};
+	const int rounds = 20;
+
+	for (int i=0; i<3; i++)
+	{
+		cout << "起点" << i << ":" << endl;
+		for (int k=0; k<6; k++)
+		{
+			Vector3D<double> direction = axes[k/2];
+			if (k%2 == 1)
+				direction = -direction;
+			const char sign = (k%2 == 0) ? '+' : '-';
+			int stepEvaluations = 0;
+			double stepDistance = 0;
+			ReachResult reach;
+			unsigned long long t0 = getUTime();
+			for (int round=0; round<rounds; round++)
+				stepDistance = stepLine(starts[i], direction, solver, stepEvaluations);
+			unsigned long long t1 = getUTime();
+			for (int round=0; round<rounds; round++)
+				reach = LinePlanner::findReachable(starts[i], direction, solver, 1e-4, false);
+			unsigned long long t2 = getUTime();
+			cout << "  " << sign << names[k/2] << ": 逐步 " << stepDistance << "m " << stepEvaluations << "次 " << (t1 - t0)/rounds << "us, "
+					<< "二分 " << reach.distance << "m " << reach.evaluations << "次 " << (t2 - t1)/rounds << "us, "
+					<< "限制: " << limitName(reach.limit) << endl;
+
+			t0 = getUTime();
+			for (int round=0; round<rounds; round++)
+				stepDistance = stepRotation(starts[i], direction, solver, stepEvaluations);
+			t1 = getUTime();
+			for (int round=0; round<rounds; round++)
+				reach = RotationPlanner::findReachable(starts[i], direction, solver);
+			t2 = getUTime();
+			cout << "  " << sign << "r" << names[k/2] << ": 逐步 " << stepDistance << "rad " << stepEvaluations << "次 " << (t1 - t0)/rounds << "us, "
+					<< "二分 " << reach.distance << "rad " << reach.evaluations << "次 " << (t2 - t1)/rounds << "us, "
+					<< "限制: " << limitName(reach.limit) << endl;
+		}
+	}
+}
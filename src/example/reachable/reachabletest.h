@@ -0,0 +1,15 @@
+/*
+ * reachabletest.h
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: a1994846931931
+ */
+
+#ifndef REACHABLETEST_H_
+#define REACHABLETEST_H_
+
+
+void reachabletest();
+
+
+#endif /* REACHABLETEST_H_ */
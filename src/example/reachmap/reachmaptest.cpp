@@ -0,0 +1,139 @@
+/*
+ * reachmaptest.cpp
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: a1994846931931
+ *
+ *  ReachabilityMap的测试: 在siasun6.xml上生成可达性地图(/tmp), 检查加载时间和地图的正确性
+ *  (随机关节角的末端点和末端位姿都应通过mayReach), 再比较LinePlanner用地图筛选与直接query的结果和用时.
+ */
+
+# include "reachmaptest.h"
+# include "../../ik/ReachabilityMap.h"
+# include "../../ik/SiasunSR4CSolver.h"
+# include "../../pathplanner/LinePlanner.h"
+# include "../../parse/RobotXMLParser.h"
+# include "../../common/common.h"
+# include "../../common/ThreadPool.h"
+# include <iostream>
+
+using namespace robot::math;
+using namespace robot::model;
+using namespace robot::ik;
+using namespace robot::common;
+using namespace robot::pathplanner;
+using std::cout;
+using std::endl;
+
+namespace {
+
+Q randomQ(SerialLink::ptr robot)
+{
+	const Q qMin = robot->getJointMin();
+	const Q qMax = robot->getJointMax();
+	Q q = Q::zero(6);
+	for (int k=0; k<6; k++)
+		q(k) = fRand(std::max(qMin[k], -M_PI), std::min(qMax[k], M_PI));
+	return q;
+}
+
+/**
+ * @brief 比较LinePlanner用地图筛选与直接query的结果和用时
+ * @param acrossBase [in] 为true时起点和终点在基座的两侧(第一轴相差约pi), 直线经过基座附近
+ */
+void compareLines(const char* name, SerialLink::ptr robot, IKSolver::ptr solver, ReachabilityMap::ptr map, bool acrossBase)
+{
+	const Q dqLim(3, 3, 3, 3, 5, 5), ddqLim(20, 20, 20, 20, 20, 20);
+	const int lines = 100;
+	int rejected = 0, failed = 0, both = 0;
+	unsigned long long screenTime = 0, queryTime = 0, t0, t1;
+	for (int i=0; i<lines; i++)
+	{
+		const Q qStart = randomQ(robot);
+		Q qEnd = randomQ(robot);
+		while (solver->getConfig(qEnd) != solver->getConfig(qStart) || (acrossBase && fabs(fabs(qEnd[0] - qStart[0]) - M_PI) > 0.3))
+			qEnd = randomQ(robot);
+		LinePlanner planner(dqLim, ddqLim, 1.0, 20.0, 50, solver, qStart, qEnd);
+		planner.setReachabilityMap(map);
+		t0 = getUTime();
+		const bool screened = planner.prescreen();
+		t1 = getUTime();
+		screenTime += t1 - t0;
+		planner.setReachabilityMap(ReachabilityMap::ptr());
+		bool success = true;
+		t0 = getUTime();
+		try
+		{
+			planner.query();
+		}
+		catch (char const* msg)
+		{
+			success = false;
+		}
+		catch (std::string& msg)
+		{
+			success = false;
+		}
+		t1 = getUTime();
+		queryTime += t1 - t0;
+		rejected += !screened;
+		failed += !success;
+		both += (!screened && !success);
+	}
+	cout << name << "直线" << lines << "条: 地图筛选拒绝" << rejected << "条(其中query也失败" << both << "条), query失败" << failed << "条; "
+			<< "筛选平均" << (double)screenTime/lines << "us, query平均" << (double)queryTime/lines << "us" << endl;
+}
+
+}
+
+void reachmaptest()
+{
+	robot::parse::RobotXMLParser modelParser;
+	SerialLink::ptr robot = modelParser.parse("src/example/modelData/siasun6.xml");
+	IKSolver::ptr solver(new SiasunSR4CSolver(robot));
+	const std::string directory = "/tmp";
+	const double resolution = 0.1;
+
+	/**> 生成 */
+	unsigned long long t0 = getUTime();
+	ReachabilityMap::ptr map = ReachabilityMap::build(solver, resolution, ReachabilityMap::defaultFileName(directory, *robot));
+	unsigned long long t1 = getUTime();
+	const ReachabilityMap::Header& header = map->header();
+	cout << "生成: " << header.dims[0] << "x" << header.dims[1] << "x" << header.dims[2] << "个体素, "
+			<< ThreadPool::global().size() << "个线程, 用时" << (t1 - t0)/1000 << "ms" << endl;
+
+	/**> 加载(只映射文件) */
+	t0 = getUTime();
+	ReachabilityMap::ptr loaded = ReachabilityMap::loadOrBuild(directory, solver, resolution);
+	t1 = getUTime();
+	int reachable = 0, branches[8] = {0};
+	for (int i=0; i<loaded->size(); i++)
+	{
+		reachable += (loaded->voxel(i).configs != 0);
+		for (int b=0; b<8; b++)
+			branches[b] += ((loaded->voxel(i).configs >> b) & 1);
+	}
+	cout << "加载: 用时" << (t1 - t0) << "us, 可到达的体素" << reachable << "/" << loaded->size() << ", 各分支:";
+	for (int b=0; b<8; b++)
+		cout << " " << branches[b];
+	cout << endl;
+
+	/**> 随机关节角的末端点都应可能到达 */
+	const int count = 20000;
+	int pass = 0, posePass = 0, center = 0;
+	for (int i=0; i<count; i++)
+	{
+		const Q q = randomQ(robot);
+		const HTransform3D<double> pose = robot->getEndTransform(q);
+		const Config config = solver->getConfig(q);
+		pass += loaded->mayReach(pose.getPosition(), config);
+		posePass += loaded->mayReach(pose, config);
+		center += loaded->reachable(pose.getPosition(), config);
+	}
+	cout << "随机关节角: mayReach(位置)通过" << pass << "/" << count << ", mayReach(位姿)通过" << posePass << "/" << count
+			<< ", 所在体素中心可到达" << center << "/" << count << endl;
+
+	/**> 直线筛选与直接规划 */
+	compareLines("随机", robot, solver, loaded, false);
+	compareLines("经过基座附近的", robot, solver, loaded, true);
+}
@@ -0,0 +1,15 @@
+/*
+ * reachmaptest.h
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: a1994846931931
+ */
+
+#ifndef REACHMAPTEST_H_
+#define REACHMAPTEST_H_
+
+
+void reachmaptest();
+
+
+#endif /* REACHMAPTEST_H_ */
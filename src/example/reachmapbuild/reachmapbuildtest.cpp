@@ -0,0 +1,68 @@
+/*
+ * reachmapbuildtest.cpp
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: a1994846931931
+ *
+ *  生成modelData中6轴机器人的可达性地图文件(directory/reach_<散列值>.map), 模型文件或关节范围修改后需要重新生成.
+ *  运行时用ReachabilityMap::load或loadOrBuild映射生成的文件.
+ */
+
+# include "reachmapbuildtest.h"
+# include "../../ik/ReachabilityMap.h"
+# include "../../ik/SiasunSR4CSolver.h"
+# include "../../ik/PieperSolver.h"
+# include "../../parse/RobotXMLParser.h"
+# include "../../common/common.h"
+# include "../../common/ThreadPool.h"
+# include <iostream>
+
+using namespace robot::model;
+using namespace robot::ik;
+using namespace robot::common;
+using std::cout;
+using std::endl;
+
+namespace {
+
+/** @brief 地图文件的目录 */
+const char* const directory = "/tmp";
+
+/** @brief 体素边长(m) */
+const double resolution = 0.05;
+
+/**
+ * @brief 生成一个模型的地图, 并检查重新加载的结果
+ */
+void build(const char* name, IKSolver::ptr solver)
+{
+	const SerialLink& robot = *solver->getRobot();
+	const std::string fileName = ReachabilityMap::defaultFileName(directory, robot);
+	unsigned long long t0 = getUTime();
+	ReachabilityMap::ptr map = ReachabilityMap::build(solver, resolution, fileName);
+	unsigned long long t1 = getUTime();
+	ReachabilityMap::ptr loaded = ReachabilityMap::load(fileName, robot);
+	int reachable = 0;
+	for (int i=0; i<loaded->size(); i++)
+		reachable += (loaded->voxel(i).configs != 0);
+	const ReachabilityMap::Header& header = loaded->header();
+	cout << name << ": " << fileName << ", " << header.dims[0] << "x" << header.dims[1] << "x" << header.dims[2] << "个体素(可到达"
+			<< reachable << "), " << (sizeof(ReachabilityMap::Header) + loaded->size()*sizeof(ReachabilityMap::Voxel))/1024 << "KB, "
+			<< ThreadPool::global().size() << "个线程用时" << (t1 - t0)/1000 << "ms" << endl;
+}
+
+}
+
+void reachmapbuildtest()
+{
+	robot::parse::RobotXMLParser modelParser;
+	SerialLink::ptr siasun6 = modelParser.parse("src/example/modelData/siasun6.xml");
+	SerialLink::ptr puma560 = modelParser.parse("src/example/modelData/puma560.xml");
+
+	build("siasun6", IKSolver::ptr(new SiasunSR4CSolver(siasun6)));
+	std::shared_ptr<PieperSolver> pieper(new PieperSolver(puma560));
+	if (pieper->isValid())
+		build("puma560", pieper);
+	else
+		cout << "puma560: PieperSolver不能求解该模型" << endl;
+}
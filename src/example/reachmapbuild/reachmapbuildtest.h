@@ -0,0 +1,15 @@
+/*
+ * reachmapbuildtest.h
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: a1994846931931
+ */
+
+#ifndef REACHMAPBUILDTEST_H_
+#define REACHMAPBUILDTEST_H_
+
+
+void reachmapbuildtest();
+
+
+#endif /* REACHMAPBUILDTEST_H_ */
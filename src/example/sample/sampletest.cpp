@@ -0,0 +1,126 @@
+/*
+ * sampletest.cpp
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: a1994846931931
+ *
+ *  Interpolator<Q>::sampleInto的测试: 对LinePlanner的轨迹和关节空间的直线轨迹, 比较原来按t+=dt累加的采样循环
+ *  与sampleInto(SampleBuffer)的采样点数, 最后一个点是否为终点, 结果的差别和用时; 重复使用同一个SampleBuffer时不再分配内存.
+ *  关节直线轨迹不经过逆解, 再比较顺序和并行采样.
+ */
+
+# include "sampletest.h"
+# include "../../trajectory/SampleBuffer.h"
+# include "../../trajectory/Sampler.h"
+# include "../../ik/SiasunSR4CSolver.h"
+# include "../../pathplanner/LinePlanner.h"
+# include "../../pathplanner/SmoothMotionPlanner.h"
+# include "../../trajectory/LinearInterpolator.h"
+# include "../../trajectory/CompositeInterpolator.h"
+# include "../../parse/RobotXMLParser.h"
+# include "../../common/common.h"
+# include <vector>
+# include <algorithm>
+# include <iostream>
+
+using namespace robot::math;
+using namespace robot::model;
+using namespace robot::ik;
+using namespace robot::common;
+using namespace robot::trajectory;
+using namespace robot::pathplanner;
+using std::vector;
+using std::cout;
+using std::endl;
+
+namespace {
+
+/** @brief 两个关节量之差的最大绝对值 */
+double maxDifference(const Q& a, const Q& b)
+{
+	Q delta = a - b;
+	delta.abs();
+	return delta.getMax();
+}
+
+/**
+ * @brief 原来的采样方法: t从0开始累加dt, 直到超过duration
+ */
+vector<Q> loopSample(Interpolator<Q>::ptr ipr, int step)
+{
+	vector<Q> q;
+	double T = ipr->duration();
+	double dt = T/double(step - 1);
+	for (double t=0; t<=T; t+=dt)
+		q.push_back(ipr->x(t));
+	return q;
+}
+
+/**
+ * @brief 比较一条轨迹的两种采样
+ */
+void compare(const char* name, Interpolator<Q>::ptr ipr, int step, int repeat)
+{
+	vector<Q> loop;
+	unsigned long long t0 = getUTime();
+	for (int k=0; k<repeat; k++)
+		loop = loopSample(ipr, step);
+	unsigned long long t1 = getUTime();
+	SampleBuffer buffer(SampleBuffer::position);
+	const vector<double> times = SampleBuffer::timeGrid(ipr->duration(), step);
+	for (int k=0; k<repeat; k++)
+		ipr->sampleInto(times, buffer);
+	unsigned long long t2 = getUTime();
+
+	double difference = 0;
+	for (int i=0; i<(int)std::min(loop.size(), (size_t)buffer.size()); i++)
+		difference = std::max(difference, maxDifference(loop[i], buffer.get(SampleBuffer::position, i)));
+	const Q end = ipr->x(ipr->duration());
+	cout << name << ": " << step << "个点, t+=dt循环得到" << loop.size() << "个点, 最后一点与终点差" << maxDifference(loop.back(), end)
+			<< "; sampleInto得到" << buffer.size() << "个点, 最后一点与终点差" << maxDifference(buffer.get(SampleBuffer::position, buffer.size() - 1), end)
+			<< "; 公共点最大差" << difference << "; 用时 " << (t1 - t0)/repeat << "us / " << (t2 - t1)/repeat << "us" << endl;
+}
+
+}
+
+void sampletest()
+{
+	robot::parse::RobotXMLParser modelParser;
+	SerialLink::ptr robot = modelParser.parse("src/example/modelData/siasun6.xml");
+	std::shared_ptr<SiasunSR4CSolver> solver(new SiasunSR4CSolver(robot));
+	const Q dqLim(3, 3, 3, 3, 5, 5), ddqLim(20, 20, 20, 20, 20, 20);
+	const Q start = Q::zero(6);
+
+	LinePlanner line(dqLim, ddqLim, 1.0, 20.0, 50, solver, start, Q(1.5, 0, 0, 0, -1.5, 0));
+	for (int step : {7, 100, 1000})
+		compare("LinePlanner", line.query(), step, 20);
+
+	SmoothMotionPlanner smPlanner;
+	auto path = std::make_shared<LinearInterpolator<Q> >(start, Q(2, 0.5, 0.5, 0, -1.2, 2), 2);
+	Interpolator<Q>::ptr joint(new CompositeInterpolator<Q>(path, smPlanner.query(2, 100, 10, 1.5)));
+	for (int step : {7, 100, 10000})
+		compare("关节直线", joint, step, 20);
+
+	/**> 不经过逆解的轨迹可以并行采样全部的量 */
+	const vector<double> times = SampleBuffer::timeGrid(joint->duration(), 100000);
+	SampleBuffer sequential(SampleBuffer::all), parallel(SampleBuffer::all);
+	unsigned long long t0 = getUTime();
+	joint->sampleInto(times, sequential);
+	unsigned long long t1 = getUTime();
+	joint->sampleInto(times, parallel, ExecPolicy(ExecPolicy::parallel, 4096));
+	unsigned long long t2 = getUTime();
+	double difference = 0;
+	for (int j=0; j<sequential.dof(); j++)
+	{
+		const double* a = sequential.row(SampleBuffer::acceleration, j);
+		const double* b = parallel.row(SampleBuffer::acceleration, j);
+		for (int i=0; i<sequential.size(); i++)
+			difference = std::max(difference, fabs(a[i] - b[i]));
+	}
+	cout << "关节直线" << times.size() << "个点: 顺序" << (t1 - t0)/1000 << "ms, 并行" << (t2 - t1)/1000 << "ms (线程池"
+			<< ThreadPool::global().size() << "个线程), 加速度最大差" << difference
+			<< "; 最大速度" << sequential.getMaxAbs(SampleBuffer::velocity)[0] << ", getMaxdQ " << joint->getMaxdQ(100000)[0] << endl;
+
+	vector<Q> dx = Sampler<Q>::sample(joint, 1000, "dx");
+	cout << "Sampler<Q>::sample: " << dx.size() << "个点, 最后一点与终点速度差" << maxDifference(dx.back(), joint->dx(joint->duration())) << endl;
+}
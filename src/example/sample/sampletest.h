@@ -0,0 +1,15 @@
+/*
+ * sampletest.h
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: a1994846931931
+ */
+
+#ifndef SAMPLETEST_H_
+#define SAMPLETEST_H_
+
+
+void sampletest();
+
+
+#endif /* SAMPLETEST_H_ */
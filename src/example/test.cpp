@@ -58,6 +58,30 @@
 # include "mlabplanner/mlabplannertest.h"
 # include "motionstack/motionstacktest.h"
 # include "q2qplanner/q2qplannertest.h"
+//# include "qbenchmark/qbenchmarktest.h"
+//# include "qexpression/qexpressiontest.h"
+//# include "fkbatch/fkbatchtest.h"
+//# include "jointtrig/jointtrigtest.h"
+//# include "dualquaternion/dualquaterniontest.h"
+//# include "jacobian/jacobiantest.h"
+//# include "kinematics/kinematicstest.h"
+//# include "kinematicscache/kinematicscachetest.h"
+//# include "batchfk/batchfktest.h"
+//# include "codegen/codegentest.h"
+//# include "iksolve/iksolvetest.h"
+//# include "ikbatch/ikbatchtest.h"
+//# include "numericik/numericiktest.h"
+//# include "ikcache/ikcachetest.h"
+//# include "pieper/piepertest.h"
+//# include "reachable/reachabletest.h"
+//# include "reachmap/reachmaptest.h"
+//# include "reachmapbuild/reachmapbuildtest.h"
+//# include "ikseed/ikseedtest.h"
+//# include "evaluate/evaluatetest.h"
+//# include "ppoly/ppolytest.h"
+//# include "playback/playbacktest.h"
+//# include "bake/baketest.h"
+//# include "sample/sampletest.h"
 # include <functional>
 # include <map>
 
@@ -187,6 +211,44 @@ int main(){
 
 	q2qplannertest();
 
+//	qbenchmarktest();
+
+//	qexpressiontest();
+
+//	fkbatchtest();
+
+//	jointtrigtest();
+
+//	dualquaterniontest();
+
+//	jacobiantest();
+
+//	kinematicstest();
+
+//	kinematicscachetest();
+
+//	batchfktest();
+
+//	codegentest();
+
+//	iksolvetest();
+
+//	ikbatchtest();
+
+//	numericiktest();
+
+//	ikcachetest();
+//	piepertest();
+//	reachabletest();
+//	reachmaptest();
+//	reachmapbuildtest();
+//	ikseedtest();
+//	evaluatetest();
+//	ppolytest();
+//	playbacktest();
+//	baketest();
+//	sampletest();
+
 //	Q pos(0, 0, 0, 0, 0, 0);
 //	Q velocity = Q(2./sqrt(3), 2./sqrt(3), 2./sqrt(3), 0, 0, 0);
 //	HTransform3D<> end = robot.getEndTransform(pos);
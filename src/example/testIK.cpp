@@ -19,6 +19,7 @@
 # include "../model/Link.h"
 # include "test.h"
 # include "../ik/PieperSolver.h"
+# include "../model/Config.h"
 # include <stdlib.h>
 # include <time.h>
 # include "../common/common.h"
@@ -33,7 +34,7 @@ using namespace robot::ik;
 void ikTest()
 {
 	println("*** test ***");
-	SerialLink robot;
+	SerialLink::ptr robot(new SerialLink());
 
 //	double alpha1 = M_PI/2;
 //	double alpha2 = 0;
@@ -106,12 +107,12 @@ void ikTest()
 	Link l4(alpha4, a4, d4, theta4, lmin4, lmax4);
 	Link l5(alpha5, a5, d5, theta5, lmin5, lmax5);
 	Link l6(alpha6, a6, d6, theta6, lmin6, lmax6);
-	robot.append(&l1);
-	robot.append(&l2);
-	robot.append(&l3);
-	robot.append(&l4);
-	robot.append(&l5);
-	robot.append(&l6);
+	robot->append(&l1);
+	robot->append(&l2);
+	robot->append(&l3);
+	robot->append(&l4);
+	robot->append(&l5);
+	robot->append(&l6);
 
 	PieperSolver solver(robot);
 	int MAXSTEP = 10000;
@@ -123,12 +124,17 @@ void ikTest()
 
 	HTransform3D<> endTran;
 	std::vector<Q> result;
+	IKSolutionSet solutions;
+	const Config freeConfig(Config::sfree, Config::efree, Config::wfree);
 	Jacobian J;
 	for (int i=0; i<MAXSTEP; i++)
 	{
 		robot::math::Q q(fRand(-3.14, 3.14), fRand(-3.14, 3.14), fRand(-3.14, 3.14), fRand(-3.14, 3.14), fRand(-3.14, 3.14), fRand(-3.14, 3.14));
-		endTran = robot.getEndTransform(q);
-		result = solver.solve(endTran);
+		endTran = robot->getEndTransform(q);
+		if (solver.solveInto(endTran, freeConfig, solutions) == ikSuccess)
+			solutions.toVector(result);
+		else
+			result.clear();
 		if (result.size() == 0)
 		{
 			unsolved++;
@@ -138,7 +144,7 @@ void ikTest()
 			allresult += result.size();
 			for (unsigned int i=0; i<result.size(); i++)
 			{
-				if (endTran == robot.getEndTransform(result[i]))
+				if (endTran == robot->getEndTransform(result[i]))
 				{
 					correct++;
 				}
@@ -150,10 +156,10 @@ void ikTest()
 					result[i].print();
 					println("正确变换矩阵与求得的变换矩阵");
 					endTran.print();
-					robot.getEndTransform(result[i]).print();
+					robot->getEndTransform(result[i]).print();
 				}
 			}
-			J = robot.getJacobian(result[0]);
+			J = robot->getJacobian(result[0]);
 			J.doInverse();
 		}
 	}
@@ -0,0 +1,244 @@
+/*
+ * CachedIKSolver.cpp
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: a1994846931931
+ */
+
+# include "CachedIKSolver.h"
+# include <math.h>
+
+using robot::math::Q;
+using robot::math::TransformBatch;
+using robot::model::SerialLink;
+using robot::model::Config;
+
+namespace robot {
+namespace ik {
+
+namespace {
+
+const int kindSet = 0;
+const int kindNearest = 1;
+const int kindBatch = 2;
+
+}
+
+bool CachedIKSolver::Key::operator==(const Key& other) const
+{
+	if (size != other.size)
+		return false;
+	for (int i=0; i<size; i++)
+		if (value[i] != other.value[i])
+			return false;
+	return true;
+}
+
+size_t CachedIKSolver::KeyHash::operator()(const Key& key) const
+{
+	// FNV-1a
+	unsigned long long hash = 14695981039346656037ull;
+	for (int i=0; i<key.size; i++)
+	{
+		hash ^= (unsigned long long)key.value[i];
+		hash *= 1099511628211ull;
+	}
+	return (size_t)(hash ^ (hash >> 32));
+}
+
+CachedIKSolver::CachedIKSolver(IKSolver::ptr solver, int capacity, double resolution) :
+		_solver(solver),
+		_capacity(capacity),
+		_resolution(resolution)
+{
+	if (capacity <= 0 || resolution <= 0)
+		throw("错误<CachedIKSolver>: 缓存容量和量化精度必须大于0!");
+	resetStatistics();
+}
+
+CachedIKSolver::Key CachedIKSolver::makeKey(int kind, const HTransform3D<>& baseTend, const Config& config, const Q* seed) const
+{
+	Key key;
+	key.size = 0;
+	for (int r=0; r<3; r++)
+		for (int c=0; c<4; c++)
+			key.value[key.size++] = llround(baseTend(r, c)/_resolution);
+	// same的部位取决于机器人当前的关节角, 换算成确定的配置后再作为键
+	int shoulder = config.getShoulder(), elbow = config.getElbow(), wrist = config.getWrist();
+	if (shoulder == Config::ssame || elbow == Config::esame || wrist == Config::wsame)
+	{
+		const Config current = _solver->getConfig(_solver->getRobot()->getQ());
+		shoulder = (shoulder == Config::ssame) ? current.getShoulder() : shoulder;
+		elbow = (elbow == Config::esame) ? current.getElbow() : elbow;
+		wrist = (wrist == Config::wsame) ? current.getWrist() : wrist;
+	}
+	key.value[key.size++] = kind*1000 + (shoulder + 1)*100 + (elbow + 1)*10 + (wrist + 1);
+	key.value[key.size++] = (seed == NULL) ? 0 : seed->size();
+	if (seed != NULL)
+	{
+		const int size = (seed->size() < robot::model::JointTrig::maxDOF) ? seed->size() : robot::model::JointTrig::maxDOF;
+		for (int i=0; i<size; i++)
+			key.value[key.size++] = llround((*seed)[i]/_resolution);
+	}
+	return key;
+}
+
+std::vector<Q> CachedIKSolver::solve(const HTransform3D<>& baseTend, const Config& config) const
+{
+	IKSolutionSet solutions;
+	const IKStatus status = solveInto(baseTend, config, solutions);
+	if (status == ikNoSolution)
+		throw (std::string("错误<CachedIKSolver>: 没有解!"));
+	if (status == ikOutOfRange)
+		throw (std::string("错误<CachedIKSolver>: 没有符合范围的解!"));
+	std::vector<Q> result;
+	solutions.toVector(result);
+	return result;
+}
+
+IKStatus CachedIKSolver::solveInto(const HTransform3D<>& baseTend, const Config& config, IKSolutionSet& result) const
+{
+	const Key key = makeKey(kindSet, baseTend, config, NULL);
+	{
+		std::lock_guard<std::mutex> lock(_mutex);
+		const SolutionSet* cached = _setCache.find(key);
+		if (cached != NULL)
+		{
+			_statistics.hits++;
+			result = cached->solutions;
+			return cached->status;
+		}
+		_statistics.misses++;
+	}
+	SolutionSet value;
+	value.status = _solver->solveInto(baseTend, config, value.solutions);
+	result = value.solutions;
+	std::lock_guard<std::mutex> lock(_mutex);
+	_statistics.evictions += _setCache.insert(key, value, _capacity);
+	return value.status;
+}
+
+IKStatus CachedIKSolver::solveNearest(const HTransform3D<>& baseTend, const Config& config, const Q& qPrev, Q& result) const
+{
+	const Key key = makeKey(kindNearest, baseTend, config, &qPrev);
+	{
+		std::lock_guard<std::mutex> lock(_mutex);
+		const Solution* cached = _nearestCache.find(key);
+		if (cached != NULL)
+		{
+			_statistics.hits++;
+			if (cached->status == ikSuccess)
+				result = cached->q;
+			return cached->status;
+		}
+		_statistics.misses++;
+	}
+	Solution value;
+	value.q = qPrev;
+	value.status = _solver->solveNearest(baseTend, config, qPrev, value.q);
+	if (value.status == ikSuccess)
+		result = value.q;
+	std::lock_guard<std::mutex> lock(_mutex);
+	_statistics.evictions += _nearestCache.insert(key, value, _capacity);
+	return value.status;
+}
+
+void CachedIKSolver::solveBatch(const TransformBatch& baseTend, const Config& config, Q* result, IKStatus* status) const
+{
+	const int size = baseTend.size();
+	std::vector<Key> keys(size);
+	std::vector<int> misses;
+	for (int i=0; i<size; i++)
+		keys[i] = makeKey(kindBatch, baseTend.get(i), config, NULL);
+	{
+		std::lock_guard<std::mutex> lock(_mutex);
+		for (int i=0; i<size; i++)
+		{
+			const Solution* cached = _batchCache.find(keys[i]);
+			if (cached == NULL)
+			{
+				misses.push_back(i);
+				continue;
+			}
+			status[i] = cached->status;
+			if (cached->status == ikSuccess)
+				result[i] = cached->q;
+		}
+		_statistics.hits += size - misses.size();
+		_statistics.misses += misses.size();
+	}
+	if (misses.empty())
+		return;
+	/**> 未命中的位姿一起交给被包装的逆解器 */
+	const int count = (int)misses.size();
+	TransformBatch poses(count);
+	for (int k=0; k<count; k++)
+		poses.set(k, baseTend.get(misses[k]));
+	std::vector<Q> q(count);
+	std::vector<IKStatus> s(count);
+	_solver->solveBatch(poses, config, q.data(), s.data());
+	std::lock_guard<std::mutex> lock(_mutex);
+	for (int k=0; k<count; k++)
+	{
+		const int i = misses[k];
+		status[i] = s[k];
+		if (s[k] == ikSuccess)
+			result[i] = q[k];
+		Solution value;
+		value.status = s[k];
+		value.q = q[k];
+		_statistics.evictions += _batchCache.insert(keys[i], value, _capacity);
+	}
+}
+
+Config CachedIKSolver::getConfig(const Q& q) const
+{
+	return _solver->getConfig(q);
+}
+
+SerialLink::ptr CachedIKSolver::getRobot() const
+{
+	return _solver->getRobot();
+}
+
+int CachedIKSolver::singularJudge(const Q& q) const
+{
+	return _solver->singularJudge(q);
+}
+
+IKSolver::ptr CachedIKSolver::getSolver() const
+{
+	return _solver;
+}
+
+CachedIKSolver::Statistics CachedIKSolver::getStatistics() const
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	Statistics statistics = _statistics;
+	statistics.size = _setCache.size() + _nearestCache.size() + _batchCache.size();
+	return statistics;
+}
+
+void CachedIKSolver::resetStatistics()
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	_statistics.hits = 0;
+	_statistics.misses = 0;
+	_statistics.evictions = 0;
+	_statistics.size = 0;
+}
+
+void CachedIKSolver::clear()
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	_setCache.clear();
+	_nearestCache.clear();
+	_batchCache.clear();
+}
+
+CachedIKSolver::~CachedIKSolver()
+{
+}
+
+} /* namespace ik */
+} /* namespace robot */
@@ -0,0 +1,228 @@
+/**
+ * @brief CachedIKSolver类
+ * @date Oct 16, 2026
+ * @author a1994846931931
+ */
+
+#ifndef CACHEDIKSOLVER_H_
+#define CACHEDIKSOLVER_H_
+
+# include "../math/Q.h"
+# include "../math/HTransform3D.h"
+# include "../model/SerialLink.h"
+# include "../model/Config.h"
+# include "IKSolver.h"
+# include <list>
+# include <unordered_map>
+# include <mutex>
+
+namespace robot {
+namespace ik {
+
+/** @addtogroup ik
+ * @{
+ */
+
+/**
+ * @brief 带缓存的逆解器, 可以包装任意IKSolver
+ *
+ * 同一条路径在规划(Trajectory采样), 分析(doLengthAnalysis)和执行(getState)时会重复逆解相同的位姿,
+ * 重复运行的程序(如搬运)更是每个周期都相同. CachedIKSolver把逆解结果按位姿保存下来, 再次遇到时直接返回.
+ *
+ * - 键为量化后的位姿(12个元素各除以resolution后取整)和Config; solveNearest的键还包括量化后的qPrev,
+ *   因此结果与被包装的逆解器完全相同(位姿相差小于resolution时视为同一个位姿).
+ * - 容量有限, 超过时淘汰最久未使用的结果(LRU).
+ * - 用互斥锁保护, 可以在多个线程(例如规划线程和执行线程)中共用. 未命中时在锁外调用被包装的逆解器,
+ *   因此被包装的逆解器本身也需要是线程安全的(SiasunSR4CSolver是, NumericIKSolver不是).
+ * - 命中时不申请内存, 未命中时添加缓存项会申请内存.
+ *
+ * @code
+ * IKSolver::ptr solver(new CachedIKSolver(IKSolver::ptr(new SiasunSR4CSolver(robot))));
+ * LinePlanner planner(dqLim, ddqLim, vMax, aMax, h, solver, qStart, qEnd);
+ * @endcode
+ */
+class CachedIKSolver: public IKSolver {
+public:
+	using ptr = std::shared_ptr<CachedIKSolver>;
+
+	/**
+	 * @brief 命中率统计
+	 */
+	struct Statistics {
+		/** @brief 命中次数 */
+		unsigned long long hits;
+
+		/** @brief 未命中次数 */
+		unsigned long long misses;
+
+		/** @brief 淘汰的缓存项个数 */
+		unsigned long long evictions;
+
+		/** @brief 当前的缓存项个数 */
+		int size;
+
+		/** @brief 命中率, 没有查询时为0 */
+		double hitRate() const
+		{
+			return (hits + misses == 0) ? 0 : (double)hits/(hits + misses);
+		}
+	};
+
+	/**
+	 * @brief 构造
+	 * @param solver [in] 被包装的逆解器
+	 * @param capacity [in] 每一类查询(solveInto, solveNearest, solveBatch)最多保存的结果个数
+	 * @param resolution [in] 位姿和关节角的量化精度
+	 */
+	CachedIKSolver(IKSolver::ptr solver, int capacity=4096, double resolution=1e-9);
+
+	/**
+	 * @brief 逆运动学求解, 由solveInto实现
+	 * @return 全部的解. 没有解时抛出异常
+	 */
+	std::vector<Q> solve(const HTransform3D<>& baseTend, const model::Config& config) const;
+
+	/**
+	 * @brief 逆运动学求解, 缓存全部的解
+	 */
+	IKStatus solveInto(const HTransform3D<>& baseTend, const model::Config& config, IKSolutionSet& result) const;
+
+	/**
+	 * @brief 最接近qPrev的解, 按位姿, Config和qPrev缓存
+	 */
+	IKStatus solveNearest(const HTransform3D<>& baseTend, const model::Config& config, const Q& qPrev, Q& result) const;
+
+	/**
+	 * @brief 批量逆解, 只把未命中的位姿交给被包装的逆解器批量计算
+	 */
+	void solveBatch(const robot::math::TransformBatch& baseTend, const model::Config& config, Q* result, IKStatus* status) const;
+
+	robot::model::Config getConfig(const robot::math::Q& q) const;
+
+	robot::model::SerialLink::ptr getRobot() const;
+
+	int singularJudge(const robot::math::Q& q) const;
+
+	/** @brief 被包装的逆解器 */
+	IKSolver::ptr getSolver() const;
+
+	/** @brief 命中率统计 */
+	Statistics getStatistics() const;
+
+	/** @brief 清空统计(不清空缓存) */
+	void resetStatistics();
+
+	/** @brief 清空缓存(机器人模型或tool改变后需要清空) */
+	void clear();
+
+	virtual ~CachedIKSolver();
+private:
+	/**
+	 * @brief 缓存的键: 量化后的位姿, Config和qPrev
+	 */
+	struct Key {
+		static const int maxSize = 12 + 3 + robot::model::JointTrig::maxDOF;
+		long long value[maxSize];
+		int size;
+
+		bool operator==(const Key& other) const;
+	};
+
+	struct KeyHash {
+		size_t operator()(const Key& key) const;
+	};
+
+	/** @brief solveNearest和solveBatch缓存的单个解 */
+	struct Solution {
+		IKStatus status;
+		robot::math::Q q;
+	};
+
+	/** @brief solveInto缓存的全部解 */
+	struct SolutionSet {
+		IKStatus status;
+		IKSolutionSet solutions;
+	};
+
+	/**
+	 * @brief 按最近使用顺序淘汰的缓存
+	 */
+	template<class V>
+	class LRU {
+	public:
+		/**
+		 * @brief 查找, 找到时移到最前面
+		 * @retval NULL 没有找到
+		 */
+		const V* find(const Key& key)
+		{
+			typename std::unordered_map<Key, typename std::list<std::pair<Key, V> >::iterator, KeyHash>::iterator it = _index.find(key);
+			if (it == _index.end())
+				return NULL;
+			_list.splice(_list.begin(), _list, it->second);
+			return &(it->second->second);
+		}
+
+		/**
+		 * @brief 添加(已有时覆盖)
+		 * @return 淘汰的个数
+		 */
+		int insert(const Key& key, const V& value, int capacity)
+		{
+			typename std::unordered_map<Key, typename std::list<std::pair<Key, V> >::iterator, KeyHash>::iterator it = _index.find(key);
+			if (it != _index.end())
+			{
+				it->second->second = value;
+				_list.splice(_list.begin(), _list, it->second);
+				return 0;
+			}
+			_list.push_front(std::make_pair(key, value));
+			_index[key] = _list.begin();
+			int evicted = 0;
+			while ((int)_list.size() > capacity)
+			{
+				_index.erase(_list.back().first);
+				_list.pop_back();
+				evicted++;
+			}
+			return evicted;
+		}
+
+		int size() const
+		{
+			return (int)_list.size();
+		}
+
+		void clear()
+		{
+			_index.clear();
+			_list.clear();
+		}
+	private:
+		std::list<std::pair<Key, V> > _list;
+		std::unordered_map<Key, typename std::list<std::pair<Key, V> >::iterator, KeyHash> _index;
+	};
+
+	/**
+	 * @brief 生成键
+	 * @param kind [in] 查询类型, 不同类型的结果不混用
+	 * @param seed [in] qPrev, 为NULL时不加入键
+	 */
+	Key makeKey(int kind, const HTransform3D<>& baseTend, const model::Config& config, const Q* seed) const;
+private:
+	IKSolver::ptr _solver;
+	const int _capacity;
+	const double _resolution;
+
+	mutable std::mutex _mutex;
+	mutable LRU<SolutionSet> _setCache;
+	mutable LRU<Solution> _nearestCache;
+	mutable LRU<Solution> _batchCache;
+	mutable Statistics _statistics;
+};
+
+/** @} */
+} /* namespace ik */
+} /* namespace robot */
+
+#endif /* CACHEDIKSOLVER_H_ */
@@ -0,0 +1,277 @@
+/*
+ * IKSeedIndex.cpp
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: a1994846931931
+ */
+
+# include "IKSeedIndex.h"
+# include "ReachabilityMap.h"
+# include <algorithm>
+# include <random>
+# include <stdio.h>
+# include <string.h>
+# include <math.h>
+
+using robot::math::Q;
+using robot::model::SerialLink;
+using robot::common::ExecPolicy;
+
+namespace robot {
+namespace ik {
+
+namespace {
+
+const char magic[8] = {'I', 'K', 'S', 'E', 'E', 'D', 0, 0};
+
+const uint32_t version = 1;
+
+/**
+ * @brief 文件头, 之后依次为_split, _keys, _q
+ */
+struct FileHeader {
+	char magic[8];
+	uint32_t version;
+	uint32_t dof;
+	uint64_t modelHash;
+	int32_t size;
+	int32_t keySize;
+	double orientationWeight;
+};
+
+}
+
+IKSeedIndex::IKSeedIndex() : _size(0), _dof(0), _orientationWeight(0), _modelHash(0)
+{
+}
+
+IKSeedIndex::IKSeedIndex(SerialLink::ptr robot, int count, double orientationWeight, unsigned int seed, const ExecPolicy& policy) :
+		_size(count),
+		_dof(robot->getDOF()),
+		_orientationWeight(orientationWeight),
+		_modelHash(ReachabilityMap::modelHash(*robot))
+{
+	if (count <= 0 || orientationWeight < 0)
+		throw ("错误<IKSeedIndex>: 采样个数必须大于0, 姿态权重不能小于0!");
+
+	/**> 采样关节角, 超过一圈的关节只取-180~180 */
+	const Q qMin = robot->getJointMin();
+	const Q qMax = robot->getJointMax();
+	std::mt19937 random(seed);
+	std::vector<Q> samples(count, Q::zero(_dof));
+	for (int i=0; i<count; i++)
+		for (int j=0; j<_dof; j++)
+		{
+			std::uniform_real_distribution<double> uniform(std::max(qMin[j], -M_PI), std::min(qMax[j], M_PI));
+			samples[i](j) = uniform(random);
+		}
+	std::vector<HTransform3D<double> > poses;
+	robot->getEndTransforms(samples, poses, policy);
+
+	std::vector<float> keys(count*keySize);
+	for (int i=0; i<count; i++)
+		keyOf(poses[i], &keys[i*keySize]);
+
+	/**> 建树后按树的顺序重新排列 */
+	std::vector<int> order(count);
+	for (int i=0; i<count; i++)
+		order[i] = i;
+	_keys.swap(keys);
+	_split.assign(count, 0);
+	split(order, 0, count);
+	keys.resize(count*keySize);
+	_q.resize(count*_dof);
+	for (int i=0; i<count; i++)
+	{
+		memcpy(&keys[i*keySize], &_keys[order[i]*keySize], keySize*sizeof(float));
+		for (int j=0; j<_dof; j++)
+			_q[i*_dof + j] = samples[order[i]][j];
+	}
+	_keys.swap(keys);
+}
+
+void IKSeedIndex::keyOf(const HTransform3D<double>& pose, float* key) const
+{
+	for (int r=0; r<3; r++)
+	{
+		key[r] = (float)pose(r, 3);
+		key[3 + r] = (float)(_orientationWeight*pose(r, 0));
+		key[6 + r] = (float)(_orientationWeight*pose(r, 2));
+	}
+}
+
+void IKSeedIndex::split(std::vector<int>& order, int lo, int hi)
+{
+	if (hi - lo <= leafSize)
+		return;
+	/**> 在范围最大的维度上分割 */
+	float low[keySize], high[keySize];
+	for (int d=0; d<keySize; d++)
+		low[d] = high[d] = _keys[order[lo]*keySize + d];
+	for (int i=lo+1; i<hi; i++)
+		for (int d=0; d<keySize; d++)
+		{
+			const float value = _keys[order[i]*keySize + d];
+			low[d] = std::min(low[d], value);
+			high[d] = std::max(high[d], value);
+		}
+	int dim = 0;
+	for (int d=1; d<keySize; d++)
+		if (high[d] - low[d] > high[dim] - low[dim])
+			dim = d;
+	const int mid = (lo + hi)/2;
+	const float* keys = _keys.data();
+	std::nth_element(order.begin() + lo, order.begin() + mid, order.begin() + hi,
+			[keys, dim](int a, int b){ return keys[a*keySize + dim] < keys[b*keySize + dim]; });
+	_split[mid] = dim;
+	split(order, lo, mid);
+	split(order, mid + 1, hi);
+}
+
+void IKSeedIndex::search(const float* key, int lo, int hi, int k, Candidate* best, int& found) const
+{
+	auto consider = [&](int index){
+		const float* other = &_keys[index*keySize];
+		float distance = 0;
+		for (int d=0; d<keySize; d++)
+			distance += (key[d] - other[d])*(key[d] - other[d]);
+		if (found == k && distance >= best[k - 1].distance)
+			return;
+		int i = (found < k) ? found++ : k - 1;
+		for (; i>0 && best[i - 1].distance > distance; i--)
+			best[i] = best[i - 1];
+		best[i].distance = distance;
+		best[i].index = index;
+	};
+	if (hi - lo <= leafSize)
+	{
+		for (int i=lo; i<hi; i++)
+			consider(i);
+		return;
+	}
+	const int mid = (lo + hi)/2;
+	const int dim = _split[mid];
+	consider(mid);
+	const float diff = key[dim] - _keys[mid*keySize + dim];
+	/**> 先查找同侧, 另一侧可能有更近的点时再查找 */
+	if (diff < 0)
+	{
+		search(key, lo, mid, k, best, found);
+		if (found < k || diff*diff < best[k - 1].distance)
+			search(key, mid + 1, hi, k, best, found);
+	}
+	else
+	{
+		search(key, mid + 1, hi, k, best, found);
+		if (found < k || diff*diff < best[k - 1].distance)
+			search(key, lo, mid, k, best, found);
+	}
+}
+
+int IKSeedIndex::nearest(const HTransform3D<double>& pose, int k, Q* result) const
+{
+	k = std::min(std::min(k, maxNeighbours), _size);
+	if (k <= 0)
+		return 0;
+	float key[keySize];
+	keyOf(pose, key);
+	Candidate best[maxNeighbours];
+	int found = 0;
+	search(key, 0, _size, k, best, found);
+	for (int i=0; i<found; i++)
+	{
+		result[i] = Q::zero(_dof);
+		for (int j=0; j<_dof; j++)
+			result[i](j) = _q[best[i].index*_dof + j];
+	}
+	return found;
+}
+
+bool IKSeedIndex::nearest(const HTransform3D<double>& pose, Q& result) const
+{
+	return nearest(pose, 1, &result) == 1;
+}
+
+Q IKSeedIndex::sample(int index) const
+{
+	if (index < 0 || index >= _size)
+		throw ("错误<IKSeedIndex>: 下标超出范围!");
+	Q q = Q::zero(_dof);
+	for (int j=0; j<_dof; j++)
+		q(j) = _q[index*_dof + j];
+	return q;
+}
+
+double IKSeedIndex::distance(const HTransform3D<double>& a, const HTransform3D<double>& b) const
+{
+	float ka[keySize], kb[keySize];
+	keyOf(a, ka);
+	keyOf(b, kb);
+	double distance = 0;
+	for (int d=0; d<keySize; d++)
+		distance += (ka[d] - kb[d])*(ka[d] - kb[d]);
+	return sqrt(distance);
+}
+
+void IKSeedIndex::save(const std::string& fileName) const
+{
+	FILE* file = fopen(fileName.c_str(), "wb");
+	if (file == NULL)
+		throw (std::string("错误<IKSeedIndex>: 无法写入文件") + fileName);
+	FileHeader header;
+	memset(&header, 0, sizeof(header));
+	memcpy(header.magic, magic, sizeof(magic));
+	header.version = version;
+	header.dof = _dof;
+	header.modelHash = _modelHash;
+	header.size = _size;
+	header.keySize = keySize;
+	header.orientationWeight = _orientationWeight;
+	const bool success = fwrite(&header, sizeof(header), 1, file) == 1
+			&& fwrite(_split.data(), sizeof(unsigned char), _size, file) == (size_t)_size
+			&& fwrite(_keys.data(), sizeof(float), _keys.size(), file) == _keys.size()
+			&& fwrite(_q.data(), sizeof(double), _q.size(), file) == _q.size();
+	if (fclose(file) != 0 || !success)
+		throw (std::string("错误<IKSeedIndex>: 无法写入文件") + fileName);
+}
+
+IKSeedIndex::ptr IKSeedIndex::load(const std::string& fileName, const SerialLink& robot)
+{
+	FILE* file = fopen(fileName.c_str(), "rb");
+	if (file == NULL)
+		throw (std::string("错误<IKSeedIndex>: 无法打开文件") + fileName);
+	FileHeader header;
+	if (fread(&header, sizeof(header), 1, file) != 1 || memcmp(header.magic, magic, sizeof(magic)) != 0
+			|| header.version != version || header.keySize != keySize || header.size <= 0)
+	{
+		fclose(file);
+		throw (std::string("错误<IKSeedIndex>: 不是逆解初值索引文件或版本不同: ") + fileName);
+	}
+	if (header.modelHash != ReachabilityMap::modelHash(robot) || (int)header.dof != robot.getDOF())
+	{
+		fclose(file);
+		throw (std::string("错误<IKSeedIndex>: 索引文件与机器人模型不符: ") + fileName);
+	}
+	ptr result(new IKSeedIndex());
+	result->_size = header.size;
+	result->_dof = header.dof;
+	result->_orientationWeight = header.orientationWeight;
+	result->_modelHash = header.modelHash;
+	result->_split.resize(header.size);
+	result->_keys.resize(header.size*keySize);
+	result->_q.resize(header.size*header.dof);
+	const bool success = fread(result->_split.data(), sizeof(unsigned char), header.size, file) == (size_t)header.size
+			&& fread(result->_keys.data(), sizeof(float), result->_keys.size(), file) == result->_keys.size()
+			&& fread(result->_q.data(), sizeof(double), result->_q.size(), file) == result->_q.size();
+	fclose(file);
+	if (!success)
+		throw (std::string("错误<IKSeedIndex>: 文件不完整: ") + fileName);
+	return result;
+}
+
+IKSeedIndex::~IKSeedIndex()
+{
+}
+
+} /* namespace ik */
+} /* namespace robot */
@@ -0,0 +1,159 @@
+/**
+ * @brief IKSeedIndex类
+ * @date Oct 16, 2026
+ * @author a1994846931931
+ */
+
+#ifndef IKSEEDINDEX_H_
+#define IKSEEDINDEX_H_
+
+# include "../math/Q.h"
+# include "../math/HTransform3D.h"
+# include "../model/SerialLink.h"
+# include "../common/ThreadPool.h"
+# include <stdint.h>
+# include <vector>
+# include <string>
+# include <memory>
+
+namespace robot {
+namespace ik {
+
+/** @addtogroup ik
+ * @{
+ */
+
+/**
+ * @brief 逆解初值索引: 按末端位姿查找最接近的已知关节角
+ *
+ * 在关节范围内(超过一圈的关节限制在-180~180)伪随机采样count组关节角, 正运动学得到末端位姿,
+ * 把(位姿, 关节角)保存在k-d树中. 对任意的目标位姿(例如视觉给出的抓取位姿, 没有相近的当前关节角),
+ * nearest给出末端位姿最接近的若干组关节角, 作为数值逆解的初值.
+ *
+ * 位姿之间的距离为
+ * @f$ d^2 = |\Delta\mathbf{p}|^2 + w^2(|\Delta\mathbf{x}|^2 + |\Delta\mathbf{z}|^2) @f$,
+ * 其中@f$ \mathbf{x}, \mathbf{z} @f$为姿态矩阵的第一列和第三列, w为orientationWeight(m).
+ * 姿态部分没有四元数的正负号问题, 小角度时为旋转角平方的1~2倍(与转轴方向有关).
+ *
+ * k-d树不保存指针: 节点按中位数分割后原地排列(每个区间的中点为节点, 左右两半为子树),
+ * 8个以下的区间直接线性查找. 键值为float, 查询不申请内存.
+ *
+ * 可以用save保存, load加载(文件中保存了机器人模型的散列值, 与模型不符时抛出异常).
+ *
+ * @code
+ * IKSeedIndex::ptr index(new IKSeedIndex(robot, 100000));
+ * numericSolver->setSeedIndex(index);
+ * @endcode
+ */
+class IKSeedIndex {
+public:
+	using ptr = std::shared_ptr<IKSeedIndex>;
+
+	/** @brief 键的维数: 位置3个, 姿态6个 */
+	static const int keySize = 9;
+
+	/** @brief 一次查询最多返回的个数 */
+	static const int maxNeighbours = 16;
+
+	/**
+	 * @brief 采样并建立索引
+	 * @param robot [in] 机器人模型
+	 * @param count [in] 采样个数
+	 * @param orientationWeight [in] 姿态误差的权重(m)
+	 * @param seed [in] 伪随机数种子, 相同的种子得到相同的索引
+	 * @param policy [in] 正运动学的执行策略
+	 */
+	IKSeedIndex(robot::model::SerialLink::ptr robot, int count, double orientationWeight=0.2, unsigned int seed=1,
+			const robot::common::ExecPolicy& policy=robot::common::ExecPolicy());
+
+	/**
+	 * @brief 从文件加载
+	 * @param fileName [in] 文件名
+	 * @param robot [in] 机器人模型, 与文件中的散列值不符时抛出异常
+	 */
+	static ptr load(const std::string& fileName, const robot::model::SerialLink& robot);
+
+	/**
+	 * @brief 保存到文件, 无法写入时抛出异常
+	 */
+	void save(const std::string& fileName) const;
+
+	/**
+	 * @brief 查找末端位姿最接近的k组关节角
+	 * @param pose [in] 目标位姿
+	 * @param k [in] 个数, 最多maxNeighbours个
+	 * @param result [out] 按距离从小到大排列, 至少能保存k个
+	 * @return 找到的个数
+	 */
+	int nearest(const HTransform3D<double>& pose, int k, robot::math::Q* result) const;
+
+	/**
+	 * @brief 查找末端位姿最接近的关节角
+	 * @retval false 索引为空
+	 */
+	bool nearest(const HTransform3D<double>& pose, robot::math::Q& result) const;
+
+	/**
+	 * @brief 第index个采样的关节角(按索引内部的顺序)
+	 */
+	robot::math::Q sample(int index) const;
+
+	/** @brief 采样个数 */
+	inline int size() const
+	{
+		return _size;
+	}
+
+	/** @brief 姿态误差的权重(m) */
+	inline double orientationWeight() const
+	{
+		return _orientationWeight;
+	}
+
+	/**
+	 * @brief 两个位姿之间的距离(与索引使用的相同)
+	 */
+	double distance(const HTransform3D<double>& a, const HTransform3D<double>& b) const;
+
+	virtual ~IKSeedIndex();
+private:
+	IKSeedIndex();
+
+	/** @brief 查询时的候选 */
+	struct Candidate {
+		float distance;
+		int index;
+	};
+
+	/** @brief 位姿的键 */
+	void keyOf(const HTransform3D<double>& pose, float* key) const;
+
+	/** @brief 在order的[lo, hi)上递归地按中位数分割 */
+	void split(std::vector<int>& order, int lo, int hi);
+
+	/** @brief 在[lo, hi)的子树中查找 */
+	void search(const float* key, int lo, int hi, int k, Candidate* best, int& found) const;
+private:
+	/** @brief 区间不超过该长度时线性查找 */
+	static const int leafSize = 8;
+
+	int _size;
+	int _dof;
+	double _orientationWeight;
+	uint64_t _modelHash;
+
+	/** @brief 按树的顺序排列的键, 每个keySize个 */
+	std::vector<float> _keys;
+
+	/** @brief 按树的顺序排列的关节角, 每个_dof个 */
+	std::vector<double> _q;
+
+	/** @brief 节点的分割维度(只有区间的中点有意义) */
+	std::vector<unsigned char> _split;
+};
+
+/** @} */
+} /* namespace ik */
+} /* namespace robot */
+
+#endif /* IKSEEDINDEX_H_ */
@@ -0,0 +1,101 @@
+/*
+ * IKSolutionSet.cpp
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: a1994846931931
+ */
+
+# include "IKSolutionSet.h"
+# include <math.h>
+
+using robot::math::Q;
+using robot::model::SerialLink;
+using robot::model::JointTrig;
+
+namespace robot {
+namespace ik {
+
+IKSolutionSet::IKSolutionSet() :
+		_baseSize(0),
+		_size(0)
+{
+}
+
+void IKSolutionSet::clear()
+{
+	_baseSize = 0;
+	_size = 0;
+}
+
+bool IKSolutionSet::add(const Q& q, const SerialLink& robot)
+{
+	if (_baseSize >= capacity || q.size() > JointTrig::maxDOF)
+		return false;
+	int count = 1;
+	for (int i=0; i<q.size(); i++)
+	{
+		const double original = q[i];
+		const robot::model::Link::ptr link = robot.getLink(i);
+		const int kmin = (int)ceil((link->lmin() - original)/(2*M_PI));
+		const int kmax = (int)floor((link->lmax() - original)/(2*M_PI));
+		if (kmin > kmax)
+			return false;
+		_kmin[_baseSize][i] = kmin;
+		_kcount[_baseSize][i] = kmax - kmin + 1;
+		_kfirst[_baseSize][i] = (kmin > 0) ? kmin : ((kmax < 0) ? kmax : 0);
+		count *= kmax - kmin + 1;
+	}
+	_base[_baseSize] = q;
+	_count[_baseSize] = count;
+	_baseSize++;
+	_size += count;
+	return true;
+}
+
+const Q& IKSolutionSet::base(int index) const
+{
+	if (index < 0 || index >= _baseSize)
+		throw("错误<IKSolutionSet>: 索引超出范围!");
+	return _base[index];
+}
+
+void IKSolutionSet::get(int index, Q& q) const
+{
+	if (index < 0 || index >= _size)
+		throw("错误<IKSolutionSet>: 索引超出范围!");
+	int b = 0;
+	while (index >= _count[b])
+		index -= _count[b++];
+	q = _base[b];
+	// 按关节逐位解码, 每一位的0对应最接近0的圈数, 其余按从小到大排列
+	for (int i=0; i<q.size(); i++)
+	{
+		const int count = _kcount[b][i];
+		const int digit = index%count;
+		index /= count;
+		const int first = _kfirst[b][i] - _kmin[b][i];
+		const int offset = (digit == 0) ? first : ((digit - 1 < first) ? (digit - 1) : digit);
+		q(i) += 2*M_PI*(_kmin[b][i] + offset);
+	}
+}
+
+Q IKSolutionSet::operator[](int index) const
+{
+	Q q;
+	get(index, q);
+	return q;
+}
+
+void IKSolutionSet::toVector(std::vector<Q>& result) const
+{
+	result.resize(_size);
+	for (int i=0; i<_size; i++)
+		get(i, result[i]);
+}
+
+IKSolutionSet::~IKSolutionSet()
+{
+}
+
+} /* namespace ik */
+} /* namespace robot */
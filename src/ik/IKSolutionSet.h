@@ -0,0 +1,136 @@
+/**
+ * @brief IKSolutionSet类
+ * @date Oct 16, 2026
+ * @author a1994846931931
+ */
+
+#ifndef IKSOLUTIONSET_H_
+#define IKSOLUTIONSET_H_
+
+# include "../math/Q.h"
+# include "../model/SerialLink.h"
+# include "../model/JointTrig.h"
+# include <vector>
+
+namespace robot {
+namespace ik {
+
+/**
+ * @addtogroup ik
+ * @{
+ */
+
+/**
+ * @brief 逆解的结果状态, 由IKSolver::solveInto返回
+ */
+enum IKStatus{
+	ikSuccess = 0, /**< 至少有一个关节范围内的解 */
+	ikNoSolution, /**< 末端位姿不可达(或者不满足Config) */
+	ikOutOfRange /**< 有解, 但都不在关节范围内 */
+};
+
+/**
+ * @brief 逆解结果的集合, 不申请内存
+ *
+ * 逆解器只保存-180~180范围内的基本解(最多capacity个). 关节范围超过一圈时, 一个基本解的
+ * 各关节加减@f$ 2\pi @f$得到的所有组合也是解, 这些组合不预先生成, 而是只记录每个关节可用的
+ * 圈数范围, 在get或operator[]访问时才计算出来. 每个基本解的组合中, 不加减@f$ 2\pi @f$
+ * (或最接近的)排在最前面.
+ *
+ * 同一个集合可以反复用于逆解(solveInto会先clear), 适合在插补的每一个点上使用.
+ */
+class IKSolutionSet {
+public:
+	/** @brief 最多保存的基本解个数 */
+	static const int capacity = 8;
+
+	IKSolutionSet();
+
+	/**
+	 * @brief 清空
+	 */
+	void clear();
+
+	/**
+	 * @brief 添加一个基本解
+	 * @param q [in] 基本解
+	 * @param robot [in] 机器人模型, 提供关节范围
+	 * @retval true 已添加
+	 * @retval false 加减@f$ 2\pi @f$后也不在关节范围内, 或者集合已满
+	 */
+	bool add(const robot::math::Q& q, const robot::model::SerialLink& robot);
+
+	/**
+	 * @brief 解的总个数(包括加减@f$ 2\pi @f$的组合)
+	 */
+	inline int size() const
+	{
+		return _size;
+	}
+
+	/**
+	 * @brief 是否没有解
+	 */
+	inline bool empty() const
+	{
+		return _size == 0;
+	}
+
+	/**
+	 * @brief 基本解的个数
+	 */
+	inline int baseSize() const
+	{
+		return _baseSize;
+	}
+
+	/**
+	 * @brief 基本解
+	 * @param index [in] 索引, 0~baseSize()-1
+	 */
+	const robot::math::Q& base(int index) const;
+
+	/**
+	 * @brief 获取一个解
+	 * @param index [in] 索引, 0~size()-1
+	 * @param q [out] 解
+	 */
+	void get(int index, robot::math::Q& q) const;
+
+	/**
+	 * @brief 获取一个解, 参见get
+	 */
+	robot::math::Q operator[](int index) const;
+
+	/**
+	 * @brief 以std::vector的形式输出全部的解(会申请内存)
+	 * @param result [out] 全部的解
+	 */
+	void toVector(std::vector<robot::math::Q>& result) const;
+
+	virtual ~IKSolutionSet();
+private:
+	/** @brief 基本解 */
+	robot::math::Q _base[capacity];
+
+	/** @brief 每个关节最小的圈数 */
+	int _kmin[capacity][robot::model::JointTrig::maxDOF];
+
+	/** @brief 每个关节可用的圈数个数 */
+	int _kcount[capacity][robot::model::JointTrig::maxDOF];
+
+	/** @brief 每个关节排在最前面的圈数(最接近0) */
+	int _kfirst[capacity][robot::model::JointTrig::maxDOF];
+
+	/** @brief 每个基本解的组合个数 */
+	int _count[capacity];
+
+	int _baseSize;
+	int _size;
+};
+
+/** @} */
+} /* namespace ik */
+} /* namespace robot */
+
+#endif /* IKSOLUTIONSET_H_ */
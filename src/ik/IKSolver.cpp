@@ -6,10 +6,100 @@
  */
 
 #include "IKSolver.h"
+# include "../common/common.h"
 
 namespace robot {
 namespace ik {
 
+IKStatus IKSolver::solveInto(const HTransform3D<>& baseTend, const model::Config& config, IKSolutionSet& result) const
+{
+	result.clear();
+	std::vector<Q> solutions;
+	try
+	{
+		solutions = solve(baseTend, config);
+	}
+	catch (char const*)
+	{
+		return ikNoSolution;
+	}
+	catch (std::string&)
+	{
+		return ikNoSolution;
+	}
+	if (solutions.empty())
+		return ikNoSolution;
+	// solve的结果可能已经包含加减2pi的组合, 这里化为-180~180后去重, 按基本解保存
+	robot::model::SerialLink::ptr robot = getRobot();
+	for (int i=0; i<(int)solutions.size(); i++)
+	{
+		Q q = solutions[i];
+		for (int k=0; k<q.size(); k++)
+			q(k) = common::fixAngle(q[k]);
+		bool repeated = false;
+		for (int b=0; b<result.baseSize() && !repeated; b++)
+			repeated = (result.base(b) == q);
+		if (!repeated)
+			result.add(q, *robot);
+	}
+	return result.empty() ? ikOutOfRange : ikSuccess;
+}
+
+IKStatus IKSolver::solveNearest(const HTransform3D<>& baseTend, const model::Config& config, const Q& qPrev, Q& result) const
+{
+	IKSolutionSet solutions;
+	IKStatus status = solveInto(baseTend, config, solutions);
+	if (status != ikSuccess)
+		return status;
+	robot::model::SerialLink::ptr robot = getRobot();
+	// qPrev与result可以是同一个对象, 选出后再赋值
+	Q best;
+	double distance = -1;
+	for (int i=0; i<solutions.baseSize(); i++)
+	{
+		Q q = solutions.base(i);
+		if (!nearestWrap(q, qPrev, *robot))
+			continue;
+		const double d = Q::distance(q, qPrev, q.size());
+		if (distance < 0 || d < distance)
+		{
+			distance = d;
+			best = q;
+		}
+	}
+	if (distance < 0)
+		return ikOutOfRange;
+	result = best;
+	return ikSuccess;
+}
+
+void IKSolver::solveBatch(const robot::math::TransformBatch& baseTend, const model::Config& config, Q* result, IKStatus* status) const
+{
+	IKSolutionSet solutions;
+	for (int i=0; i<baseTend.size(); i++)
+	{
+		status[i] = solveInto(baseTend.get(i), config, solutions);
+		if (status[i] == ikSuccess)
+			solutions.get(0, result[i]);
+	}
+}
+
+bool IKSolver::nearestWrap(Q& q, const Q& reference, const robot::model::SerialLink& robot)
+{
+	for (int i=0; i<q.size(); i++)
+	{
+		const robot::model::Link::ptr link = robot.getLink(i);
+		const int kmin = (int)ceil((link->lmin() - q[i])/(2*M_PI));
+		const int kmax = (int)floor((link->lmax() - q[i])/(2*M_PI));
+		if (kmin > kmax)
+			return false;
+		int k = (int)floor((reference[i] - q[i])/(2*M_PI) + 0.5);
+		k = (k < kmin) ? kmin : ((k > kmax) ? kmax : k);
+		q(i) += 2*M_PI*k;
+	}
+	return true;
+}
+
 IKSolver::~IKSolver() {
 	// TODO Auto-generated destructor stub
 }
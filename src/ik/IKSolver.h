@@ -10,8 +10,10 @@
 
 # include "../math/Q.h"
 # include "../math/HTransform3D.h"
+# include "../math/TransformBatch.h"
 # include "../model/Config.h"
 # include "../model/SerialLink.h"
+# include "IKSolutionSet.h"
 
 using namespace robot::math;
 
@@ -31,10 +33,54 @@ public:
 	using ptr = std::shared_ptr<IKSolver>;
 	IKSolver() {}
 	virtual std::vector<Q> solve(const HTransform3D<>& baseTend, const model::Config& config) const = 0;
+
+	/**
+	 * @brief 逆运动学求解, 结果写入调用者提供的集合, 不抛出异常
+	 * @param baseTend [in] 基坐标系到末端执行器的变换矩阵
+	 * @param config [in] 逆解的Config参数
+	 * @param result [out] 逆解结果(先清空)
+	 * @return 结果状态
+	 *
+	 * 默认实现调用solve并转换结果, 逆解器可以重新实现以避免申请内存和抛出异常.
+	 */
+	virtual IKStatus solveInto(const HTransform3D<>& baseTend, const model::Config& config, IKSolutionSet& result) const;
+
+	/**
+	 * @brief 求解最接近qPrev的一个解, 用于连续轨迹的逐点逆解
+	 * @param baseTend [in] 基坐标系到末端执行器的变换矩阵
+	 * @param config [in] 逆解的Config参数
+	 * @param qPrev [in] 参考关节角(一般为轨迹上的前一个点)
+	 * @param result [out] 解, 每个关节加减2pi后取关节范围内最接近qPrev的值(可以与qPrev是同一个对象)
+	 * @return 结果状态
+	 *
+	 * 默认实现在solveInto的全部基本解中选取, 逆解器可以重新实现为只计算一个分支.
+	 */
+	virtual IKStatus solveNearest(const HTransform3D<>& baseTend, const model::Config& config, const Q& qPrev, Q& result) const;
+
+	/**
+	 * @brief 批量逆解, 每个位姿取solveInto的第一个解
+	 * @param baseTend [in] 结构数组形式的一组末端位姿
+	 * @param config [in] 逆解的Config参数
+	 * @param result [out] baseTend.size()个解, 状态不是ikSuccess的不修改
+	 * @param status [out] baseTend.size()个结果状态
+	 *
+	 * 默认实现逐个调用solveInto, 没有解的位姿只标记状态, 不抛出异常.
+	 */
+	virtual void solveBatch(const robot::math::TransformBatch& baseTend, const model::Config& config, Q* result, IKStatus* status) const;
 	virtual robot::model::Config getConfig(const robot::math::Q& q) const = 0;
-	virtual robot::model::SerialLink::ptr getRobot() = 0;
+	virtual robot::model::SerialLink::ptr getRobot() const = 0;
 	virtual int singularJudge(const robot::math::Q& q) const = 0;
 	virtual ~IKSolver();
+public:
+	/**
+	 * @brief 每个关节加减2pi, 取关节范围内最接近reference的值
+	 * @param q [in/out] 关节角
+	 * @param reference [in] 参考关节角
+	 * @param robot [in] 机器人模型, 提供关节范围
+	 * @retval true 成功
+	 * @retval false 有关节加减2pi后也不在范围内(q不完整)
+	 */
+	static bool nearestWrap(Q& q, const Q& reference, const robot::model::SerialLink& robot);
 };
 
 /**@}*/
@@ -0,0 +1,281 @@
+/*
+ * NumericIKSolver.cpp
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: a1994846931931
+ */
+
+# include "NumericIKSolver.h"
+# include "../model/FixedJacobian.h"
+# include "../model/JointTrig.h"
+# include "../common/common.h"
+# include <math.h>
+
+using robot::math::Q;
+using robot::model::SerialLink;
+using robot::model::Config;
+using robot::model::JointTrig;
+using robot::model::FixedJacobian;
+
+namespace robot {
+namespace ik {
+
+namespace {
+
+double squaredNorm(const Q& e)
+{
+	double sum = 0;
+	for (int i=0; i<e.size(); i++)
+		sum += e[i]*e[i];
+	return sum;
+}
+
+}
+
+NumericIKSolver::NumericIKSolver(SerialLink::ptr serialRobot, int maxIterations, unsigned long long timeBudget) :
+		_serialLink(serialRobot),
+		_qMin(serialRobot->getJointMin()),
+		_qMax(serialRobot->getJointMax()),
+		_maxIterations(maxIterations),
+		_timeBudget(timeBudget),
+		_tolerance(1e-10),
+		_restarts(8),
+		_indexSeeds(0),
+		_random(12345),
+		_iterations(0)
+{
+	if (serialRobot->getDOF() != 6)
+		throw("错误<NumericIKSolver>: 只适用于6轴机器人!");
+}
+
+std::vector<Q> NumericIKSolver::solve(const HTransform3D<>& baseTend, const Config& config) const
+{
+	IKSolutionSet solutions;
+	if (solveInto(baseTend, config, solutions) != ikSuccess)
+		throw (std::string("错误<NumericIKSolver>: 迭代不收敛, 没有解!"));
+	std::vector<Q> result;
+	solutions.toVector(result);
+	return result;
+}
+
+IKStatus NumericIKSolver::solveInto(const HTransform3D<>& baseTend, const Config&, IKSolutionSet& result) const
+{
+	result.clear();
+	_iterations = 0;
+	const unsigned long long deadline = (_timeBudget > 0) ? common::getUTime() + _timeBudget : 0;
+	Q q;
+	Q indexSeeds[IKSeedIndex::maxNeighbours];
+	const int indexCount = (_seedIndex.get() == NULL) ? 0 : _seedIndex->nearest(baseTend, _indexSeeds, indexSeeds);
+	// 初值依次为: 索引中最接近的关节角, 上一次的解, 机器人当前的关节角, 伪随机关节角
+	for (int attempt=-indexCount; attempt<_restarts + 2; attempt++)
+	{
+		if (attempt < 0)
+			q = indexSeeds[indexCount + attempt];
+		else if (attempt == 0)
+		{
+			if (_seed.size() != 6)
+				continue;
+			q = _seed;
+		}
+		else if (attempt == 1)
+			q = _serialLink->getQ();
+		else
+			randomSeed(q);
+		clamp(q);
+		if (iterate(baseTend, q, deadline))
+		{
+			_seed = q;
+			for (int i=0; i<q.size(); i++)
+				q(i) = common::fixAngle(q[i]);
+			result.add(q, *_serialLink);
+			return ikSuccess;
+		}
+		if (deadline > 0 && common::getUTime() > deadline)
+			break;
+	}
+	return ikNoSolution;
+}
+
+IKStatus NumericIKSolver::solveNearest(const HTransform3D<>& baseTend, const Config&, const Q& qPrev, Q& result) const
+{
+	_iterations = 0;
+	const unsigned long long deadline = (_timeBudget > 0) ? common::getUTime() + _timeBudget : 0;
+	Q q = qPrev;
+	clamp(q);
+	if (!iterate(baseTend, q, deadline))
+		return ikNoSolution;
+	_seed = q;
+	result = q;
+	return ikSuccess;
+}
+
+bool NumericIKSolver::iterate(const HTransform3D<>& target, Q& q, unsigned long long deadline) const
+{
+	FixedJacobian<6, 6> J;
+	FixedJacobian<6, 6>::Workspace ws;
+	Q e = Q::zero(6), eTry = Q::zero(6), dq = Q::zero(6), qTry = q;
+	JointTrig trig = _serialLink->getJointTrig(q);
+	double err = error(target, _serialLink->getEndTransform(trig), e);
+	double norm = squaredNorm(e);
+	double lambda = 1e-2;
+	for (int i=0; i<_maxIterations; i++)
+	{
+		if (err < _tolerance)
+			return true;
+		if (deadline > 0 && common::getUTime() > deadline)
+			return false;
+		_iterations++;
+		_serialLink->getJacobian(trig, J);
+		try
+		{
+			J.solveDLS(e, lambda, dq, ws);
+		}
+		catch (char const*)
+		{
+			lambda *= 10;
+			continue;
+		}
+		for (int k=0; k<6; k++)
+			qTry(k) = q[k] + dq[k];
+		clamp(qTry);
+		const JointTrig trigTry = _serialLink->getJointTrig(qTry);
+		const double errTry = error(target, _serialLink->getEndTransform(trigTry), eTry);
+		const double normTry = squaredNorm(eTry);
+		if (normTry < norm)
+		{
+			// 误差减小, 接受这一步, 向Gauss-Newton靠近
+			q = qTry;
+			trig = trigTry;
+			e = eTry;
+			err = errTry;
+			norm = normTry;
+			lambda = (lambda > 1e-5) ? lambda*0.1 : 1e-6;
+		}
+		else
+		{
+			// 误差增大, 向梯度下降靠近; 阻尼已经很大时认为陷入了局部极小(或者被关节范围挡住)
+			lambda *= 10;
+			if (lambda > 1e6)
+				return false;
+		}
+	}
+	return err < _tolerance;
+}
+
+double NumericIKSolver::error(const HTransform3D<>& target, const HTransform3D<>& current, Q& e)
+{
+	double positionError = 0;
+	for (int i=0; i<3; i++)
+	{
+		e(i) = target(i, 3) - current(i, 3);
+		positionError += e[i]*e[i];
+	}
+	// 姿态误差: target*current^T的旋转向量
+	double R[3][3];
+	for (int r=0; r<3; r++)
+		for (int c=0; c<3; c++)
+			R[r][c] = target(r, 0)*current(c, 0) + target(r, 1)*current(c, 1) + target(r, 2)*current(c, 2);
+	double w[3] = {0.5*(R[2][1] - R[1][2]), 0.5*(R[0][2] - R[2][0]), 0.5*(R[1][0] - R[0][1])};
+	const double s = sqrt(w[0]*w[0] + w[1]*w[1] + w[2]*w[2]);
+	const double c = 0.5*(R[0][0] + R[1][1] + R[2][2] - 1);
+	const double theta = atan2(s, c);
+	if (s > 1e-12)
+	{
+		for (int i=0; i<3; i++)
+			e(3 + i) = w[i]*theta/s;
+	}
+	else if (c > 0)
+	{
+		for (int i=0; i<3; i++)
+			e(3 + i) = w[i];
+	}
+	else
+	{
+		// 转角为pi, 转轴由对角线求出
+		int k = 0;
+		for (int i=1; i<3; i++)
+			if (R[i][i] > R[k][k])
+				k = i;
+		const double axisK = sqrt((R[k][k] + 1)*0.5);
+		for (int i=0; i<3; i++)
+			e(3 + i) = M_PI*((i == k) ? axisK : 0.5*(R[i][k] + R[k][i])/(2*axisK));
+	}
+	positionError = sqrt(positionError);
+	return (positionError > theta) ? positionError : theta;
+}
+
+void NumericIKSolver::clamp(Q& q) const
+{
+	for (int i=0; i<6; i++)
+		q(i) = (q[i] < _qMin[i]) ? _qMin[i] : ((q[i] > _qMax[i]) ? _qMax[i] : q[i]);
+}
+
+void NumericIKSolver::randomSeed(Q& q) const
+{
+	if (q.size() != 6)
+		q = Q::zero(6);
+	for (int i=0; i<6; i++)
+	{
+		_random = _random*1103515245u + 12345u;
+		const double ratio = ((_random >> 8) & 0xffff)/65535.0;
+		// 关节范围超过一圈时只在-pi~pi中取值
+		const double lower = (_qMin[i] > -M_PI) ? _qMin[i] : -M_PI;
+		const double upper = (_qMax[i] < M_PI) ? _qMax[i] : M_PI;
+		q(i) = lower + (upper - lower)*ratio;
+	}
+}
+
+Config NumericIKSolver::getConfig(const Q&) const
+{
+	return Config(Config::sfree, Config::efree, Config::wfree);
+}
+
+SerialLink::ptr NumericIKSolver::getRobot() const
+{
+	return _serialLink;
+}
+
+int NumericIKSolver::singularJudge(const Q& q) const
+{
+	FixedJacobian<6, 6> J;
+	_serialLink->getJacobian(_serialLink->getJointTrig(q), J);
+	return (fabs(J.matrix().determinant()) < 1e-6) ? 1 : 0;
+}
+
+void NumericIKSolver::setMaxIterations(int maxIterations)
+{
+	_maxIterations = maxIterations;
+}
+
+void NumericIKSolver::setTimeBudget(unsigned long long timeBudget)
+{
+	_timeBudget = timeBudget;
+}
+
+void NumericIKSolver::setTolerance(double tolerance)
+{
+	_tolerance = tolerance;
+}
+
+void NumericIKSolver::setRestarts(int restarts)
+{
+	_restarts = restarts;
+}
+
+void NumericIKSolver::setSeedIndex(IKSeedIndex::ptr index, int seeds)
+{
+	_seedIndex = index;
+	_indexSeeds = (seeds < IKSeedIndex::maxNeighbours) ? seeds : IKSeedIndex::maxNeighbours;
+}
+
+int NumericIKSolver::getLastIterations() const
+{
+	return _iterations;
+}
+
+NumericIKSolver::~NumericIKSolver()
+{
+}
+
+} /* namespace ik */
+} /* namespace robot */
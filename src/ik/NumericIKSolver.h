@@ -0,0 +1,176 @@
+/**
+ * @brief NumericIKSolver类
+ * @date Oct 16, 2026
+ * @author a1994846931931
+ */
+
+#ifndef NUMERICIKSOLVER_H_
+#define NUMERICIKSOLVER_H_
+
+# include "../math/Q.h"
+# include "../math/HTransform3D.h"
+# include "../model/SerialLink.h"
+# include "../model/Config.h"
+# include "IKSolver.h"
+# include "IKSeedIndex.h"
+
+namespace robot {
+namespace ik {
+
+/** @addtogroup ik
+ * @{
+ */
+
+/**
+ * @brief 数值逆解器, 用Levenberg-Marquardt(阻尼最小二乘)迭代求解
+ *
+ * 不要求机器人满足特定的构型, 只使用SerialLink::getEndTransform和SerialLink::getJacobian(包括tool).
+ * 每次迭代求解@f$ \Delta\mathbf{q} = \mathbf{J}^T(\mathbf{J}\mathbf{J}^T + \lambda^2\mathbf{I})^{-1}\mathbf{e} @f$,
+ * 其中@f$ \mathbf{e} @f$为末端的位置误差与姿态误差(旋转向量, 基坐标系下). 误差减小时接受并减小
+ * @f$ \lambda @f$, 否则增大@f$ \lambda @f$重新计算. 每一步之后关节角限制在关节范围内.
+ *
+ * 数值解只有一个, 分支由初值决定, 因此Config参数不起作用(getConfig总是返回{sfree, efree, wfree}):
+ * - solveNearest以qPrev为初值, 适合连续轨迹的逐点逆解(ikInterpolator, LinePlanner, CircularPlanner等);
+ * - solve和solveInto依次以上一次的解, 机器人当前关节角, 以及关节范围内的若干个伪随机关节角为初值.
+ *   设置了IKSeedIndex(setSeedIndex)时, 先以索引中末端位姿最接近目标的若干组关节角为初值,
+ *   适合与上一次的解没有关系的目标(例如视觉给出的位姿).
+ *
+ * 迭代次数和时间都有上限(setMaxIterations, setTimeBudget), 超过时返回ikNoSolution.
+ * 迭代过程不申请内存(仅限6轴).
+ *
+ * @warning 保存了上一次的解作为下一次的初值, 同一个逆解器不能在多个线程中同时使用.
+ */
+class NumericIKSolver: public IKSolver {
+public:
+	using ptr = std::shared_ptr<NumericIKSolver>;
+
+	/**
+	 * @brief 构造数值逆解器
+	 * @param serialRobot [in] 机器人模型, 必须为6轴
+	 * @param maxIterations [in] 每个初值的最大迭代次数
+	 * @param timeBudget [in] 一次逆解的最长时间(us), 0表示不限制
+	 */
+	NumericIKSolver(robot::model::SerialLink::ptr serialRobot, int maxIterations=100, unsigned long long timeBudget=0);
+
+	/**
+	 * @brief 逆运动学求解
+	 * @param baseTend [in] 基坐标系到末端执行器的变换矩阵
+	 * @param config [in] 不起作用
+	 * @return 关节范围内的全部解(一个数值解加减2pi的组合). 没有解时抛出异常
+	 */
+	std::vector<Q> solve(const HTransform3D<>& baseTend, const model::Config& config) const;
+
+	/**
+	 * @brief 逆运动学求解, 不申请内存, 不抛出异常
+	 * @param baseTend [in] 基坐标系到末端执行器的变换矩阵
+	 * @param config [in] 不起作用
+	 * @param result [out] 逆解结果(先清空), 只有一个基本解
+	 * @return 结果状态, 不收敛时为ikNoSolution
+	 */
+	IKStatus solveInto(const HTransform3D<>& baseTend, const model::Config& config, IKSolutionSet& result) const;
+
+	/**
+	 * @brief 以qPrev为初值迭代求解
+	 * @param baseTend [in] 基坐标系到末端执行器的变换矩阵
+	 * @param config [in] 不起作用
+	 * @param qPrev [in] 初值(一般为轨迹上的前一个点)
+	 * @param result [out] 解(可以与qPrev是同一个对象)
+	 * @return 结果状态
+	 *
+	 * 不使用其它初值, 因此不会跳到其它分支.
+	 */
+	IKStatus solveNearest(const HTransform3D<>& baseTend, const model::Config& config, const Q& qPrev, Q& result) const;
+
+	/**
+	 * @brief 总是返回{sfree, efree, wfree}
+	 */
+	robot::model::Config getConfig(const robot::math::Q& q) const;
+
+	robot::model::SerialLink::ptr getRobot() const;
+
+	/**
+	 * @brief 奇异判断
+	 * @retval 1 雅克比矩阵行列式的绝对值小于1e-6
+	 * @retval 0 不奇异
+	 */
+	int singularJudge(const robot::math::Q& q) const;
+
+	/** @brief 设置每个初值的最大迭代次数 */
+	void setMaxIterations(int maxIterations);
+
+	/** @brief 设置一次逆解的最长时间(us), 0表示不限制 */
+	void setTimeBudget(unsigned long long timeBudget);
+
+	/** @brief 设置收敛的误差(位置m, 姿态rad) */
+	void setTolerance(double tolerance);
+
+	/** @brief 设置solve和solveInto中伪随机初值的个数 */
+	void setRestarts(int restarts);
+
+	/**
+	 * @brief 设置solve和solveInto的初值索引
+	 * @param index [in] 初值索引, 为NULL时不使用
+	 * @param seeds [in] 从索引中取的初值个数, 最多IKSeedIndex::maxNeighbours个
+	 */
+	void setSeedIndex(IKSeedIndex::ptr index, int seeds=4);
+
+	/**
+	 * @brief 上一次逆解的迭代次数(所有初值的总和)
+	 */
+	int getLastIterations() const;
+
+	virtual ~NumericIKSolver();
+private:
+	/**
+	 * @brief 从q开始迭代
+	 * @param target [in] 目标位姿
+	 * @param q [in/out] 初值/解
+	 * @param deadline [in] 截止时间(us), 0表示不限制
+	 * @retval true 收敛
+	 * @retval false 不收敛或者超时
+	 */
+	bool iterate(const HTransform3D<>& target, Q& q, unsigned long long deadline) const;
+
+	/**
+	 * @brief 末端误差
+	 * @param target [in] 目标位姿
+	 * @param current [in] 当前位姿
+	 * @param e [out] 位置误差与姿态误差(旋转向量), 长度为6
+	 * @return 位置误差与姿态误差中较大的一个
+	 */
+	static double error(const HTransform3D<>& target, const HTransform3D<>& current, Q& e);
+
+	/** @brief 把关节角限制在关节范围内 */
+	void clamp(Q& q) const;
+
+	/** @brief 关节范围内的伪随机关节角(固定的随机序列) */
+	void randomSeed(Q& q) const;
+private:
+	robot::model::SerialLink::ptr _serialLink;
+	robot::math::Q _qMin;
+	robot::math::Q _qMax;
+	int _maxIterations;
+	unsigned long long _timeBudget;
+	double _tolerance;
+	int _restarts;
+
+	/** @brief 上一次的解, 作为下一次solveInto的初值 */
+	mutable robot::math::Q _seed;
+
+	/** @brief 初值索引, 可以为NULL */
+	IKSeedIndex::ptr _seedIndex;
+
+	/** @brief 从索引中取的初值个数 */
+	int _indexSeeds;
+
+	/** @brief 伪随机数的状态 */
+	mutable unsigned int _random;
+
+	mutable int _iterations;
+};
+
+/** @} */
+} /* namespace ik */
+} /* namespace robot */
+
+#endif /* NUMERICIKSOLVER_H_ */
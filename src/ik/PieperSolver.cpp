@@ -6,556 +6,570 @@
  */
 
 # include "PieperSolver.h"
+# include "../common/common.h"
 # include <math.h>
 
+using robot::math::Q;
+using robot::model::SerialLink;
+using robot::model::Config;
+
 namespace robot {
 namespace ik {
 
-double Power(double arg, int exp) {
-    double res = arg;
-    for (int i = 0; i<exp-1; i++)
-        res *= arg;
-    return res;
-}
+namespace {
 
-PieperSolver::PieperSolver(robot::model::SerialLink& serialRobot) {
-	_dHTable = serialRobot.getDHTable();
-    alpha0 = _dHTable[0].alpha();
-    a0 = _dHTable[0].a();
-    calpha0 = cos(_dHTable[0].alpha());
-    salpha0 = sin(_dHTable[0].alpha());
-    d1 = _dHTable[0].d();
-
-//    _0Tbase = (_baseTdhRef*HTransform3D<>::DH(alpha0, a0, d1, 0)).inverse();
-
-    alpha1 = _dHTable[1].alpha();
-    a1 = _dHTable[1].a();
-    calpha1 = cos(_dHTable[1].alpha());
-    salpha1 = sin(_dHTable[1].alpha());
-    d2 = _dHTable[1].d();
-
-    alpha2 = _dHTable[2].alpha();
-    a2 = _dHTable[2].a();
-    calpha2 = cos(_dHTable[2].alpha());
-    salpha2 = sin(_dHTable[2].alpha());
-    d3 = _dHTable[2].d();
-
-    alpha3 = _dHTable[3].alpha();
-    a3 = _dHTable[3].a();
-    calpha3 = cos(_dHTable[3].alpha());
-    salpha3 = sin(_dHTable[3].alpha());
-    d4 = _dHTable[3].d();
-
-    alpha4 = _dHTable[4].alpha();
-    a4 = _dHTable[4].a();
-    calpha4 = cos(_dHTable[4].alpha());
-    salpha4 = sin(_dHTable[4].alpha());
-    d5 = _dHTable[4].d();
-
-    alpha5 = _dHTable[5].alpha();
-    a5 = _dHTable[5].a();
-    calpha5 = cos(_dHTable[5].alpha());
-    salpha5 = sin(_dHTable[5].alpha());
-    d6 = _dHTable[5].d();
-
-    HTransform3D<> baseT0 = HTransform3D<>::DH(alpha0, a0, d1, 0);
-    _0Tbase = baseT0.inverse();
-    _endTjoint6 = ((HTransform3D<>::DH(0, 0, d6, 0))*serialRobot.getTool()->getTransform()).inverse();
+/**
+ * @brief a*x^2 + b*x + c = 0的实根, 判别式略小于0时按重根处理
+ * @return 根的个数
+ */
+int solveQuadratic(double a, double b, double c, double* x)
+{
+	if (fabs(a) < 1e-14)
+	{
+		if (fabs(b) < 1e-14)
+			return 0;
+		x[0] = -c/b;
+		return 1;
+	}
+	double d = b*b - 4*a*c;
+	if (d < 0)
+	{
+		if (d < -1e-12*(b*b + fabs(4*a*c)))
+			return 0;
+		d = 0;
+	}
+	// 避免相近的数相减
+	const double q = -0.5*(b + ((b < 0) ? -sqrt(d) : sqrt(d)));
+	if (q == 0)
+	{
+		x[0] = 0;
+		return 1;
+	}
+	x[0] = q/a;
+	x[1] = c/q;
+	return 2;
 }
 
-void PieperSolver::init() {
-    alpha0 = _dHTable[0].alpha();
-    a0 = _dHTable[0].a();
-    calpha0 = cos(_dHTable[0].alpha());
-    salpha0 = sin(_dHTable[0].alpha());
-    d1 = _dHTable[0].d();
-
-//    _0Tbase = (_baseTdhRef*HTransform3D<>::DH(alpha0, a0, d1, 0)).inverse();
-
-    alpha1 = _dHTable[1].alpha();
-    a1 = _dHTable[1].a();
-    calpha1 = cos(_dHTable[1].alpha());
-    salpha1 = sin(_dHTable[1].alpha());
-    d2 = _dHTable[1].d();
-
-    alpha2 = _dHTable[2].alpha();
-    a2 = _dHTable[2].a();
-    calpha2 = cos(_dHTable[2].alpha());
-    salpha2 = sin(_dHTable[2].alpha());
-    d3 = _dHTable[2].d();
-
-    alpha3 = _dHTable[3].alpha();
-    a3 = _dHTable[3].a();
-    calpha3 = cos(_dHTable[3].alpha());
-    salpha3 = sin(_dHTable[3].alpha());
-    d4 = _dHTable[3].d();
-
-    alpha4 = _dHTable[4].alpha();
-    a4 = _dHTable[4].a();
-    calpha4 = cos(_dHTable[4].alpha());
-    salpha4 = sin(_dHTable[4].alpha());
-    d5 = _dHTable[4].d();
-
-    alpha5 = _dHTable[5].alpha();
-    a5 = _dHTable[5].a();
-    calpha5 = cos(_dHTable[5].alpha());
-    salpha5 = sin(_dHTable[5].alpha());
-    d6 = _dHTable[5].d();
-
-    HTransform3D<> baseT0 = HTransform3D<>::DH(alpha0, a0, d1, 0);
-    _0Tbase = baseT0.inverse();
-//    _endTjoint6 = ((HTransform3D<>::DH(0, 0, d6, 0))*serialRobot.getTool()->getTransform()).inverse();
+/**
+ * @brief x^3 + a*x^2 + b*x + c = 0的实根(Cardano公式, 三个实根时用三角形式)
+ * @return 根的个数
+ */
+int solveCubic(double a, double b, double c, double* x)
+{
+	const double Q = (a*a - 3*b)/9;
+	const double R = (2*a*a*a - 9*a*b + 27*c)/54;
+	const double Q3 = Q*Q*Q;
+	if (R*R < Q3)
+	{
+		const double theta = acos(R/sqrt(Q3));
+		const double m = -2*sqrt(Q);
+		x[0] = m*cos(theta/3) - a/3;
+		x[1] = m*cos((theta + 2*M_PI)/3) - a/3;
+		x[2] = m*cos((theta - 2*M_PI)/3) - a/3;
+		return 3;
+	}
+	double A = cbrt(fabs(R) + sqrt(R*R - Q3));
+	if (R > 0)
+		A = -A;
+	x[0] = A + ((A == 0) ? 0 : Q/A) - a/3;
+	return 1;
 }
 
-std::vector<Q> PieperSolver::solve(const HTransform3D<>& baseTend) const
+/**
+ * @brief p[4]*x^4 + p[3]*x^3 + p[2]*x^2 + p[1]*x + p[0] = 0的实根(Ferrari公式)
+ * @param p [in] 系数, 按次数从低到高
+ * @param x [out] 最多4个
+ * @return 根的个数
+ */
+int solveQuartic(const double* p, double* x)
 {
-	HTransform3D<> T06 = _0Tbase*baseTend*_endTjoint6;
-//	cout << "T06 is: " << std::endl;
-//	T06.print();
-    double r = Power(T06.getPosition().getLength(), 2);
-    double x = T06.getPosition()(0);
-    double y = T06.getPosition()(1);
-    double z = T06.getPosition()(2);
-//    cout<<"r= "<<r<<" "<<"x= "<<x<<" y= "<<y<<" z= "<<z<<std::endl;
-
-    std::vector<double> theta3;
-    std::vector<Q> result;
-    if (a1 == 0) {
-//        std::cout<<"Case 1"<<std::endl;
-
-        theta3 = solveTheta3Case1(r);
-
-        for (std::vector<double>::iterator it = theta3.begin(); it != theta3.end(); ++it) {
-            double theta3 = *it;
-//            std::cout << "solution of theta3: " << theta3 << std::endl;
-            std::vector<double> theta2sol = solveTheta2Case1(z, theta3);
-            typedef std::vector<double>::iterator I;
-            for (I it2 = theta2sol.begin(); it2 != theta2sol.end(); ++it2)
-            {
-                double theta2 = *it2;
-                double theta1 = solveTheta1(x, y, theta2, theta3);
-                solveTheta456(theta1, theta2, theta3, T06, result);
-            }
-        }
-    }
-    else if (fabs(salpha1) < 1e-12) {
-//        std::cout<<"Case 2"<<std::endl;
-        theta3 = solveTheta3Case2(z);
-        for (std::vector<double>::iterator it = theta3.begin(); it != theta3.end(); ++it) {
-            double theta3 = *it;
-//            std::cout << "solution of theta3: " << theta3 << std::endl;
-            std::vector<double> theta2sol = solveTheta2Case2(r, theta3);
-            typedef std::vector<double>::iterator I;
-            for (I it2 = theta2sol.begin(); it2 != theta2sol.end(); ++it2) {
-                double theta2 = *it2;
-                double theta1 = solveTheta1(x, y, theta2, theta3);
-                solveTheta456(theta1, theta2, theta3, T06, result);
-            }
-        }
-    }
-    else {
-    	//TODO
-    	/*
-    	 * case 3 暂不做处理
-    	 */
-//        std::cout<<"Case 3"<<std::endl;
-//        theta3 = solveTheta3Case3(r, z);
-//      //  std::cout<<"theta3 = "<<theta3.size()<<std::endl;
-//        for (std::vector<double>::iterator it = theta3.begin(); it != theta3.end(); ++it) {
-//      //      std::cout<<"t3 = "<<*it<<std::endl;
-//            double theta3 = *it;
-//            double theta2 = solveTheta2(r, z, theta3);
-//            double theta1 = solveTheta1(x, y, theta2, theta3);
-//
-//            solveTheta456(theta1, theta2, theta3, T06, result);
-//        }
-    }
-
-    for (std::vector<Q>::iterator it = result.begin(); it != result.end(); ++it) {
-        for (size_t i = 0; i<(size_t)(*it).size(); i++)
-            (*it)(i) -= _dHTable[i].theta();
-    }
-
-    return result;
+	const double a = p[3]/p[4], b = p[2]/p[4], c = p[1]/p[4], d = p[0]/p[4];
+	// x = y - a/4, y^4 + P*y^2 + Q*y + R = 0
+	const double a2 = a*a;
+	const double P = b - 0.375*a2;
+	const double Q = c - 0.5*a*b + 0.125*a2*a;
+	const double R = d - 0.25*a*c + 0.0625*a2*b - 3.0/256*a2*a2;
+	int count = 0;
+	double y[4];
+	if (fabs(Q) < 1e-14)
+	{
+		// 双二次方程
+		double z[2];
+		const int n = solveQuadratic(1, P, R, z);
+		for (int i=0; i<n; i++)
+		{
+			if (z[i] < -1e-14)
+				continue;
+			const double root = sqrt((z[i] > 0) ? z[i] : 0);
+			y[count++] = root;
+			if (root > 0)
+				y[count++] = -root;
+		}
+	}
+	else
+	{
+		// 预解式m^3 + P*m^2 + (P^2/4 - R)*m - Q^2/8 = 0取最大的根(必为正), 并用Newton迭代修正一次
+		double m[3];
+		const int n = solveCubic(P, 0.25*P*P - R, -0.125*Q*Q, m);
+		double mm = m[0];
+		for (int i=1; i<n; i++)
+			mm = (m[i] > mm) ? m[i] : mm;
+		const double f = ((mm + P)*mm + 0.25*P*P - R)*mm - 0.125*Q*Q;
+		const double df = (3*mm + 2*P)*mm + 0.25*P*P - R;
+		if (df != 0 && mm - f/df > 0)
+			mm -= f/df;
+		if (mm <= 0)
+			return 0;
+		// (y^2 + P/2 + m)^2 = 2m*(y - Q/(4m))^2
+		const double s = sqrt(2*mm);
+		const double t = Q/(2*s);
+		count = solveQuadratic(1, -s, 0.5*P + mm + t, y);
+		count += solveQuadratic(1, s, 0.5*P + mm - t, y + count);
+	}
+	for (int i=0; i<count; i++)
+		x[i] = y[i] - 0.25*a;
+	return count;
+}
 
+/**
+ * @brief out += a*b*scale, a, b为二次多项式, out为四次多项式(系数按次数从低到高)
+ */
+void addProduct(const double* a, const double* b, double scale, double* out)
+{
+	for (int i=0; i<3; i++)
+		for (int j=0; j<3; j++)
+			out[i + j] += scale*a[i]*b[j];
 }
 
+}
 
-void PieperSolver::solveTheta456(
-    double theta1,
-    double theta2,
-    double theta3,
-    HTransform3D<>& T06,
-    std::vector<Q>& result) const
+PieperSolver::PieperSolver(SerialLink::ptr serialRobot) :
+		_serialLink(serialRobot)
 {
-	// 当前推导仅适用于末端旋转=等同于欧拉角Z（-Y）Z的情况， 其它情况可以利用欧拉角表格重新推导
-    Q q(Q::zero(6));
-    q(0) = theta1;
-    q(1) = theta2;
-    q(2) = theta3;
-
-    HTransform3D<> T01 = HTransform3D<>::DH(alpha0, a0, d1, theta1); // TODO DH(0, 0, 0, theta1) ?
-    HTransform3D<> T12 = HTransform3D<>::DH(alpha1, a1, d2, theta2);
-    HTransform3D<> T23 = HTransform3D<>::DH(alpha2, a2, d3, theta3);
-    HTransform3D<> T34 = HTransform3D<>::DH(alpha3, a3, d4, 0);
-
-    HTransform3D<> T04 = T01*T12*T23*T34;
-
-    HTransform3D<> T46 = T04.inverse()*T06;
-
-    double r11 = T46(0,0);
-    double r12 = T46(0,1);
-    double r13 = T46(0,2);
-
-    //  double r21 = T46(1,0);
-    //  double r22 = T46(1,1);
-    double r23 = T46(1,2);
-
-    double r31 = T46(2,0);
-    double r32 = T46(2,1);
-    double r33 = T46(2,2);
-
-    double theta4, theta5, theta6;
-
-    theta5 = atan2(sqrt(r31*r31+r32*r32), r33); // sin(theta5) >= 0; Case for Z(-Y)Z rotation
-    if (fabs(theta5) < 1e-12) {
-        theta4 = 0;
-        theta6 = atan2(-r12, r11);
-    }
-    else if (fabs(M_PI-theta5)< 1e-12) {
-        theta4 = 0;
-        theta6 = atan2(r12,-r11);
-    } else {
-        double s5 = sin(theta5);
-        if (alpha5 < 0) { //Case for Z(-Y)Z rotation
-            theta4 = atan2(-r23/s5, -r13/s5);
-            theta6 = atan2(-r32/s5, r31/s5);
-        } else { //Case for Z(-Y)Z rotation
-            theta4 = atan2(r23/s5, r13/s5);
-            theta6 = atan2(r32/s5, -r31/s5);
-        }
-    }
-
-    q(3) = theta4;
-    q(4) = theta5;
-    q(5) = theta6;
-    result.push_back(q);
-
-    double alt4, alt6;
-    if (theta4>0)
-        alt4 = theta4-M_PI;
-    else
-        alt4 = theta4+M_PI;
-
-    if (theta6>0)
-        alt6 = theta6-M_PI;
-    else
-        alt6 = theta6+M_PI;
-
-    q(3) = alt4;
-    q(4) = -theta5;
-    q(5) = alt6;
-    result.push_back(q);
+	init();
+	if (!isValid())
+		throw("错误<PieperSolver>: 机器人模型不满足Pieper准则(末端三轴交于一点)!");
 }
 
-double PieperSolver::solveTheta1(double x, double y, double theta2, double theta3) const
+void PieperSolver::init()
 {
-    double c2 = cos(theta2);
-    double s2 = sin(theta2);
-    double c3 = cos(theta3);
-    double s3 = sin(theta3);
-
-
-    double c1= ((a1 + a2*c2 + a3*c2*c3 - a3*calpha2*s2*s3 + d3*s2*salpha2 + calpha3*d4*s2*salpha2 +
-                 c3*calpha2*d4*s2*salpha3 + c2*d4*s3*salpha3)*x +
-                (a2*calpha1*s2 - d2*salpha1 - (d3 + calpha3*d4)*(calpha2*salpha1 + c2*calpha1*salpha2) +
-                 a3*(c3*calpha1*s2 + c2*calpha1*calpha2*s3 - s3*salpha1*salpha2) +
-                 d4*(-(c2*c3*calpha1*calpha2) + calpha1*s2*s3 + c3*salpha1*salpha2)*salpha3)*y)/
-        (Power(a1,2) + Power(a3,2)*Power(c2,2)*Power(c3,2) +
-         Power(a3,2)*Power(c3,2)*Power(calpha1,2)*Power(s2,2) +
-         Power(a2,2)*(Power(c2,2) + Power(calpha1,2)*Power(s2,2)) -
-         2*Power(a3,2)*c2*c3*calpha2*s2*s3 + 2*Power(a3,2)*c2*c3*Power(calpha1,2)*calpha2*s2*s3 +
-         Power(a3,2)*Power(c2,2)*Power(calpha1,2)*Power(calpha2,2)*Power(s3,2) +
-         Power(a3,2)*Power(calpha2,2)*Power(s2,2)*Power(s3,2) - 2*a3*c3*calpha1*d2*s2*salpha1 -
-         2*a3*c3*calpha1*calpha2*d3*s2*salpha1 - 2*a3*c3*calpha1*calpha2*calpha3*d4*s2*salpha1 -
-         2*a3*c2*calpha1*calpha2*d2*s3*salpha1 - 2*a3*c2*calpha1*Power(calpha2,2)*d3*s3*salpha1 -
-         2*a3*c2*calpha1*Power(calpha2,2)*calpha3*d4*s3*salpha1 + Power(d2,2)*Power(salpha1,2) +
-         2*calpha2*d2*d3*Power(salpha1,2) + Power(calpha2,2)*Power(d3,2)*Power(salpha1,2) +
-         2*calpha2*calpha3*d2*d4*Power(salpha1,2) +
-         2*Power(calpha2,2)*calpha3*d3*d4*Power(salpha1,2) +
-         Power(calpha2,2)*Power(calpha3,2)*Power(d4,2)*Power(salpha1,2) + 2*a3*c2*c3*d3*s2*salpha2 -
-         2*a3*c2*c3*Power(calpha1,2)*d3*s2*salpha2 + 2*a3*c2*c3*calpha3*d4*s2*salpha2 -
-         2*a3*c2*c3*Power(calpha1,2)*calpha3*d4*s2*salpha2 -
-         2*a3*Power(c2,2)*Power(calpha1,2)*calpha2*d3*s3*salpha2 -
-         2*a3*Power(c2,2)*Power(calpha1,2)*calpha2*calpha3*d4*s3*salpha2 -
-         2*a3*calpha2*d3*Power(s2,2)*s3*salpha2 - 2*a3*calpha2*calpha3*d4*Power(s2,2)*s3*salpha2 +
-         2*c2*calpha1*d2*d3*salpha1*salpha2 + 2*c2*calpha1*calpha2*Power(d3,2)*salpha1*salpha2 +
-         2*c2*calpha1*calpha3*d2*d4*salpha1*salpha2 +
-         4*c2*calpha1*calpha2*calpha3*d3*d4*salpha1*salpha2 +
-         2*c2*calpha1*calpha2*Power(calpha3,2)*Power(d4,2)*salpha1*salpha2 -
-         2*Power(a3,2)*c3*calpha1*s2*s3*salpha1*salpha2 -
-         2*Power(a3,2)*c2*calpha1*calpha2*Power(s3,2)*salpha1*salpha2 +
-         2*a3*d2*s3*Power(salpha1,2)*salpha2 + 2*a3*calpha2*d3*s3*Power(salpha1,2)*salpha2 +
-         2*a3*calpha2*calpha3*d4*s3*Power(salpha1,2)*salpha2 +
-         Power(c2,2)*Power(calpha1,2)*Power(d3,2)*Power(salpha2,2) +
-         2*Power(c2,2)*Power(calpha1,2)*calpha3*d3*d4*Power(salpha2,2) +
-         Power(c2,2)*Power(calpha1,2)*Power(calpha3,2)*Power(d4,2)*Power(salpha2,2) +
-         Power(d3,2)*Power(s2,2)*Power(salpha2,2) + 2*calpha3*d3*d4*Power(s2,2)*Power(salpha2,2) +
-         Power(calpha3,2)*Power(d4,2)*Power(s2,2)*Power(salpha2,2) +
-         2*a3*c2*calpha1*d3*s3*salpha1*Power(salpha2,2) +
-         2*a3*c2*calpha1*calpha3*d4*s3*salpha1*Power(salpha2,2) +
-         Power(a3,2)*Power(s3,2)*Power(salpha1,2)*Power(salpha2,2) -
-         2*d4*(-(calpha1*(d2 + calpha2*(d3 + calpha3*d4))*(c2*c3*calpha2 - s2*s3)*salpha1) -
-               ((d3 + calpha3*d4)*(c3*calpha2*(Power(c2,2)*Power(calpha1,2) + Power(s2,2)) -
-                                   c2*(-1 + Power(calpha1,2))*s2*s3) -
-                c3*(d2 + calpha2*(d3 + calpha3*d4))*Power(salpha1,2))*salpha2 +
-               c2*c3*calpha1*(d3 + calpha3*d4)*salpha1*Power(salpha2,2) +
-               a3*(Power(c2,2)*c3*(-1 + Power(calpha1,2)*Power(calpha2,2))*s3 -
-                   c3*(calpha1 - calpha2)*(calpha1 + calpha2)*Power(s2,2)*s3 -
-                   calpha1*s2*(c3 - s3)*(c3 + s3)*salpha1*salpha2 +
-                   c3*s3*Power(salpha1,2)*Power(salpha2,2) +
-                   c2*calpha2*((-1 + Power(calpha1,2))*s2*(c3 - s3)*(c3 + s3) -
-                               2*c3*calpha1*s3*salpha1*salpha2)))*salpha3 +
-         Power(d4,2)*(Power(c2,2)*(Power(c3,2)*Power(calpha1,2)*Power(calpha2,2) + Power(s3,2)) +
-                      Power(s2,2)*(Power(c3,2)*Power(calpha2,2) + Power(calpha1,2)*Power(s3,2)) +
-                      2*c3*calpha1*s2*s3*salpha1*salpha2 + Power(c3,2)*Power(salpha1,2)*Power(salpha2,2) -
-                      2*c2*c3*calpha2*((-1 + Power(calpha1,2))*s2*s3 + c3*calpha1*salpha1*salpha2))*
-         Power(salpha3,2) + 2*a1*(a2*c2 + a3*c2*c3 - a3*calpha2*s2*s3 + d3*s2*salpha2 +
-                                  calpha3*d4*s2*salpha2 + c3*calpha2*d4*s2*salpha3 + c2*d4*s3*salpha3) +
-         2*a2*(-(calpha1*(d2 + calpha2*(d3 + calpha3*d4))*s2*salpha1) -
-               c2*(-1 + Power(calpha1,2))*(d3 + calpha3*d4)*s2*salpha2 +
-               a3*(Power(c2,2)*c3 + c2*(-1 + Power(calpha1,2))*calpha2*s2*s3 +
-                   calpha1*s2*(c3*calpha1*s2 - s3*salpha1*salpha2)) +
-               d4*(-(c2*c3*(-1 + Power(calpha1,2))*calpha2*s2) + Power(c2,2)*s3 +
-                   calpha1*s2*(calpha1*s2*s3 + c3*salpha1*salpha2))*salpha3));
-
-    double s1 = (-((a2*calpha1*s2 - d2*salpha1 - (d3 + calpha3*d4)*(calpha2*salpha1 + c2*calpha1*salpha2) +
-                    a3*(c3*calpha1*s2 + c2*calpha1*calpha2*s3 - s3*salpha1*salpha2) +
-                    d4*(-(c2*c3*calpha1*calpha2) + calpha1*s2*s3 + c3*salpha1*salpha2)*salpha3)*x) +
-                 (a1 + a2*c2 + a3*c2*c3 - a3*calpha2*s2*s3 + d3*s2*salpha2 + calpha3*d4*s2*salpha2 +
-                  c3*calpha2*d4*s2*salpha3 + c2*d4*s3*salpha3)*y)/
-        (Power(a1,2) + Power(a3,2)*Power(c2,2)*Power(c3,2) +
-         Power(a3,2)*Power(c3,2)*Power(calpha1,2)*Power(s2,2) +
-         Power(a2,2)*(Power(c2,2) + Power(calpha1,2)*Power(s2,2)) -
-         2*Power(a3,2)*c2*c3*calpha2*s2*s3 + 2*Power(a3,2)*c2*c3*Power(calpha1,2)*calpha2*s2*s3 +
-         Power(a3,2)*Power(c2,2)*Power(calpha1,2)*Power(calpha2,2)*Power(s3,2) +
-         Power(a3,2)*Power(calpha2,2)*Power(s2,2)*Power(s3,2) - 2*a3*c3*calpha1*d2*s2*salpha1 -
-         2*a3*c3*calpha1*calpha2*d3*s2*salpha1 - 2*a3*c3*calpha1*calpha2*calpha3*d4*s2*salpha1 -
-         2*a3*c2*calpha1*calpha2*d2*s3*salpha1 - 2*a3*c2*calpha1*Power(calpha2,2)*d3*s3*salpha1 -
-         2*a3*c2*calpha1*Power(calpha2,2)*calpha3*d4*s3*salpha1 + Power(d2,2)*Power(salpha1,2) +
-         2*calpha2*d2*d3*Power(salpha1,2) + Power(calpha2,2)*Power(d3,2)*Power(salpha1,2) +
-         2*calpha2*calpha3*d2*d4*Power(salpha1,2) +
-         2*Power(calpha2,2)*calpha3*d3*d4*Power(salpha1,2) +
-         Power(calpha2,2)*Power(calpha3,2)*Power(d4,2)*Power(salpha1,2) + 2*a3*c2*c3*d3*s2*salpha2 -
-         2*a3*c2*c3*Power(calpha1,2)*d3*s2*salpha2 + 2*a3*c2*c3*calpha3*d4*s2*salpha2 -
-         2*a3*c2*c3*Power(calpha1,2)*calpha3*d4*s2*salpha2 -
-         2*a3*Power(c2,2)*Power(calpha1,2)*calpha2*d3*s3*salpha2 -
-         2*a3*Power(c2,2)*Power(calpha1,2)*calpha2*calpha3*d4*s3*salpha2 -
-         2*a3*calpha2*d3*Power(s2,2)*s3*salpha2 - 2*a3*calpha2*calpha3*d4*Power(s2,2)*s3*salpha2 +
-         2*c2*calpha1*d2*d3*salpha1*salpha2 + 2*c2*calpha1*calpha2*Power(d3,2)*salpha1*salpha2 +
-         2*c2*calpha1*calpha3*d2*d4*salpha1*salpha2 +
-         4*c2*calpha1*calpha2*calpha3*d3*d4*salpha1*salpha2 +
-         2*c2*calpha1*calpha2*Power(calpha3,2)*Power(d4,2)*salpha1*salpha2 -
-         2*Power(a3,2)*c3*calpha1*s2*s3*salpha1*salpha2 -
-         2*Power(a3,2)*c2*calpha1*calpha2*Power(s3,2)*salpha1*salpha2 +
-         2*a3*d2*s3*Power(salpha1,2)*salpha2 + 2*a3*calpha2*d3*s3*Power(salpha1,2)*salpha2 +
-         2*a3*calpha2*calpha3*d4*s3*Power(salpha1,2)*salpha2 +
-         Power(c2,2)*Power(calpha1,2)*Power(d3,2)*Power(salpha2,2) +
-         2*Power(c2,2)*Power(calpha1,2)*calpha3*d3*d4*Power(salpha2,2) +
-         Power(c2,2)*Power(calpha1,2)*Power(calpha3,2)*Power(d4,2)*Power(salpha2,2) +
-         Power(d3,2)*Power(s2,2)*Power(salpha2,2) + 2*calpha3*d3*d4*Power(s2,2)*Power(salpha2,2) +
-         Power(calpha3,2)*Power(d4,2)*Power(s2,2)*Power(salpha2,2) +
-         2*a3*c2*calpha1*d3*s3*salpha1*Power(salpha2,2) +
-         2*a3*c2*calpha1*calpha3*d4*s3*salpha1*Power(salpha2,2) +
-         Power(a3,2)*Power(s3,2)*Power(salpha1,2)*Power(salpha2,2) -
-         2*d4*(-(calpha1*(d2 + calpha2*(d3 + calpha3*d4))*(c2*c3*calpha2 - s2*s3)*salpha1) -
-               ((d3 + calpha3*d4)*(c3*calpha2*(Power(c2,2)*Power(calpha1,2) + Power(s2,2)) -
-                                   c2*(-1 + Power(calpha1,2))*s2*s3) -
-                c3*(d2 + calpha2*(d3 + calpha3*d4))*Power(salpha1,2))*salpha2 +
-               c2*c3*calpha1*(d3 + calpha3*d4)*salpha1*Power(salpha2,2) +
-               a3*(Power(c2,2)*c3*(-1 + Power(calpha1,2)*Power(calpha2,2))*s3 -
-                   c3*(calpha1 - calpha2)*(calpha1 + calpha2)*Power(s2,2)*s3 -
-                   calpha1*s2*(c3 - s3)*(c3 + s3)*salpha1*salpha2 +
-                   c3*s3*Power(salpha1,2)*Power(salpha2,2) +
-                   c2*calpha2*((-1 + Power(calpha1,2))*s2*(c3 - s3)*(c3 + s3) -
-                               2*c3*calpha1*s3*salpha1*salpha2)))*salpha3 +
-         Power(d4,2)*(Power(c2,2)*(Power(c3,2)*Power(calpha1,2)*Power(calpha2,2) + Power(s3,2)) +
-                      Power(s2,2)*(Power(c3,2)*Power(calpha2,2) + Power(calpha1,2)*Power(s3,2)) +
-                      2*c3*calpha1*s2*s3*salpha1*salpha2 + Power(c3,2)*Power(salpha1,2)*Power(salpha2,2) -
-                      2*c2*c3*calpha2*((-1 + Power(calpha1,2))*s2*s3 + c3*calpha1*salpha1*salpha2))*
-         Power(salpha3,2) + 2*a1*(a2*c2 + a3*c2*c3 - a3*calpha2*s2*s3 + d3*s2*salpha2 +
-                                  calpha3*d4*s2*salpha2 + c3*calpha2*d4*s2*salpha3 + c2*d4*s3*salpha3) +
-         2*a2*(-(calpha1*(d2 + calpha2*(d3 + calpha3*d4))*s2*salpha1) -
-               c2*(-1 + Power(calpha1,2))*(d3 + calpha3*d4)*s2*salpha2 +
-               a3*(Power(c2,2)*c3 + c2*(-1 + Power(calpha1,2))*calpha2*s2*s3 +
-                   calpha1*s2*(c3*calpha1*s2 - s3*salpha1*salpha2)) +
-               d4*(-(c2*c3*(-1 + Power(calpha1,2))*calpha2*s2) + Power(c2,2)*s3 +
-                   calpha1*s2*(calpha1*s2*s3 + c3*salpha1*salpha2))*salpha3));
-
-    return atan2(s1, c1);
+	if (_serialLink->getDOF() != 6)
+		throw("错误<PieperSolver>: 只适用于6轴机器人!");
+	_dHTable = _serialLink->getDHTable();
+	for (int i=0; i<6; i++)
+	{
+		_a[i] = _dHTable[i].a();
+		_d[i] = _dHTable[i].d();
+		_sa[i] = _serialLink->getLink(i)->sa();
+		_ca[i] = _serialLink->getLink(i)->ca();
+	}
+	_case = (fabs(_a[1]) < 1e-12) ? 1 : ((fabs(_sa[1]) < 1e-12) ? 2 : 0);
+
+	/**> 腕部中心在第三关节坐标系中: (c3*f0 - s3*f1, s3*f0 + c3*f1, f2 + d2) */
+	const double f0 = _a[3];
+	const double f1 = -_sa[3]*_d[3];
+	const double f2 = _ca[3]*_d[3];
+	_U.c = f0; _U.s = -f1; _U.k = 0;
+	_V.c = f1; _V.s = f0; _V.k = 0;
+	_W = f2 + _d[2];
+	_G3.c = _sa[2]*_V.c; _G3.s = _sa[2]*_V.s; _G3.k = _ca[2]*_W;
+	_G = f0*f0 + f1*f1 + _a[2]*_a[2] + _W*_W;
+	_K3.c = 2*_a[2]*_U.c + 2*_d[1]*_G3.c;
+	_K3.s = 2*_a[2]*_U.s + 2*_d[1]*_G3.s;
+	_K3.k = _G + 2*_d[1]*_G3.k + _d[1]*_d[1] + _a[1]*_a[1];
+	_elbowZero = atan2(_K3.s, _K3.c);
+
+	_0Tbase = (HTransform3D<>::DH(_dHTable[0].alpha(), _a[0], _d[0], 0)).inverse();
+	_endTjoint6 = ((HTransform3D<>::DH(0, 0, _d[5], 0))*_serialLink->getTool()->getTransform()).inverse();
 }
 
-
-std::vector<double> PieperSolver::solveTheta2Case2(double r, double theta3) const {
-    double c3 = cos(theta3);
-    double s3 = sin(theta3);
-
-    double a = -Power(a1,2) + 2*a1*a2 - Power(a2,2) - Power(a3,2) + 2*a1*a3*c3 - 2*a2*a3*c3 - Power(d2,2) -
-        2*calpha2*d2*d3 - Power(d3,2) - 2*calpha2*calpha3*d2*d4 - 2*calpha3*d3*d4 - Power(d4,2) + r -
-        2*a3*d2*s3*salpha2 + 2*a1*d4*s3*salpha3 - 2*a2*d4*s3*salpha3 + 2*c3*d2*d4*salpha2*salpha3;
-
-    double b = 4*a1*a3*calpha2*s3 - 4*a1*d3*salpha2 - 4*a1*calpha3*d4*salpha2 - 4*a1*c3*calpha2*d4*salpha3;
-
-    double c = -Power(a1,2) - 2*a1*a2 - Power(a2,2) - Power(a3,2) - 2*a1*a3*c3 - 2*a2*a3*c3 - Power(d2,2) -
-        2*calpha2*d2*d3 - Power(d3,2) - 2*calpha2*calpha3*d2*d4 - 2*calpha3*d3*d4 - Power(d4,2) + r -
-        2*a3*d2*s3*salpha2 - 2*a1*d4*s3*salpha3 - 2*a2*d4*s3*salpha3 + 2*c3*d2*d4*salpha2*salpha3;
-
-
-    double d = b*b-4*a*c;
-    std::vector<double> result;
-    if (fabs(a)<1e-12) {
-        result.push_back(-c/b);
-    }
-    else if (fabs(d) < 1e-12)
-        result.push_back(-b/(2*a));
-    else if (d>0) {
-        result.push_back((-b-sqrt(d))/(2*a));
-        result.push_back((-b+sqrt(d))/(2*a));
-    }
-
-
-    for (std::vector<double>::iterator it = result.begin(); it != result.end(); ++it) {
-        double u = *it;
-        double c2 = (1-u*u)/(1+u*u);
-        double s2 = 2*u/(1+u*u);
-        double theta2 = atan2(s2,c2);
-        (*it) = theta2;
-//        std::cout << "solution of theta2: " << theta2 << std::endl;
-    }
-
-    return result;
-
+std::vector<Q> PieperSolver::solve(const HTransform3D<>& baseTend, const Config& config) const
+{
+	IKSolutionSet solutions;
+	switch (solveInto(baseTend, config, solutions))
+	{
+	case ikNoSolution:
+		throw (std::string("错误<PieperSolver>: 没有解!"));
+	case ikOutOfRange:
+		throw (std::string("错误<PieperSolver>: 没有符合范围的解!"));
+	default:
+		break;
+	}
+	std::vector<Q> result;
+	solutions.toVector(result);
+	return result;
 }
 
-std::vector<double> PieperSolver::solveTheta2Case1(double z, double theta3) const {
-    double c3 = cos(theta3);
-    double s3 = sin(theta3);
-
-    /*double a = -(calpha1*d2) - calpha1*calpha2*d3 - calpha1*calpha2*calpha3*d4 + a3*calpha2*s3*salpha1 -
-        a3*calpha1*s3*salpha2 - d3*salpha1*salpha2 - calpha3*d4*salpha1*salpha2 -
-        c3*calpha2*d4*salpha1*salpha3 + c3*calpha1*d4*salpha2*salpha3 + z;
-
-    double b = -2*a2*salpha1 - 2*a3*c3*salpha1 - 2*d4*s3*salpha1*salpha3;
-
-    double c = -(calpha1*d2) - calpha1*calpha2*d3 - calpha1*calpha2*calpha3*d4 - a3*calpha2*s3*salpha1 -
-        a3*calpha1*s3*salpha2 + d3*salpha1*salpha2 + calpha3*d4*salpha1*salpha2 +
-        c3*calpha2*d4*salpha1*salpha3 + c3*calpha1*d4*salpha2*salpha3 + z;
-	*/
-    double f1 = a3*c3 + d4*salpha3*s3 + a2;
-    double f2 = a3*calpha2*s3 - d4*salpha3*calpha2*c3 - d4*salpha2*calpha3 - d3*salpha2;
-    double f3 = a3*salpha2*s3 - d4*salpha3*salpha2*c3 + d4*calpha2*calpha3 + d3*calpha2;
-
-    double k1 = f1;
-    double k2 = -f2;
-    double k4 = f3*calpha1 + d2*calpha1;
-
-    double a = k4 - z + k2*salpha1;
-    double b = 2*k1*salpha1;
-    double c = k4 - z - k2*salpha1;
-
-    double d = b*b-4*a*c;
-
-    std::vector<double> result;
-    if (fabs(a)<1e-12)
-        result.push_back(-c/b);
-    else if (fabs(d) < 1e-12)
-        result.push_back(-b/(2*a));
-    else if (d>0) {
-        result.push_back((-b-sqrt(d))/(2.0*a));
-        result.push_back((-b+sqrt(d))/(2.0*a));
-    }
-
-
-    for (std::vector<double>::iterator it = result.begin(); it != result.end(); ++it) {
-        double u = *it;
-        double c2 = (1-u*u)/(1+u*u);
-        double s2 = 2*u/(1+u*u);
-        double theta2 = atan2(s2,c2);
-        (*it) = theta2;
-//        std::cout << "solution of theta2: " << theta2 << std::endl;
-    }
-
-    return result;
+IKStatus PieperSolver::solveInto(const HTransform3D<>& baseTend, const Config& config, IKSolutionSet& result) const
+{
+	result.clear();
+	Q q[IKSolutionSet::capacity];
+	const int count = solveAll(baseTend, resolve(config), q);
+	if (count == 0)
+		return ikNoSolution;
+	/**> 根据关节范围去除不符合的结果, 加减2pi的组合在访问时才生成 */
+	for (int k=0; k<count; k++)
+		result.add(q[k], *_serialLink);
+	return result.empty() ? ikOutOfRange : ikSuccess;
 }
 
-std::vector<double> PieperSolver::solveTheta3Case1(double r) const {
-    double a = -Power(a1,2) - Power(a2,2) + 2*a2*a3 - Power(a3,2) - Power(d2,2) - 2*calpha2*d2*d3 - Power(d3,2) -
-        2*calpha2*calpha3*d2*d4 - 2*calpha3*d3*d4 - Power(d4,2) + r - 2*d2*d4*salpha2*salpha3;
-
-    double b = -4*a3*d2*salpha2 - 4*a2*d4*salpha3;
-
-    double c = -Power(a1,2) - Power(a2,2) - 2*a2*a3 - Power(a3,2) - Power(d2,2) - 2*calpha2*d2*d3 - Power(d3,2)
-        -2*calpha2*calpha3*d2*d4 - 2*calpha3*d3*d4 - Power(d4,2) + r + 2*d2*d4*salpha2*salpha3;
-
-    double d = b*b-4*a*c;
-//    cout << a <<" "<< b <<" "<<c<<" "<<d<<std::endl;
-    std::vector<double> result;
-    if (fabs(a) < 1e-12)  //Is it only a linear equation
-        result.push_back(-c/b);
-    else if (fabs(d) < 1e-12)
-        result.push_back(-b/(2*a));
-    else if (d>0) {
-        result.push_back((-b-sqrt(d))/(2*a));
-        result.push_back((-b+sqrt(d))/(2*a));
-    }
-
-
-    for (std::vector<double>::iterator it = result.begin(); it != result.end(); ++it) {
-        double u = *it;
-        double c3 = (1-u*u)/(1+u*u);
-        double s3 = 2*u/(1+u*u);
-        double theta3 = atan2(s3,c3);
-        (*it) = theta3;
-    }
-
-    return result;
+IKStatus PieperSolver::solveNearest(const HTransform3D<>& baseTend, const Config& config, const Q& qPrev, Q& result) const
+{
+	// 没有指定(free或same)的部位锁定在qPrev所在的分支
+	const Config branch = getConfig(qPrev);
+	const Config locked(
+			(config.getShoulder() == Config::lefty || config.getShoulder() == Config::righty) ? config.getShoulder() : branch.getShoulder(),
+			(config.getElbow() == Config::epositive || config.getElbow() == Config::enegative) ? config.getElbow() : branch.getElbow(),
+			(config.getWrist() == Config::wpositive || config.getWrist() == Config::wnegative) ? config.getWrist() : branch.getWrist());
+	Q q[IKSolutionSet::capacity];
+	const int count = solveAll(baseTend, locked, q);
+	if (count == 0)
+		return ikNoSolution;
+	// qPrev与result可以是同一个对象, 选出后再赋值
+	int best = -1;
+	double distance = 0;
+	for (int k=0; k<count; k++)
+	{
+		if (!nearestWrap(q[k], qPrev, *_serialLink))
+			continue;
+		const double d = Q::distance(q[k], qPrev, 6);
+		if (best < 0 || d < distance)
+		{
+			best = k;
+			distance = d;
+		}
+	}
+	if (best < 0)
+		return ikOutOfRange;
+	result = q[best];
+	return ikSuccess;
 }
 
+int PieperSolver::solveAll(const HTransform3D<>& baseTend, const Config& config, Q* q) const
+{
+	const HTransform3D<> T06 = _0Tbase*baseTend*_endTjoint6;
+	Arm arm[4];
+	const int armCount = solveArm(T06, config, arm);
+	int count = 0;
+	for (int i=0; i<armCount; i++)
+		count += solveWrist(arm[i], T06, config, q + count);
+	return count;
+}
 
-std::vector<double> PieperSolver::solveTheta3Case2(double z) const {
-    double a = -(calpha1*d2) - calpha1*calpha2*d3 - calpha1*calpha2*calpha3*d4 - calpha1*d4*salpha2*salpha3 + z;
-
-    double b = -2*a3*calpha1*salpha2;
+int PieperSolver::solveArm(const HTransform3D<>& T06, const Config& config, Arm* arm) const
+{
+	const double x = T06(0, 3);
+	const double y = T06(1, 3);
+	const double z = T06(2, 3);
+	const double r = x*x + y*y + z*z;
+	double c3s[4], s3s[4];
+	const int theta3Count = solveTheta3(r, z, c3s, s3s);
+	int count = 0;
+	for (int i=0; i<theta3Count; i++)
+	{
+		const double c3 = c3s[i], s3 = s3s[i];
+		const double elbow = elbowOf(c3, s3);
+		if ((config.getElbow() == Config::epositive && elbow < 0) || (config.getElbow() == Config::enegative && elbow >= 0))
+			continue;
+		// 腕部中心在第二关节坐标系中的位置
+		const double g1 = _U.value(c3, s3) + _a[2];
+		const double g2 = _ca[2]*_V.value(c3, s3) - _sa[2]*_W;
+		const double g3 = _G3.value(c3, s3);
+		const double gg = g1*g1 + g2*g2;
+		// A = c2*g1 - s2*g2, B = s2*g1 + c2*g2
+		double A[2], B[2];
+		int theta2Count = 1;
+		if (_case == 0)
+		{
+			A[0] = (r - _K3.value(c3, s3))/(2*_a[1]);
+			B[0] = (z - _ca[1]*(g3 + _d[1]))/_sa[1];
+		}
+		else if (_case == 1)
+		{
+			B[0] = B[1] = (z - _ca[1]*(g3 + _d[1]))/_sa[1];
+			const double AA = gg - B[0]*B[0];
+			if (AA < -1e-10*gg)
+				continue;
+			A[0] = sqrt((AA > 0) ? AA : 0);
+			A[1] = -A[0];
+			theta2Count = (A[0] > 0) ? 2 : 1;
+		}
+		else
+		{
+			A[0] = A[1] = (r - _K3.value(c3, s3))/(2*_a[1]);
+			const double BB = gg - A[0]*A[0];
+			if (BB < -1e-10*gg)
+				continue;
+			B[0] = sqrt((BB > 0) ? BB : 0);
+			B[1] = -B[0];
+			theta2Count = (B[0] > 0) ? 2 : 1;
+		}
+		for (int k=0; k<theta2Count; k++)
+		{
+			// 腕部中心在第一关节坐标系中(theta1=0时)的位置
+			const double hx = A[k] + _a[1];
+			const double hy = _ca[1]*B[k] - _sa[1]*(g3 + _d[1]);
+			if ((config.getShoulder() == Config::lefty && hx < 0) || (config.getShoulder() == Config::righty && hx >= 0))
+				continue;
+			// (A, B)为(g1, g2)旋转theta2, (x, y)为(hx, hy)旋转theta1
+			Arm& solution = arm[count++];
+			const double n2 = sqrt((A[k]*A[k] + B[k]*B[k])*gg);
+			solution.c[1] = (n2 > 0) ? (A[k]*g1 + B[k]*g2)/n2 : 1;
+			solution.s[1] = (n2 > 0) ? (B[k]*g1 - A[k]*g2)/n2 : 0;
+			const double n1 = sqrt((x*x + y*y)*(hx*hx + hy*hy));
+			solution.c[0] = (n1 > 0) ? (x*hx + y*hy)/n1 : 1;
+			solution.s[0] = (n1 > 0) ? (y*hx - x*hy)/n1 : 0;
+			solution.c[2] = c3;
+			solution.s[2] = s3;
+			for (int j=0; j<3; j++)
+				solution.theta[j] = atan2(solution.s[j], solution.c[j]);
+		}
+	}
+	return count;
+}
 
-    double c = -(calpha1*d2) - calpha1*calpha2*d3 - calpha1*calpha2*calpha3*d4 + calpha1*d4*salpha2*salpha3 + z;
+int PieperSolver::solveTheta3(double r, double z, double* c3, double* s3) const
+{
+	if (_case != 0)
+	{
+		/**> 只有一个关于theta3的方程: c*cos(theta3) + s*sin(theta3) + k = 0 */
+		TrigForm L;
+		if (_case == 1)
+		{
+			L.c = -_K3.c; L.s = -_K3.s; L.k = r - _K3.k;
+		}
+		else
+		{
+			L.c = -_ca[1]*_G3.c; L.s = -_ca[1]*_G3.s; L.k = z - _ca[1]*(_G3.k + _d[1]);
+		}
+		const double rho = sqrt(L.c*L.c + L.s*L.s);
+		if (rho < 1e-12)
+			return 0;
+		double ratio = -L.k/rho;
+		if (fabs(ratio) > 1 + 1e-12)
+			return 0;
+		ratio = (ratio > 1) ? 1 : ((ratio < -1) ? -1 : ratio);
+		const double phi = atan2(L.s, L.c);
+		const double delta = acos(ratio);
+		c3[0] = cos(phi + delta);
+		s3[0] = sin(phi + delta);
+		if (delta < 1e-12)
+			return 1;
+		c3[1] = cos(phi - delta);
+		s3[1] = sin(phi - delta);
+		return 2;
+	}
+
+	/**> 一般情况: E = L1^2 + L2^2 + G3^2 - L3 = 0, 其中L1 = A, L2 = B, L3 = g1^2 + g2^2 + g3^2 */
+	TrigForm L1, L2, L3;
+	const double scale1 = 1.0/(2*_a[1]);
+	L1.c = -_K3.c*scale1; L1.s = -_K3.s*scale1; L1.k = (r - _K3.k)*scale1;
+	const double scale2 = -_ca[1]/_sa[1];
+	L2.c = _G3.c*scale2; L2.s = _G3.s*scale2; L2.k = (z - _ca[1]*(_G3.k + _d[1]))/_sa[1];
+	L3.c = 2*_a[2]*_U.c; L3.s = 2*_a[2]*_U.s; L3.k = _G;
+
+	/**> 代入t = tan(theta3/2), 两边乘(1 + t^2)^2, 得到t的四次方程 */
+	const TrigForm* forms[3] = {&L1, &L2, &_G3};
+	double p[5] = {0, 0, 0, 0, 0};
+	for (int i=0; i<3; i++)
+	{
+		const double quad[3] = {forms[i]->k + forms[i]->c, 2*forms[i]->s, forms[i]->k - forms[i]->c};
+		addProduct(quad, quad, 1, p);
+	}
+	const double quad3[3] = {L3.k + L3.c, 2*L3.s, L3.k - L3.c};
+	const double one[3] = {1, 0, 1};
+	addProduct(quad3, one, -1, p);
+
+	double maxCoeff = 0;
+	for (int i=0; i<5; i++)
+		maxCoeff = (fabs(p[i]) > maxCoeff) ? fabs(p[i]) : maxCoeff;
+	if (maxCoeff == 0)
+		return 0;
+	double t[4];
+	int count = 0;
+	bool atPi = false;
+	if (fabs(p[4]) > 1e-12*maxCoeff)
+		count = solveQuartic(p, t);
+	else
+	{
+		// 四次项为0时theta3 = pi是一个根(t为无穷大)
+		atPi = true;
+		if (fabs(p[3]) > 1e-12*maxCoeff)
+			count = solveCubic(p[2]/p[3], p[1]/p[3], p[0]/p[3], t);
+		else
+			count = solveQuadratic(p[2], p[1], p[0], t);
+	}
+
+	int result = 0;
+	for (int i=0; i<count + (atPi ? 1 : 0); i++)
+	{
+		double c, s;
+		if (i < count)
+		{
+			const double tt = t[i]*t[i];
+			c = (1 - tt)/(1 + tt);
+			s = 2*t[i]/(1 + tt);
+		}
+		else
+		{
+			c = -1;
+			s = 0;
+		}
+		/**> 在E(theta3)上做两步Newton迭代, 修正Ferrari公式的舍入误差 */
+		double E = 0;
+		for (int iteration=0; iteration<2; iteration++)
+		{
+			const double l1 = L1.value(c, s), l2 = L2.value(c, s), g3 = _G3.value(c, s);
+			E = l1*l1 + l2*l2 + g3*g3 - L3.value(c, s);
+			const double dE = 2*(l1*L1.derivative(c, s) + l2*L2.derivative(c, s) + g3*_G3.derivative(c, s)) - L3.derivative(c, s);
+			if (fabs(dE) < 1e-12)
+				break;
+			const double delta = -E/dE;
+			if (fabs(delta) > 0.1)
+				break;
+			// 步长很小, 用二阶展开代替三角函数
+			const double cd = 1 - 0.5*delta*delta, sd = delta - delta*delta*delta/6;
+			const double cNew = c*cd - s*sd, sNew = s*cd + c*sd;
+			const double norm = 1.0/sqrt(cNew*cNew + sNew*sNew);
+			c = cNew*norm;
+			s = sNew*norm;
+		}
+		{
+			const double l1 = L1.value(c, s), l2 = L2.value(c, s), g3 = _G3.value(c, s);
+			E = l1*l1 + l2*l2 + g3*g3 - L3.value(c, s);
+		}
+		// 判别式略小于0时给出的近似根(不可达)在这里排除
+		if (fabs(E) > 1e-9*(1 + r))
+			continue;
+		bool duplicate = false;
+		for (int k=0; k<result; k++)
+			duplicate = duplicate || (fabs(c - c3[k]) + fabs(s - s3[k]) < 1e-9);
+		if (duplicate)
+			continue;
+		c3[result] = c;
+		s3[result] = s;
+		result++;
+	}
+	return result;
+}
 
+int PieperSolver::solveWrist(const Arm& arm, const HTransform3D<>& T06, const Config& config, Q* q) const
+{
+	const HTransform3D<> T01 = HTransform3D<>::DHFast(0, 1, 0, 0, arm.s[0], arm.c[0]);
+	const HTransform3D<> T12 = HTransform3D<>::DHFast(_sa[1], _ca[1], _a[1], _d[1], arm.s[1], arm.c[1]);
+	const HTransform3D<> T23 = HTransform3D<>::DHFast(_sa[2], _ca[2], _a[2], _d[2], arm.s[2], arm.c[2]);
+	const HTransform3D<> T34 = HTransform3D<>::DHFast(_sa[3], _ca[3], _a[3], _d[3], 0, 1);
+	// N = Rz(theta4)*Rx(alpha4)*Rz(theta5)*Rx(alpha5)*Rz(theta6)
+	const HTransform3D<> N = (T01*T12*T23*T34).inverse()*T06;
+
+	const double sa4 = _sa[4], ca4 = _ca[4], sa5 = _sa[5], ca5 = _ca[5];
+	double c5 = (ca4*ca5 - N(2, 2))/(sa4*sa5);
+	if (fabs(c5) > 1 + 1e-9)
+		return 0;
+	c5 = (c5 > 1) ? 1 : ((c5 < -1) ? -1 : c5);
+	const double s5abs = sqrt(1 - c5*c5);
+	int count = 0;
+	for (int sgn=1; sgn>=-1; sgn-=2)
+	{
+		const double s5 = sgn*s5abs;
+		if (sgn < 0 && s5abs < 1e-9)
+			break;
+		const bool singular = (s5abs < 1e-9);
+		if (!singular && ((config.getWrist() == Config::wpositive && sgn < 0) || (config.getWrist() == Config::wnegative && sgn > 0)))
+			continue;
+		double theta4, theta6;
+		if (!singular)
+		{
+			// N的第三列为Rz(theta4)*v, 第三行为w*Rz(theta6)
+			const double v0 = s5*sa5, v1 = -ca4*c5*sa5 - sa4*ca5;
+			const double w0 = sa4*s5, w1 = sa4*c5*ca5 + ca4*sa5;
+			theta4 = atan2(N(1, 2), N(0, 2)) - atan2(v1, v0);
+			theta6 = atan2(w1, w0) - atan2(N(2, 1), N(2, 0));
+		}
+		else
+		{
+			// 第四轴与第六轴共线, 取theta4 = 0
+			theta4 = 0;
+			const HTransform3D<> K = HTransform3D<>::DHFast(sa4, ca4, 0, 0, s5, c5)*HTransform3D<>::DHFast(sa5, ca5, 0, 0, 0, 1);
+			const HTransform3D<> P = K.inverse()*N;
+			theta6 = atan2(P(1, 0), P(0, 0));
+		}
+		Q& result = q[count++];
+		if (result.size() != 6)
+			result = Q::zero(6);
+		for (int j=0; j<3; j++)
+			result(j) = arm.theta[j];
+		result(3) = common::fixAngle(theta4);
+		result(4) = atan2(s5, c5);
+		result(5) = common::fixAngle(theta6);
+		for (int j=0; j<6; j++)
+			result(j) -= _dHTable[j].theta();
+	}
+	return count;
+}
 
-    double d = b*b-4*a*c;
-    std::vector<double> result;
-    if (fabs(d) < 1e-12)
-        result.push_back(-b/(2*a));
-    else if (d>0) {
-        result.push_back((-b-sqrt(d))/(2*a));
-        result.push_back((-b+sqrt(d))/(2*a));
-    }
+Config PieperSolver::resolve(const Config& config) const
+{
+	if (config.getShoulder() != Config::ssame && config.getElbow() != Config::esame && config.getWrist() != Config::wsame)
+		return config;
+	const Config current = getConfig(_serialLink->getQ());
+	return Config(
+			(config.getShoulder() == Config::ssame) ? current.getShoulder() : config.getShoulder(),
+			(config.getElbow() == Config::esame) ? current.getElbow() : config.getElbow(),
+			(config.getWrist() == Config::wsame) ? current.getWrist() : config.getWrist());
+}
 
-    for (std::vector<double>::iterator it = result.begin(); it != result.end(); ++it) {
-        double u = *it;
-        double c3 = (1-u*u)/(1+u*u);
-        double s3 = 2*u/(1+u*u);
-        double theta3 = atan2(s3,c3);
-        (*it) = theta3;
-    }
+double PieperSolver::shoulderOf(double c2, double s2, double c3, double s3) const
+{
+	const double g1 = _U.value(c3, s3) + _a[2];
+	const double g2 = _ca[2]*_V.value(c3, s3) - _sa[2]*_W;
+	return c2*g1 - s2*g2 + _a[1];
+}
 
-    return result;
+bool PieperSolver::isValid() const
+{
+	if (_serialLink->getDOF() != 6)
+		return false;
+	const bool spherical = fabs(_a[4]) < 1e-12 && fabs(_d[4]) < 1e-12 && fabs(_a[5]) < 1e-12
+			&& fabs(_sa[4]) > 1e-12 && fabs(_sa[5]) > 1e-12;
+	return spherical && (fabs(_a[1]) > 1e-12 || fabs(_sa[1]) > 1e-12);
+}
 
+Config PieperSolver::getConfig(const Q& q) const
+{
+	if ((int)q.size() < 6)
+		throw("错误<PieperSolver::getConfig>: 关节角的长度不够!");
+	const double j2 = q[1] + _dHTable[1].theta();
+	const double j3 = q[2] + _dHTable[2].theta();
+	const double j5 = common::fixAngle(q[4] + _dHTable[4].theta());
+	const double c3 = cos(j3), s3 = sin(j3);
+	const int shoulder = (shoulderOf(cos(j2), sin(j2), c3, s3) < 0) ? Config::righty : Config::lefty;
+	const int elbow = (elbowOf(c3, s3) >= 0) ? Config::epositive : Config::enegative;
+	const int wrist = (j5 >= 0) ? Config::wpositive : Config::wnegative;
+	return Config(shoulder, elbow, wrist);
 }
 
-bool PieperSolver::isValid() const
+int PieperSolver::singularJudge(const Q& q) const
 {
-	if (a4==0&&a5==0&&d4==0&&(a1==0||fabs(sin(alpha1))<1e-12))
-		return true;
-	return false;
+	if ((int)q.size() < 6)
+		throw("错误<PieperSolver::singularJudge>: 关节角的长度不够!");
+	int result = 0;
+	const double j2 = q[1] + _dHTable[1].theta();
+	const double j3 = q[2] + _dHTable[2].theta();
+	const double c3 = cos(j3), s3 = sin(j3);
+	// 腕部中心到第一轴的距离
+	const double g1 = _U.value(c3, s3) + _a[2];
+	const double g2 = _ca[2]*_V.value(c3, s3) - _sa[2]*_W;
+	const double g3 = _G3.value(c3, s3);
+	const double hx = cos(j2)*g1 - sin(j2)*g2 + _a[1];
+	const double hy = _ca[1]*(sin(j2)*g1 + cos(j2)*g2) - _sa[1]*(g3 + _d[1]);
+	if (sqrt(hx*hx + hy*hy) < 0.1)
+		result += 4;
+	if (fabs(common::fixAngle(j3 - _elbowZero)) < 0.1)
+		result += 2;
+	if (fabs(sin(q[4] + _dHTable[4].theta())) < sin(0.1))
+		result += 1;
+	return result;
 }
 
 PieperSolver::~PieperSolver() {
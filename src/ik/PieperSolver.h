@@ -11,6 +11,8 @@
 # include "../math/Q.h"
 # include "../model/DHTable.h"
 # include "../model/SerialLink.h"
+# include "../model/Config.h"
+# include "IKSolver.h"
 
 namespace robot {
 namespace ik {
@@ -20,107 +22,231 @@ namespace ik {
  */
 
 /**
- * @brief Pieper逆解器
+ * @brief Pieper逆解器, 适用于末端三轴交于一点(球形手腕)的6轴机器人
  *
- * @warning 适用于Pieper逆解器的机器人模型必须满足: <br>
- * 	- 1. 末端三轴交于一点 <br>
- * 	- 2. 对于Modifed DH参数, 机器人第二个关节的a=0或者sin(alpha)=0
+ * 先由腕部中心的位置求解前三个关节, 再由姿态求解后三个关节. 前三个关节的求解与Craig的推导相同:
+ * 记腕部中心到第一轴原点距离的平方为r, 高度为z, 则
+ * @f$ r = k_3(\theta_3) + 2a_1(c_2g_1 - s_2g_2) @f$, @f$ z = s\alpha_1(s_2g_1 + c_2g_2) + c\alpha_1(g_3 + d_2) @f$.
+ * - @f$ a_1 = 0 @f$ 或 @f$ s\alpha_1 = 0 @f$ 时, 由一个式子直接解出theta3(最多2个), theta2各有两个根;
+ * - 一般情况下(例如新松机器人的@f$ a_1 \neq 0 @f$, 以及同时有偏置@f$ d_2 @f$的机器人), 消去theta2后
+ * 得到@f$ tan(\theta_3/2) @f$的四次方程, 用Ferrari公式直接求根, 再在原方程上做两步Newton迭代修正精度,
+ * 每个根对应唯一的theta2.
+ *
+ * 前三个关节最多4组解, 每组的手腕有两个解, 全部的基本解(最多8个)保存在IKSolutionSet中, 不申请内存.
+ *
+ * Config参数的含义与SiasunSR4CSolver相同(在新松机器人上两者给出的Config一致):
+ * - 肩部: 腕部中心在第一轴x方向上的坐标大于等于0时为lefty, 否则为righty;
+ * - 肘部: 以腕部中心离第二轴最远(手臂伸直)时的theta3为零点, 之后的半圈为epositive, 否则为enegative;
+ * - 腕部: theta5(-180~180)大于等于0时为wpositive, 否则为wnegative.
+ *
+ * @warning 适用于Pieper逆解器的机器人模型必须满足(Modified DH参数, 下标从0开始): <br>
+ * 	- 1. 末端三轴交于一点: @f$ a_4 = 0, d_5 = 0, a_5 = 0 @f$, 且@f$ s\alpha_4 \neq 0, s\alpha_5 \neq 0 @f$ <br>
+ * 	- 2. @f$ a_1 \neq 0 @f$ 或者 @f$ s\alpha_1 \neq 0 @f$ <br>
+ * 	末端的@f$ d_6 @f$和tool不受限制.
  */
-class PieperSolver {
+class PieperSolver: public IKSolver {
 public:
 	/**
 	 * @brief 构造Pieper逆解器
-	 * @param serialRobot [in] 机器人模型
+	 * @param serialRobot [in] 机器人模型, 不满足isValid时抛出异常
+	 */
+	PieperSolver(robot::model::SerialLink::ptr serialRobot);
+
+	/**
+	 * @brief 初始化函数, 当模型(或tool)改变时, 可以重新计算参数, 一般不需要调用
+	 */
+	void init();
+
+	/**
+	 * @brief 逆运动学求解
+	 * @param baseTend [in] 基坐标系到执行末端的变换矩阵
+	 * @param config [in] 逆解的Config参数
+	 * @return 关节范围内的全部解(包括加减2pi的组合). 没有解时抛出异常
+	 *
+	 * 由solveInto实现
+	 */
+	std::vector<Q> solve(const HTransform3D<>& baseTend, const model::Config& config) const;
+
+	/**
+	 * @brief 逆运动学求解, 不申请内存, 不抛出异常
+	 * @param baseTend [in] 基坐标系到执行末端的变换矩阵
+	 * @param config [in] 逆解的Config参数
+	 * @param result [out] 逆解结果(先清空), 最多8个基本解
+	 * @return 结果状态
 	 */
-	PieperSolver(robot::model::SerialLink& serialRobot);
+	IKStatus solveInto(const HTransform3D<>& baseTend, const model::Config& config, IKSolutionSet& result) const;
 
 	/**
-	 * @brief 初始化函数, 当模型改变时, 可以重新计算参数, 一般不需要调用
+	 * @brief 取最接近qPrev的解
+	 * @param config [in] 逆解的Config参数, 其中free或same的部位锁定在qPrev所在的分支
+	 *
+	 * 参见IKSolver::solveNearest
 	 */
-    void init();
+	IKStatus solveNearest(const HTransform3D<>& baseTend, const model::Config& config, const Q& qPrev, Q& result) const;
 
-    /**
-     * @brief Pieper法机器人逆运动学求解
-     * @param baseTend 从基坐标系到执行末端的变换矩阵
-     * @return 若有多个解, 则都返回
-     */
-    std::vector<Q> solve(const HTransform3D<>& baseTend) const;
-    void solveTheta456(double theta1,
-                       double theta2,
-                       double theta3,
-                       robot::math::HTransform3D<>& T06,
-                       std::vector<robot::math::Q>& result) const;
+	/**
+	 * @brief 判断机器人模型可否由该逆解器求解, 条件见类的说明
+	 * @retval true 可以求解
+	 * @retval false 不可求解
+	 */
+	bool isValid() const;
 
+	/**
+	 * @brief 分析关节角所满足的Config参数
+	 * @param q [in] 要分析的关节角度数组
+	 * @return 只会明式地给出lefty/righty, epositive/enegative, wpositive/wnegative
+	 */
+	robot::model::Config getConfig(const robot::math::Q& q) const;
 
-    /**
-     * @brief Solves the case with a1 = 0 (Case 1 in Craig)
-     */
-    std::vector<double> solveTheta3Case1(double z) const;
+	/**
+	 * @brief 获取机器人模型指针
+	 */
+	inline robot::model::SerialLink::ptr getRobot() const{ return _serialLink;}
 
-    /**
-     * @brief Solves the case with a1 != 0 and sin(alpha1) = 0 (Case 2 in Craig)
-     */
-    std::vector<double> solveTheta3Case2(double r) const;
+	/**
+	 * @brief 判断奇异
+	 * @param q [in] 关节角度
+	 * @retval 0 无奇异
+	 * @retval 1~7 有奇异, 含义与SiasunSR4CSolver::singularJudge相同: 4为肩部(腕部中心接近第一轴),
+	 * 2为肘部(手臂接近伸直), 1为腕部(第四轴与第六轴接近共线)
+	 */
+	int singularJudge(const robot::math::Q& q) const;
 
-    /**
-     * @brief Solves the general case with a1 != 0 and sin(alpha1) != 0 (Case 3 in Craig)
-     */
-//    std::vector<double> solveTheta3Case3(double r, double z) const;
+	virtual ~PieperSolver();
+private:
+	/**
+	 * @brief @f$ c*cos(\theta_3) + s*sin(\theta_3) + k @f$
+	 */
+	struct TrigForm {
+		double c, s, k;
 
+		inline double value(double c3, double s3) const
+		{
+			return c*c3 + s*s3 + k;
+		}
 
-//    double solveTheta2(double r, double z, double theta3) const;
+		/** @brief 对theta3的导数 */
+		inline double derivative(double c3, double s3) const
+		{
+			return s*c3 - c*s3;
+		}
+	};
 
-    std::vector<double> solveTheta2Case1(double z, double theta3) const;
-    std::vector<double> solveTheta2Case2(double r, double theta3) const;
+	/**
+	 * @brief 前三个关节的一个解
+	 */
+	struct Arm {
+		/** @brief theta1~3(未减去DH参数中的theta) */
+		double theta[3];
 
-    double solveTheta1(double x, double y, double theta2, double theta3) const;
+		/** @brief theta1~3的cos和sin */
+		double c[3], s[3];
+	};
 
-    /**
-     * @brief 判断可否通过该逆解器求解
-     *
-     * 判断条件为: <br>
-     * @f$ \begin{array}{ccc}
-     *  a_4=0 & d_4=0\\
-     *  a_5=0 & \left (a_1=0\ or\ sin(\alpha_1) = 0\right )
-     *  \end{array}
-     *  @f$
-     * @retval true 成功
-     * @retval flase 失败
-     */
-    bool isValid() const;
+	/**
+	 * @brief 求解前三个关节, 结果已满足config中的肩部和肘部约束
+	 * @param T06 [in] 0关节到6关节(不含d6)的变换矩阵
+	 * @param config [in] Config参数(same已替换为明确的值)
+	 * @param arm [out] 解, 至少能保存4个
+	 * @return 解的个数, 最多4个
+	 */
+	int solveArm(const robot::math::HTransform3D<>& T06, const model::Config& config, Arm* arm) const;
 
-    inline robot::model::SerialLink::ptr getRobot(){ return _serialRobot;}
+	/**
+	 * @brief 求解theta3, 结果为cos和sin
+	 * @param r [in] 腕部中心到第一轴原点距离的平方
+	 * @param z [in] 腕部中心的高度
+	 * @param c3 [out] 最多4个
+	 * @param s3 [out] 最多4个
+	 * @return 解的个数
+	 */
+	int solveTheta3(double r, double z, double* c3, double* s3) const;
 
-	virtual ~PieperSolver();
+	/**
+	 * @brief 由前三个关节求解theta4~6, 结果已满足config中的腕部约束. q中写入全部关节(已减去DH参数中的theta)
+	 * @param arm [in] 前三个关节
+	 * @param T06 [in] 0关节到6关节的变换矩阵
+	 * @param config [in] Config参数(same已替换为明确的值)
+	 * @param q [out] 解, 至少能保存2个
+	 * @return 解的个数, 最多2个
+	 */
+	int solveWrist(const Arm& arm, const robot::math::HTransform3D<>& T06, const model::Config& config, robot::math::Q* q) const;
+
+	/**
+	 * @brief 求解满足config的全部基本解
+	 * @param q [out] 解, 至少能保存8个
+	 * @return 解的个数
+	 */
+	int solveAll(const HTransform3D<>& baseTend, const model::Config& config, robot::math::Q* q) const;
+
+	/**
+	 * @brief 把config中的same替换为机器人当前关节角所在的分支
+	 */
+	model::Config resolve(const model::Config& config) const;
+
+	/**
+	 * @brief 由theta2, theta3计算腕部中心在第一轴坐标系中的x坐标(肩部的判断依据)
+	 */
+	double shoulderOf(double c2, double s2, double c3, double s3) const;
+
+	/**
+	 * @brief 肘部的判断依据, 大于等于0为epositive
+	 */
+	inline double elbowOf(double c3, double s3) const
+	{
+		return _K3.c*s3 - _K3.s*c3;
+	}
 private:
 	/**
 	 * @brief Modified DH 参数表
 	 */
 	robot::model::DHTable _dHTable;
-//    robot::math::HTransform3D<> _baseTdhRef;
+
+	/**
+	 * @brief DH参数, 下标为关节的索引
+	 */
+	double _a[6], _d[6], _sa[6], _ca[6];
+
+	/**
+	 * @brief 腕部中心在第三关节坐标系中的位置(含d3)
+	 *
+	 * 由它可以得到腕部中心在第二关节坐标系中的位置g:
+	 * @f$ g_1 = U + a_2 @f$, @f$ g_2 = c\alpha_2 V - s\alpha_2 W @f$, @f$ g_3 = s\alpha_2 V + c\alpha_2 W @f$
+	 */
+	TrigForm _U, _V;
+	double _W;
+
+	/** @brief @f$ g_3 @f$ */
+	TrigForm _G3;
+
+	/** @brief @f$ k_3 = g_1^2 + g_2^2 + (g_3 + d_2)^2 + a_1^2 @f$ */
+	TrigForm _K3;
+
+	/** @brief @f$ g_1^2 + g_2^2 + g_3^2 - 2a_2U @f$(常数) */
+	double _G;
+
+	/** @brief 手臂伸直(腕部中心离第二轴最远)时的theta3 */
+	double _elbowZero;
+
+	/**
+	 * @brief 0: 一般情况; 1: a1=0; 2: sin(alpha1)=0
+	 */
+	int _case;
 
 	/**
 	 * @brief 从基座到0关节的变换矩阵
 	 */
-    robot::math::HTransform3D<> _0Tbase;
-
-    /**
-     * @brief 从末端执行器到6关节的变换矩阵
-     */
-    robot::math::HTransform3D<> _endTjoint6;
-    /*
-     * Variables used for calculating
-     * Defined here to avoid allocating memory for them all the time
-     */
-//    mutable double a,b,c,d,e;
-    mutable double alpha0, a0, calpha0, salpha0, d1;
-    mutable double alpha1, a1, calpha1, salpha1, d2;
-    mutable double alpha2, a2, calpha2, salpha2, d3;
-    mutable double alpha3, a3, calpha3, salpha3, d4;
-    mutable double alpha4, a4, calpha4, salpha4, d5;
-    mutable double alpha5, a5, calpha5, salpha5, d6;
-
-    robot::model::SerialLink::ptr _serialRobot;
+	robot::math::HTransform3D<> _0Tbase;
+
+	/**
+	 * @brief 从末端执行器到6关节的变换矩阵
+	 */
+	robot::math::HTransform3D<> _endTjoint6;
+
+	/**
+	 * @brief 机器人的模型
+	 */
+	robot::model::SerialLink::ptr _serialLink;
 };
 
 /** @} */
@@ -0,0 +1,412 @@
+/*
+ * ReachabilityMap.cpp
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: a1994846931931
+ */
+
+# include "ReachabilityMap.h"
+# include "../model/FixedJacobian.h"
+# include <sys/mman.h>
+# include <sys/stat.h>
+# include <fcntl.h>
+# include <unistd.h>
+# include <errno.h>
+# include <string.h>
+# include <stdio.h>
+# include <math.h>
+
+using robot::math::Q;
+using robot::math::Vector3D;
+using robot::math::Rotation3D;
+using robot::model::SerialLink;
+using robot::model::Config;
+using robot::model::FixedJacobian;
+using robot::common::ExecPolicy;
+
+namespace robot {
+namespace ik {
+
+namespace {
+
+const char magic[8] = {'R', 'C', 'H', 'M', 'A', 'P', 0, 0};
+
+/**
+ * @brief 各采样姿态的z轴, 第一次使用时计算
+ */
+struct OrientationAxes {
+	Vector3D<double> z[ReachabilityMap::orientationCount];
+
+	OrientationAxes()
+	{
+		for (int i=0; i<ReachabilityMap::orientationCount; i++)
+		{
+			const Rotation3D<double> rotation = ReachabilityMap::orientation(i);
+			z[i] = Vector3D<double>(rotation(0, 2), rotation(1, 2), rotation(2, 2));
+		}
+	}
+};
+
+const OrientationAxes& orientationAxes()
+{
+	static const OrientationAxes axes;
+	return axes;
+}
+
+}
+
+const double ReachabilityMap::orientationRadius = 0.5;
+
+ReachabilityMap::ReachabilityMap() : _data(NULL), _size(0), _header(NULL), _voxels(NULL)
+{
+}
+
+void ReachabilityMap::map(const std::string& fileName, bool writable, size_t size)
+{
+	const int fd = writable ? open(fileName.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644) : open(fileName.c_str(), O_RDONLY);
+	if (fd < 0)
+		throw (std::string("错误<ReachabilityMap>: 无法打开文件") + fileName + ": " + strerror(errno));
+	if (writable)
+	{
+		if (ftruncate(fd, size) != 0)
+		{
+			close(fd);
+			throw (std::string("错误<ReachabilityMap>: 无法写入文件") + fileName + ": " + strerror(errno));
+		}
+	}
+	else
+	{
+		struct stat status;
+		if (fstat(fd, &status) != 0 || (size_t)status.st_size < sizeof(Header))
+		{
+			close(fd);
+			throw (std::string("错误<ReachabilityMap>: 不是可达性地图文件: ") + fileName);
+		}
+		size = status.st_size;
+	}
+	void* data = mmap(NULL, size, writable ? (PROT_READ | PROT_WRITE) : PROT_READ, MAP_SHARED, fd, 0);
+	close(fd); //映射建立后不再需要文件描述符
+	if (data == MAP_FAILED)
+		throw (std::string("错误<ReachabilityMap>: 无法映射文件") + fileName + ": " + strerror(errno));
+	_data = data;
+	_size = size;
+	_header = (const Header*)data;
+	_voxels = (const Voxel*)((const char*)data + sizeof(Header));
+}
+
+ReachabilityMap::ptr ReachabilityMap::build(IKSolver::ptr solver, double resolution, const std::string& fileName, const ExecPolicy& policy)
+{
+	if (resolution <= 0)
+		throw ("错误<ReachabilityMap>: 体素边长必须大于0!");
+	SerialLink::ptr robot = solver->getRobot();
+	if (robot->getDOF() != 6)
+		throw ("错误<ReachabilityMap>: 只支持6轴机器人!");
+
+	/**> 立方体的边长为工作空间的直径, 每边多留一个体素 */
+	double reach = robot->getTool()->getTransform().getPosition().getLength();
+	for (int i=0; i<robot->getDOF(); i++)
+		reach += fabs(robot->getLink(i)->a()) + fabs(robot->getLink(i)->d());
+	const int n = (int)ceil(2*reach/resolution) + 2;
+	const int count = n*n*n;
+
+	/**> 先写入临时文件再改名, 已经映射了旧文件的地图不受影响 */
+	const std::string tempName = fileName + ".tmp";
+	ptr result(new ReachabilityMap());
+	result->map(tempName, true, sizeof(Header) + (size_t)count*sizeof(Voxel));
+	Header* header = (Header*)result->_data;
+	memset(header, 0, sizeof(Header));
+	memcpy(header->magic, magic, sizeof(magic));
+	header->version = version;
+	header->orientationCount = orientationCount;
+	header->modelHash = modelHash(*robot);
+	header->resolution = resolution;
+	header->voxelSize = sizeof(Voxel);
+	for (int k=0; k<3; k++)
+	{
+		header->origin[k] = -0.5*n*resolution;
+		header->dims[k] = n;
+	}
+
+	Rotation3D<double> rotations[orientationCount];
+	for (int i=0; i<orientationCount; i++)
+		rotations[i] = orientation(i);
+	const double origin = header->origin[0];
+	Voxel* voxels = (Voxel*)result->_voxels;
+	/**> 有的逆解器在wfree时每组前三轴只给出一个手腕的解, 因此两个腕部分支分别求解 */
+	const Config wristConfig[2] = {Config(Config::sfree, Config::efree, Config::wpositive), Config(Config::sfree, Config::efree, Config::wnegative)};
+	policy.run(count, [&](int begin, int end){
+		IKSolutionSet solutions;
+		FixedJacobian<6, 6> jacobian;
+		for (int index=begin; index<end; index++)
+		{
+			const Vector3D<double> center(origin + (index%n + 0.5)*resolution, origin + ((index/n)%n + 0.5)*resolution,
+					origin + (index/(n*n) + 0.5)*resolution);
+			Voxel voxel;
+			memset(&voxel, 0, sizeof(Voxel));
+			for (int i=0; i<orientationCount; i++)
+			{
+				for (int wrist=0; wrist<2; wrist++)
+				{
+					if (solver->solveInto(HTransform3D<double>(center, rotations[i]), wristConfig[wrist], solutions) != ikSuccess)
+						continue;
+					voxel.orientations |= (1u << i);
+					for (int k=0; k<solutions.baseSize(); k++)
+					{
+						const Q& q = solutions.base(k);
+						voxel.orientationConfigs[i] |= branchMask(solver->getConfig(q));
+						voxel.configs |= voxel.orientationConfigs[i];
+						robot->getJacobian(robot->getJointTrig(q), jacobian);
+						const float w = (float)fabs(jacobian.matrix().determinant());
+						voxel.manipulability = (w > voxel.manipulability) ? w : voxel.manipulability;
+					}
+				}
+			}
+			voxels[index] = voxel;
+		}
+	});
+	msync(result->_data, result->_size, MS_SYNC);
+	if (rename(tempName.c_str(), fileName.c_str()) != 0)
+		throw (std::string("错误<ReachabilityMap>: 无法写入文件") + fileName + ": " + strerror(errno));
+	return result;
+}
+
+ReachabilityMap::ptr ReachabilityMap::load(const std::string& fileName, const SerialLink& robot)
+{
+	ptr result(new ReachabilityMap());
+	result->map(fileName, false, 0);
+	const Header& header = *result->_header;
+	if (memcmp(header.magic, magic, sizeof(magic)) != 0 || header.version != version || header.orientationCount != orientationCount
+			|| header.voxelSize != sizeof(Voxel) || header.dims[0] <= 0 || header.dims[1] <= 0 || header.dims[2] <= 0
+			|| result->_size != sizeof(Header) + (size_t)result->size()*sizeof(Voxel))
+		throw (std::string("错误<ReachabilityMap>: 不是可达性地图文件或版本不同: ") + fileName);
+	if (header.modelHash != modelHash(robot))
+		throw (std::string("错误<ReachabilityMap>: 地图文件与机器人模型不符: ") + fileName);
+	return result;
+}
+
+ReachabilityMap::ptr ReachabilityMap::loadOrBuild(const std::string& directory, IKSolver::ptr solver, double resolution, const ExecPolicy& policy)
+{
+	const std::string fileName = defaultFileName(directory, *solver->getRobot());
+	try
+	{
+		ptr result = load(fileName, *solver->getRobot());
+		if (result->header().resolution == resolution)
+			return result;
+	}
+	catch (std::string& msg)
+	{
+		//文件不存在或已过期, 重新生成
+	}
+	return build(solver, resolution, fileName, policy);
+}
+
+uint64_t ReachabilityMap::modelHash(const SerialLink& robot)
+{
+	// FNV-1a
+	uint64_t hash = 14695981039346656037ull;
+	auto mix = [&hash](double value){
+		uint64_t bits;
+		memcpy(&bits, &value, sizeof(bits));
+		for (int i=0; i<8; i++)
+		{
+			hash ^= (bits >> (8*i)) & 0xff;
+			hash *= 1099511628211ull;
+		}
+	};
+	mix(robot.getDOF());
+	for (int i=0; i<robot.getDOF(); i++)
+	{
+		const robot::model::Link::ptr link = robot.getLink(i);
+		mix(link->alpha());
+		mix(link->a());
+		mix(link->d());
+		mix(link->theta());
+		mix(link->lmin());
+		mix(link->lmax());
+	}
+	const HTransform3D<double>& tool = robot.getTool()->getTransform();
+	for (int r=0; r<3; r++)
+		for (int c=0; c<4; c++)
+			mix(tool(r, c));
+	return hash;
+}
+
+std::string ReachabilityMap::defaultFileName(const std::string& directory, const SerialLink& robot)
+{
+	char name[64];
+	snprintf(name, sizeof(name), "reach_%016llx.map", (unsigned long long)modelHash(robot));
+	return directory + "/" + name;
+}
+
+uint8_t ReachabilityMap::branchMask(const Config& config)
+{
+	const int shoulder = config.getShoulder(), elbow = config.getElbow(), wrist = config.getWrist();
+	uint8_t mask = 0;
+	for (int s=0; s<2; s++)
+	{
+		if ((shoulder == Config::righty && s == 0) || (shoulder == Config::lefty && s == 1))
+			continue;
+		for (int e=0; e<2; e++)
+		{
+			if ((elbow == Config::epositive && e == 0) || (elbow == Config::enegative && e == 1))
+				continue;
+			for (int w=0; w<2; w++)
+			{
+				if ((wrist == Config::wpositive && w == 0) || (wrist == Config::wnegative && w == 1))
+					continue;
+				mask |= (1 << (s*4 + e*2 + w));
+			}
+		}
+	}
+	return mask;
+}
+
+bool ReachabilityMap::cellOf(const Vector3D<double>& position, int* cell) const
+{
+	for (int k=0; k<3; k++)
+	{
+		const double f = (position(k) - _header->origin[k])/_header->resolution;
+		if (f < 0 || f >= _header->dims[k])
+			return false;
+		cell[k] = (int)f;
+	}
+	return true;
+}
+
+const ReachabilityMap::Voxel* ReachabilityMap::voxel(const Vector3D<double>& position) const
+{
+	int cell[3];
+	if (!cellOf(position, cell))
+		return NULL;
+	return &_voxels[(cell[2]*_header->dims[1] + cell[1])*_header->dims[0] + cell[0]];
+}
+
+bool ReachabilityMap::reachable(const Vector3D<double>& position, const Config& config) const
+{
+	const Voxel* v = voxel(position);
+	return (v != NULL) && (v->configs & branchMask(config));
+}
+
+bool ReachabilityMap::mayReach(const Vector3D<double>& position, const Config& config) const
+{
+	return mayReach(position, branchMask(config), 0);
+}
+
+bool ReachabilityMap::mayReach(const HTransform3D<double>& pose, const Config& config) const
+{
+	return mayReach(pose.getPosition(), branchMask(config), nearbyOrientations(pose.getRotation()));
+}
+
+bool ReachabilityMap::mayReach(const Vector3D<double>& position, uint8_t configMask, uint32_t orientations) const
+{
+	int cell[3];
+	if (!cellOf(position, cell))
+		return false;
+	const int* dims = _header->dims;
+	for (int z=cell[2]-1; z<=cell[2]+1; z++)
+	{
+		if (z < 0 || z >= dims[2])
+			continue;
+		for (int y=cell[1]-1; y<=cell[1]+1; y++)
+		{
+			if (y < 0 || y >= dims[1])
+				continue;
+			for (int x=cell[0]-1; x<=cell[0]+1; x++)
+			{
+				if (x < 0 || x >= dims[0])
+					continue;
+				const Voxel& v = _voxels[(z*dims[1] + y)*dims[0] + x];
+				if (orientations == 0)
+				{
+					if (v.configs & configMask)
+						return true;
+					continue;
+				}
+				for (int i=0; i<orientationCount; i++)
+					if (((orientations >> i) & 1) && (v.orientationConfigs[i] & configMask))
+						return true;
+			}
+		}
+	}
+	return false;
+}
+
+bool ReachabilityMap::mayReachPath(const std::function<HTransform3D<double>(double)>& pose, double length, const Config& config) const
+{
+	const uint8_t configMask = branchMask(config);
+	const double step = 0.5*_header->resolution;
+	const int count = (int)ceil(length/step);
+	for (int i=0; i<=count; i++)
+	{
+		const double s = (i*step < length) ? i*step : length;
+		const HTransform3D<double> current = pose(s);
+		if (!mayReach(current.getPosition(), configMask, nearbyOrientations(current.getRotation())))
+			return false;
+	}
+	return true;
+}
+
+double ReachabilityMap::manipulability(const Vector3D<double>& position) const
+{
+	const Voxel* v = voxel(position);
+	return (v == NULL) ? 0 : v->manipulability;
+}
+
+uint32_t ReachabilityMap::orientations(const Vector3D<double>& position) const
+{
+	const Voxel* v = voxel(position);
+	return (v == NULL) ? 0 : v->orientations;
+}
+
+Rotation3D<double> ReachabilityMap::orientation(int index)
+{
+	/**> z轴取球面上的Fibonacci点 */
+	const double z = 1 - (2.0*index + 1)/orientationCount;
+	const double r = sqrt(1 - z*z);
+	const double phi = index*M_PI*(3 - sqrt(5.0));
+	const Vector3D<double> k(r*cos(phi), r*sin(phi), z);
+	Vector3D<double> i = Vector3D<double>::cross((fabs(z) < 0.9) ? Vector3D<double>(0, 0, 1) : Vector3D<double>(1, 0, 0), k);
+	i.doNormalize();
+	const Vector3D<double> j = Vector3D<double>::cross(k, i);
+	return Rotation3D<double>(i, j, k);
+}
+
+int ReachabilityMap::nearestOrientation(const Rotation3D<double>& rotation)
+{
+	const OrientationAxes& axes = orientationAxes();
+	int nearest = 0;
+	double maxCos = -2;
+	for (int i=0; i<orientationCount; i++)
+	{
+		const double c = rotation(0, 2)*axes.z[i](0) + rotation(1, 2)*axes.z[i](1) + rotation(2, 2)*axes.z[i](2);
+		if (c > maxCos)
+		{
+			maxCos = c;
+			nearest = i;
+		}
+	}
+	return nearest;
+}
+
+uint32_t ReachabilityMap::nearbyOrientations(const Rotation3D<double>& rotation)
+{
+	const OrientationAxes& axes = orientationAxes();
+	const double minCos = cos(orientationRadius);
+	uint32_t result = (1u << nearestOrientation(rotation));
+	for (int i=0; i<orientationCount; i++)
+	{
+		const double c = rotation(0, 2)*axes.z[i](0) + rotation(1, 2)*axes.z[i](1) + rotation(2, 2)*axes.z[i](2);
+		if (c >= minCos)
+			result |= (1u << i);
+	}
+	return result;
+}
+
+ReachabilityMap::~ReachabilityMap()
+{
+	if (_data != NULL)
+		munmap(_data, _size);
+}
+
+} /* namespace ik */
+} /* namespace robot */
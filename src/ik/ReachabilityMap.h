@@ -0,0 +1,277 @@
+/**
+ * @brief ReachabilityMap类
+ * @date Oct 16, 2026
+ * @author a1994846931931
+ */
+
+#ifndef REACHABILITYMAP_H_
+#define REACHABILITYMAP_H_
+
+# include "../math/HTransform3D.h"
+# include "../math/Vector3D.h"
+# include "../model/SerialLink.h"
+# include "../model/Config.h"
+# include "../common/ThreadPool.h"
+# include "IKSolver.h"
+# include <stdint.h>
+# include <string>
+# include <functional>
+# include <memory>
+
+namespace robot {
+namespace ik {
+
+/** @addtogroup ik
+ * @{
+ */
+
+/**
+ * @brief 预先计算的可达性体素地图, 保存在内存映射的二进制文件中
+ *
+ * 把以基座原点为中心, 边长为工作空间直径(所有连杆长度之和的两倍)的立方体分成边长为resolution的体素.
+ * 在每个体素中心, 用orientationCount个末端姿态(z轴均匀分布在球面上)逆解(肩部和肘部为free, 腕部两个分支分别求解), 记录:
+ * - configs: 有解的Config分支(肩部, 肘部, 腕部各两种, 共8个分支), 第(s*4 + e*2 + w)位,
+ *   其中righty, epositive, wpositive为1, lefty, enegative, wnegative为0;
+ * - orientations: 有解的姿态, 第i位对应第i个姿态;
+ * - orientationConfigs: 每个姿态有解的Config分支, configs和orientations是它的汇总;
+ * - manipulability: 所有解中最大的@f$ |det(J)| @f$.
+ *
+ * 各体素相互独立, build在线程池中并行计算, 结果直接写入映射的文件. 文件头中保存了机器人模型的散列值
+ * (DH参数, 关节范围和tool), 模型不符时load抛出异常; loadOrBuild以散列值作为文件名, 模型改变后自动重新生成.
+ * 加载只需要mmap, 不读取文件内容, 查询一个点是O(1)的数组访问.
+ *
+ * 地图只在体素中心和有限个姿态上采样, 用于规划前的快速筛选: mayReach同时检查相邻的26个体素,
+ * 只有整个邻域都没有所需的Config分支(给出位姿时, 为z轴与末端z轴的夹角在orientationRadius以内的各采样姿态的
+ * Config分支)时才认为不可到达. 通过筛选的路径仍然需要逐点逆解; 采样不能保证严格保守, 未通过筛选的路径
+ * 也应当由逆解确认(见LinePlanner::prescreen).
+ *
+ * @code
+ * ReachabilityMap::ptr map = ReachabilityMap::loadOrBuild("/var/robot", solver, 0.05);
+ * planner.setReachabilityMap(map);
+ * if (!planner.prescreen()) planner.query(); //可能不可到达, 逆解确认
+ * @endcode
+ *
+ * @warning 只支持6轴机器人(POSIX文件映射). 地图与逆解器的关节范围有关, 修改关节范围后需要重新生成.
+ */
+class ReachabilityMap {
+public:
+	using ptr = std::shared_ptr<ReachabilityMap>;
+
+	/** @brief 每个体素采样的姿态个数 */
+	static const int orientationCount = 32;
+
+	/**
+	 * @brief 位姿筛选时使用的采样姿态范围: z轴夹角(rad)
+	 *
+	 * 32个采样姿态的z轴对球面的覆盖半径约为0.481rad, 即任意方向与最接近的采样姿态最多相差这么多.
+	 */
+	static const double orientationRadius;
+
+	/** @brief 文件格式的版本 */
+	static const uint32_t version = 2;
+
+	/**
+	 * @brief 文件头
+	 */
+	struct Header {
+		/** @brief "RCHMAP\0\0" */
+		char magic[8];
+		uint32_t version;
+		uint32_t orientationCount;
+
+		/** @brief 机器人模型的散列值 */
+		uint64_t modelHash;
+
+		/** @brief 第一个体素的最小角点 */
+		double origin[3];
+
+		/** @brief 体素边长(m) */
+		double resolution;
+
+		/** @brief x, y, z方向的体素个数 */
+		int32_t dims[3];
+
+		/** @brief sizeof(Voxel) */
+		uint32_t voxelSize;
+	};
+
+	/**
+	 * @brief 一个体素的数据, 按x, y, z的顺序(x变化最快)保存在文件头之后
+	 */
+	struct Voxel {
+		/** @brief 有解的姿态 */
+		uint32_t orientations;
+
+		/** @brief 有解的Config分支 */
+		uint8_t configs;
+
+		uint8_t reserved[3];
+
+		/** @brief 最大的|det(J)| */
+		float manipulability;
+
+		/** @brief 第i个姿态有解的Config分支 */
+		uint8_t orientationConfigs[orientationCount];
+	};
+
+	/**
+	 * @brief 计算可达性地图并写入文件
+	 * @param solver [in] 逆解器, 需要可以在多个线程中同时使用(例如SiasunSR4CSolver, PieperSolver)
+	 * @param resolution [in] 体素边长(m)
+	 * @param fileName [in] 文件名, 已存在时替换(先写入fileName.tmp再改名, 已经加载的旧地图仍然有效)
+	 * @param policy [in] 执行策略, 默认在全局线程池中每64个体素一块并行计算
+	 * @return 已映射的地图. 文件无法写入时抛出异常
+	 */
+	static ptr build(IKSolver::ptr solver, double resolution, const std::string& fileName,
+			const robot::common::ExecPolicy& policy=robot::common::ExecPolicy(robot::common::ExecPolicy::parallel, 64));
+
+	/**
+	 * @brief 映射已有的地图文件
+	 * @param fileName [in] 文件名
+	 * @param robot [in] 机器人模型, 与文件中的散列值不符时抛出异常
+	 * @return 地图. 文件不存在或格式错误时抛出异常
+	 */
+	static ptr load(const std::string& fileName, const robot::model::SerialLink& robot);
+
+	/**
+	 * @brief 映射directory中与机器人模型对应的地图文件, 不存在(或精度不同)时计算并保存
+	 * @param directory [in] 保存地图文件的目录
+	 * @param solver [in] 逆解器
+	 * @param resolution [in] 体素边长(m)
+	 * @param policy [in] 执行策略
+	 * @return 地图
+	 */
+	static ptr loadOrBuild(const std::string& directory, IKSolver::ptr solver, double resolution,
+			const robot::common::ExecPolicy& policy=robot::common::ExecPolicy(robot::common::ExecPolicy::parallel, 64));
+
+	/**
+	 * @brief 机器人模型的散列值(FNV-1a), 包括DH参数, 关节范围和tool
+	 */
+	static uint64_t modelHash(const robot::model::SerialLink& robot);
+
+	/**
+	 * @brief loadOrBuild使用的文件名: directory/reach_<散列值>.map
+	 */
+	static std::string defaultFileName(const std::string& directory, const robot::model::SerialLink& robot);
+
+	/**
+	 * @brief Config对应的分支位
+	 * @return free或same的部位两个分支都包括
+	 */
+	static uint8_t branchMask(const robot::model::Config& config);
+
+	/**
+	 * @brief 点所在的体素
+	 * @return 在地图之外时为NULL
+	 */
+	const Voxel* voxel(const robot::math::Vector3D<double>& position) const;
+
+	/**
+	 * @brief 点所在的体素中心是否可以以config到达
+	 */
+	bool reachable(const robot::math::Vector3D<double>& position, const robot::model::Config& config) const;
+
+	/**
+	 * @brief 点是否可能以config到达: 所在体素或相邻的体素中心可以到达
+	 * @retval false 可以确定不可到达(在地图之外, 或者整个邻域都没有所需的分支)
+	 */
+	bool mayReach(const robot::math::Vector3D<double>& position, const robot::model::Config& config) const;
+
+	/**
+	 * @brief 位姿是否可能以config到达: 所在体素或相邻的体素中心, 在nearbyOrientations的任一采样姿态上有config的解
+	 * @retval false 在地图之外, 或者整个邻域在这些姿态上都没有所需的分支
+	 *
+	 * 采样姿态只区分z轴的方向, 绕z轴的转动由第6轴补偿, 不影响可达性.
+	 * @warning 不是严格保守的: siasun6在resolution = 0.1时, 随机关节角的末端位姿约有0.03%被拒绝.
+	 */
+	bool mayReach(const robot::math::HTransform3D<double>& pose, const robot::model::Config& config) const;
+
+	/**
+	 * @brief 路径是否可能以config到达, 以resolution/2为间隔检查位姿的mayReach
+	 * @param pose [in] 长度s处的位姿, s从0到length
+	 * @param length [in] 路径长度(m)
+	 * @param config [in] Config参数
+	 */
+	bool mayReachPath(const std::function<robot::math::HTransform3D<double>(double)>& pose, double length,
+			const robot::model::Config& config) const;
+
+	/**
+	 * @brief 点所在体素的可操作度, 在地图之外时为0
+	 */
+	double manipulability(const robot::math::Vector3D<double>& position) const;
+
+	/**
+	 * @brief 点所在体素有解的姿态, 在地图之外时为0
+	 */
+	uint32_t orientations(const robot::math::Vector3D<double>& position) const;
+
+	/**
+	 * @brief 第index个采样姿态
+	 */
+	static robot::math::Rotation3D<double> orientation(int index);
+
+	/**
+	 * @brief z轴与rotation的z轴夹角最小的采样姿态
+	 * @return 采样姿态的序号, 对应orientations()的第几位
+	 */
+	static int nearestOrientation(const robot::math::Rotation3D<double>& rotation);
+
+	/**
+	 * @brief z轴与rotation的z轴夹角在orientationRadius以内的采样姿态, 总是包括nearestOrientation
+	 * @return 第i位对应第i个采样姿态
+	 */
+	static uint32_t nearbyOrientations(const robot::math::Rotation3D<double>& rotation);
+
+	/** @brief 文件头 */
+	inline const Header& header() const
+	{
+		return *_header;
+	}
+
+	/** @brief 第index个体素 */
+	inline const Voxel& voxel(int index) const
+	{
+		return _voxels[index];
+	}
+
+	/** @brief 体素总数 */
+	inline int size() const
+	{
+		return _header->dims[0]*_header->dims[1]*_header->dims[2];
+	}
+
+	virtual ~ReachabilityMap();
+private:
+	ReachabilityMap();
+
+	/**
+	 * @brief 计算体素的坐标
+	 * @retval false 在地图之外
+	 */
+	bool cellOf(const robot::math::Vector3D<double>& position, int* cell) const;
+
+	/**
+	 * @brief 位置所在体素及相邻的26个体素中是否有一个在orientations中的某个姿态上有configMask中的分支
+	 * @param orientations [in] 采样姿态, 第i位对应第i个姿态, 为0时为任意姿态
+	 */
+	bool mayReach(const robot::math::Vector3D<double>& position, uint8_t configMask, uint32_t orientations) const;
+
+	/** @brief 映射文件 */
+	void map(const std::string& fileName, bool writable, size_t size);
+private:
+	/** @brief 映射的内存 */
+	void* _data;
+
+	/** @brief 映射的长度 */
+	size_t _size;
+
+	const Header* _header;
+
+	const Voxel* _voxels;
+};
+
+/** @} */
+} /* namespace ik */
+} /* namespace robot */
+
+#endif /* REACHABILITYMAP_H_ */
@@ -101,132 +101,190 @@ void SiasunSR4CSolver::init()
 
 std::vector<Q> SiasunSR4CSolver::solve(const HTransform3D<>& baseTend, const model::Config& config) const
 {
-	HTransform3D<> T06 = _0Tbase*baseTend*_endTjoint6;
-    double x = T06.getPosition()(0);
-    double y = T06.getPosition()(1);
-    double z = T06.getPosition()(2);
-    double r = sqrt(x*x + y*y);
-
+	IKSolutionSet solutions;
+	switch (solveInto(baseTend, config, solutions))
+	{
+	case ikNoSolution:
+		throw (std::string("错误<SiasunSR4CSolver>: 没有解!"));
+	case ikOutOfRange:
+		throw (std::string("错误<SiasunSR4CSolver>: 没有符合范围的解!"));
+	default:
+		break;
+	}
 	std::vector<Q> result;
+	solutions.toVector(result);
+	return result;
+}
 
-    std::vector<double> sgns;
-    sgns.push_back(1);
-    sgns.push_back(-1);
+IKStatus SiasunSR4CSolver::solveInto(const HTransform3D<>& baseTend, const model::Config& config, IKSolutionSet& result) const
+{
+	result.clear();
+	HTransform3D<> T06 = _0Tbase*baseTend*_endTjoint6;
 
-    for (std::vector<double>::iterator it=sgns.begin(); it<sgns.end(); it++)
+    /**> 满足Config的解的个数(不考虑关节范围) */
+    int found = 0;
+    Q q[2];
+
+    const double sgns[2] = {1, -1};
+    for (int i=0; i<2; i++)
     {
-    	double sgn = *it;
+    	double sgn = sgns[i];
     	if (!isShoulderValid(sgn, config))
     	{
     	    continue;
     	}
-    	// theta1 -180~180的唯一解
-    	double theta1 = atan2(sgn*y, sgn*x);
-    	double R = (pow((sgn*r -_a2), 2) + pow(z, 2) - pow(_a3, 2) - pow(_a4, 2) - pow(_d4, 2))/(2.0*_a3);
-    	double a = -R - _a4;
-    	double b = -2*_d4;
-    	double c = _a4 - R;
-    	double d = b*b - 4*a*c;
-    	// theta3
-    	std::vector<double> theta3s;
-    	if (fabs(a) < 1e-12)
-    		theta3s.push_back(atan((_a4 - R)/(2*a))*2);
-    	else if (fabs(d) < 1e-12)
-    		theta3s.push_back(atan(-b/(2*a))*2);
-    	else if (d > 0)
-    	{
-    		theta3s.push_back(atan((-b + sqrt(d))/(2*a))*2);
-    		theta3s.push_back(atan((-b - sqrt(d))/(2*a))*2);
-    	}
-    	else
-    	{
-    		cout << "theta3 no result\n";
-    		cout << "d=" << d << "\n";
-    		cout << "r = " << r << "\tz = " << z << "\ta2 = " << _a2 << "\ta3 = " << _a3 << "\td4 = " << _d4 << '\n';
-    		cout << "x = " << x << "\ty = " << y << '\n';
-    		baseTend.print();
-    	}
-    	// theta2
-    	for (std::vector<double>::iterator it2=theta3s.begin(); it2<theta3s.end(); it2++)
-    	{
-    		double theta3 = *it2;
-    		if (!isElbowValid(theta3, config))
-    		{
-				continue;
-			}
-    		double c3 = cos(theta3);
-    		double s3 = sin(theta3);
-
-    		double x1 = _a4*c3 - _d4*s3 + _a3;
-    		double x2 = -_a4*s3 - _d4*c3;
-    		double x3 = sgn*r - _a2;
-    		double x4 = -_a4*s3 - _d4*c3;
-    		double x5 = -_a4*c3 + _d4*s3 - _a3;
-    		double x6 = z;
-
-    		double as2 = (x3*x4 - x1*x6)/(x2*x4 - x1*x5);
-    		double ac2 = (x3*x5 - x2*x6)/(x1*x5 - x2*x4);
-    		double theta2 = atan2(as2, ac2);
-
-    		solveTheta456(theta1, theta2, theta3, T06, result, config);
-    	}
+    	const int count = solveShoulder(T06, sgn, config, q);
+    	found += count;
+    	/**> 根据关节范围去除不符合的结果, 加减2pi的组合在访问时才生成 */
+    	for (int k=0; k<count; k++)
+    		result.add(q[k], *_serialLink);
     }
 
-    for (std::vector<Q>::iterator it = result.begin(); it != result.end(); ++it) {
-        for (size_t i = 0; i<(size_t)(*it).size(); i++)
-            (*it)(i) -= _dHTable[i].theta();
-    }
-    if ((int)result.size() <= 0)
-    {
-    	throw (std::string("错误<SiasunSR4CSolver>: 没有解!"));
-    }
-    /**> 根据关节范围去除不符合的结果 */
-    std::vector<Q> rangeResult;
-    if ((int)result.size() > 0)
-    {
-//		for (int i=0;;)
-//		{
-//			if (i >= (int)result.size())
-//				break;
-//			if (_serialLink->isJointValid(result[i]))
-//				i++;
-//			else
-//				result.erase(result.begin() + i);
-//		}
-//	    if ((int)result.size() == 0)
-//	    	throw(std::string("错误<SiasunSR4CSolver>: 根据关节范围筛选后没有解!"));
-    	for (int i=0; i<(int)result.size(); i++)
-    	{
-    		std::vector<Q> temp = _serialLink->fixJoint(result[i]);
-    		for (int k=0; k<(int)temp.size(); k++)
-    		{
-    			rangeResult.push_back(temp[k]);
-    		}
-    	}
-    }
-    if ((int)rangeResult.empty())
-    	throw (std::string("错误<SiasunSR4CSolver>: 没有符合范围的解!"));
-    return rangeResult;
+    if (found == 0)
+    	return ikNoSolution;
+    return result.empty() ? ikOutOfRange : ikSuccess;
+}
+
+IKStatus SiasunSR4CSolver::solveNearest(const HTransform3D<>& baseTend, const model::Config& config, const Q& qPrev, Q& result) const
+{
+	// 没有指定(free或same)的部位锁定在qPrev所在的分支
+	const bool explicitConfig = (config.getShoulder() == Config::lefty || config.getShoulder() == Config::righty)
+			&& (config.getElbow() == Config::epositive || config.getElbow() == Config::enegative)
+			&& (config.getWrist() == Config::wpositive || config.getWrist() == Config::wnegative);
+	Config branch = explicitConfig ? config : getConfig(qPrev);
+	Config locked(
+			(config.getShoulder() == Config::lefty || config.getShoulder() == Config::righty) ? config.getShoulder() : branch.getShoulder(),
+			(config.getElbow() == Config::epositive || config.getElbow() == Config::enegative) ? config.getElbow() : branch.getElbow(),
+			(config.getWrist() == Config::wpositive || config.getWrist() == Config::wnegative) ? config.getWrist() : branch.getWrist());
+	HTransform3D<> T06 = _0Tbase*baseTend*_endTjoint6;
+	Q q[2];
+	const int count = solveShoulder(T06, (locked.getShoulder() == Config::lefty) ? 1 : -1, locked, q);
+	if (count == 0)
+		return ikNoSolution;
+	// qPrev与result可以是同一个对象, 选出后再赋值
+	int best = -1;
+	double distance = 0;
+	for (int k=0; k<count; k++)
+	{
+		if (!nearestWrap(q[k], qPrev, *_serialLink))
+			continue;
+		const double d = Q::distance(q[k], qPrev, 6);
+		if (best < 0 || d < distance)
+		{
+			best = k;
+			distance = d;
+		}
+	}
+	if (best < 0)
+		return ikOutOfRange;
+	result = q[best];
+	return ikSuccess;
+}
+
+int SiasunSR4CSolver::solveShoulder(const HTransform3D<>& T06, double sgn, const model::Config& config, Q* result) const
+{
+    double x = T06.getPosition()(0);
+    double y = T06.getPosition()(1);
+    double z = T06.getPosition()(2);
+    double r = sqrt(x*x + y*y);
+    int count = 0;
+
+	// theta1 -180~180的唯一解
+	double theta1 = atan2(sgn*y, sgn*x);
+	double R = ((sgn*r -_a2)*(sgn*r -_a2) + z*z - _a3*_a3 - _a4*_a4 - _d4*_d4)/(2.0*_a3);
+	double a = -R - _a4;
+	double b = -2*_d4;
+	double c = _a4 - R;
+	double d = b*b - 4*a*c;
+	// theta3
+	double theta3s[2];
+	int theta3Count = 0;
+	if (fabs(a) < 1e-12)
+		theta3s[theta3Count++] = atan((_a4 - R)/(2*a))*2;
+	else if (fabs(d) < 1e-12)
+		theta3s[theta3Count++] = atan(-b/(2*a))*2;
+	else if (d > 0)
+	{
+		theta3s[theta3Count++] = atan((-b + sqrt(d))/(2*a))*2;
+		theta3s[theta3Count++] = atan((-b - sqrt(d))/(2*a))*2;
+	}
+	// theta2
+	for (int k=0; k<theta3Count; k++)
+	{
+		double theta3 = theta3s[k];
+		if (!isElbowValid(theta3, config))
+		{
+			continue;
+		}
+		double c3 = cos(theta3);
+		double s3 = sin(theta3);
+
+		double x1 = _a4*c3 - _d4*s3 + _a3;
+		double x2 = -_a4*s3 - _d4*c3;
+		double x3 = sgn*r - _a2;
+		double x4 = -_a4*s3 - _d4*c3;
+		double x5 = -_a4*c3 + _d4*s3 - _a3;
+		double x6 = z;
+
+		double as2 = (x3*x4 - x1*x6)/(x2*x4 - x1*x5);
+		double ac2 = (x3*x5 - x2*x6)/(x1*x5 - x2*x4);
+		double theta2 = atan2(as2, ac2);
+
+		Q& q = result[count++];
+		solveTheta456(theta1, theta2, theta3, s3, c3, T06, q, config);
+		for (int j=0; j<q.size(); j++)
+			q(j) -= _dHTable[j].theta();
+	}
+	return count;
+}
+
+void SiasunSR4CSolver::solveTheta456(
+    double theta1,
+    double theta2,
+    double theta3,
+    HTransform3D<>& T06,
+    std::vector<Q>& result,
+    const model::Config& config) const
+{
+	solveTheta456(theta1, theta2, theta3, sin(theta3), cos(theta3), T06, result, config);
 }
 
 void SiasunSR4CSolver::solveTheta456(
     double theta1,
     double theta2,
     double theta3,
+    double s3,
+    double c3,
     HTransform3D<>& T06,
     std::vector<Q>& result,
     const model::Config& config) const
+{
+	Q q;
+	solveTheta456(theta1, theta2, theta3, s3, c3, T06, q, config);
+	result.push_back(q);
+}
+
+void SiasunSR4CSolver::solveTheta456(
+    double theta1,
+    double theta2,
+    double theta3,
+    double s3,
+    double c3,
+    const HTransform3D<>& T06,
+    Q& q,
+    const model::Config& config) const
 {
 	// 当前推导仅适用于末端旋转=等同于欧拉角Z（-Y）Z的情况， 其它情况可以利用欧拉角表格重新推导
-    Q q(Q::zero(6));
+	if (q.size() != 6)
+		q = Q::zero(6);
     q(0) = theta1;
     q(1) = theta2;
     q(2) = theta3;
 
-    HTransform3D<> T01 = HTransform3D<>::DH(0, 0, 0, theta1);
-    HTransform3D<> T12 = HTransform3D<>::DH(_alpha2, _a2, _d2, theta2);
-    HTransform3D<> T23 = HTransform3D<>::DH(_alpha3, _a3, _d3, theta3);
-    HTransform3D<> T34 = HTransform3D<>::DH(_alpha4, _a4, _d4, 0);
+    HTransform3D<> T01 = HTransform3D<>::DHFast(0, 1, 0, 0, sin(theta1), cos(theta1));
+    HTransform3D<> T12 = HTransform3D<>::DHFast(_salpha2, _calpha2, _a2, _d2, sin(theta2), cos(theta2));
+    HTransform3D<> T23 = HTransform3D<>::DHFast(_salpha3, _calpha3, _a3, _d3, s3, c3);
+    HTransform3D<> T34 = HTransform3D<>::DHFast(_salpha4, _calpha4, _a4, _d4, 0, 1);
 
     HTransform3D<> T04 = T01*T12*T23*T34;
 
@@ -244,6 +302,12 @@ void SiasunSR4CSolver::solveTheta456(
     double r32 = T46(2,1);
     double r33 = T46(2,2);
 
+    solveWrist(r11, r12, r13, r23, r31, r32, r33, q, config);
+}
+
+void SiasunSR4CSolver::solveWrist(double r11, double r12, double r13, double r23, double r31, double r32, double r33,
+		Q& q, const model::Config& config) const
+{
     double theta4, theta5, theta6;
 
     theta5 = atan2(sqrt(r31*r31+r32*r32), r33); // sin(theta5) >= 0; Case for Z(-Y)Z rotation
@@ -268,7 +332,6 @@ void SiasunSR4CSolver::solveTheta456(
         q(3) = theta4;
         q(4) = theta5;
         q(5) = theta6;
-    	result.push_back(q);
     }
     else
     {
@@ -286,7 +349,6 @@ void SiasunSR4CSolver::solveTheta456(
 		q(3) = alt4;
 		q(4) = -theta5;
 		q(5) = alt6;
-		result.push_back(q);
     }
 }
 
@@ -338,13 +400,12 @@ bool SiasunSR4CSolver::isElbowValid(const robot::math::Q& q, const model::Config
 
 bool SiasunSR4CSolver::isElbowValid(const double j3, const model::Config& config) const //内部角
 {
+	if (config.getElbow() != Config::epositive && config.getElbow() != Config::enegative && config.getElbow() != Config::esame)
+		return true;
 	double fixedJ3 = j3 + atan(_d4/_a4);
 	fixedJ3 = common::fixAngle(fixedJ3);
 	if (fixedJ3 > M_PI)
 		fixedJ3 -= 2*M_PI;
-	double configJ = (_serialLink->getQ())[2] + atan(_d4/_a4);
-	if (configJ > M_PI)
-		configJ -= 2*M_PI;
 	switch (config.getElbow())
 	{
 	case Config::epositive:
@@ -352,7 +413,13 @@ bool SiasunSR4CSolver::isElbowValid(const double j3, const model::Config& config
 	case Config::enegative:
 		return (fixedJ3 < 0);
 	case Config::esame:
+	{
+		// 只有esame需要当前的关节角
+		double configJ = (_serialLink->getQ())[2] + atan(_d4/_a4);
+		if (configJ > M_PI)
+			configJ -= 2*M_PI;
 		return ((fixedJ3 >= 0) == (configJ >= 0));
+	}
 	case Config::efree:
 		return true;
 	default:
@@ -428,19 +495,5 @@ SiasunSR4CSolver::~SiasunSR4CSolver() {
 
 }
 
-Q SiasunSR4CSolver::select(const std::vector<Q>& result, const Q& current)
-{
-	if ((int)result.size() <= 0)
-		throw("错误<SiasunSR4CSolver::select>: 没有可选择的解!");
-	int index = 0;
-	double distance = Q::distance(result[0], current, 6);
-	for (int i=1; i<(int)result.size(); i++)
-	{
-		if (Q::distance(result[i], current, 6) < distance)
-			index = i;
-	}
-	return result[index];
-}
-
 } /* namespace ik */
 } /* namespace robot */
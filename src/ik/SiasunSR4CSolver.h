@@ -24,8 +24,12 @@ namespace ik {
  * @brief 用于机器人逆运动学求解.
  *
  * 包括的类有:
- * 1. PieperSolver: 可用于符合Pieper准则及其它一些条件的特定机器人的逆运动学求解器
+ * 1. PieperSolver: 用于末端三轴交于一点(Pieper准则)的6轴机器人的解析逆解器
  * 2. SiasunSR4CSolver: 用于新松SR4C机器人, 以及其它相似构造机器人(如新松6kg机器人)的逆运动学求解器
+ * 3. NumericIKSolver: 不要求特定构型的数值逆解器
+ * 4. CachedIKSolver: 缓存逆解结果的包装器
+ * 5. ReachabilityMap: 预先计算的可达性体素地图, 用于规划前筛选路径
+ * 6. IKSeedIndex: 逆解初值索引, 按末端位姿查找最接近的已知关节角
  * @{
  */
 
@@ -51,9 +55,33 @@ public:
 	 * @brief 逆运动学求解
 	 * @param baseTend [in] 基坐标系到末端执行器的变换矩阵
 	 * @param config [in] 逆解的Config参数
-	 * @return 按照config参数求解, 总是给出1个或0个解
+	 * @return 按照config参数求解, 给出关节范围内的全部解(包括加减2pi的组合). 没有解时抛出异常
+	 *
+	 * 由solveInto实现
 	 */
     std::vector<Q> solve(const HTransform3D<>& baseTend, const model::Config& config) const;
+
+	/**
+	 * @brief 逆运动学求解, 不申请内存, 不抛出异常
+	 * @param baseTend [in] 基坐标系到末端执行器的变换矩阵
+	 * @param config [in] 逆解的Config参数
+	 * @param result [out] 逆解结果(先清空), 只保存基本解, 加减2pi的组合在访问时生成
+	 * @return 结果状态
+	 */
+    IKStatus solveInto(const HTransform3D<>& baseTend, const model::Config& config, IKSolutionSet& result) const;
+
+	/**
+	 * @brief 只求解一个分支, 取最接近qPrev的解
+	 * @param baseTend [in] 基坐标系到末端执行器的变换矩阵
+	 * @param config [in] 逆解的Config参数, 其中free或same的部位锁定在qPrev所在的分支
+	 * @param qPrev [in] 参考关节角(一般为轨迹上的前一个点)
+	 * @param result [out] 解
+	 * @return 结果状态
+	 *
+	 * 只计算一个肩部分支(肘部的两个根只在同一分支内比较), 不生成所有加减2pi的组合.
+	 */
+    IKStatus solveNearest(const HTransform3D<>& baseTend, const model::Config& config, const Q& qPrev, Q& result) const;
+
     void solveTheta456(double theta1,
                        double theta2,
                        double theta3,
@@ -61,6 +89,22 @@ public:
                        std::vector<robot::math::Q>& result,
                        const model::Config&) const;
 
+    /**
+     * @brief 求解theta4~6
+     * @param s3 [in] sin(theta3), 与theta3一起已经算出, 不再重复计算
+     * @param c3 [in] cos(theta3)
+     *
+     * 前三个关节的变换矩阵使用缓存的sin(alpha), cos(alpha)和DHFast构造
+     */
+    void solveTheta456(double theta1,
+                       double theta2,
+                       double theta3,
+                       double s3,
+                       double c3,
+                       robot::math::HTransform3D<>& T06,
+                       std::vector<robot::math::Q>& result,
+                       const model::Config&) const;
+
     /**
      * @brief 判断机器人模型可否由该逆解器求解
      * @todo 尚未实现
@@ -137,7 +181,7 @@ public:
 	 * @brief 获取机器人模型指针
 	 * @return 机器人模型指针
 	 */
-	inline robot::model::SerialLink::ptr getRobot(){ return _serialLink;}
+	inline robot::model::SerialLink::ptr getRobot() const{ return _serialLink;}
 
 	/**
 	 * @brief 判断奇异
@@ -150,9 +194,34 @@ public:
 
 	virtual ~SiasunSR4CSolver();
 
-public:
-	static Q select(const std::vector<Q>& result, const Q& current);
+private:
+    /**
+     * @brief 求解一个肩部分支(theta1)下满足config的解(最多2个), 已减去DH参数中的theta
+     * @param T06 [in] 0关节到6关节的变换矩阵
+     * @param sgn [in] 1或-1, 对应lefty或righty
+     * @param config [in] Config参数
+     * @param result [out] 解, 至少能保存2个
+     * @return 解的个数
+     */
+    int solveShoulder(const robot::math::HTransform3D<>& T06, double sgn, const model::Config& config, robot::math::Q* result) const;
+
+    /**
+     * @brief 由T46的旋转部分求解theta4~6, 写入q(3)~q(5)
+     */
+    void solveWrist(double r11, double r12, double r13, double r23, double r31, double r32, double r33,
+    		robot::math::Q& q, const model::Config& config) const;
 
+    /**
+     * @brief 求解theta4~6, 结果写入q(前三个关节也一起写入), 不申请内存
+     */
+    void solveTheta456(double theta1,
+                       double theta2,
+                       double theta3,
+                       double s3,
+                       double c3,
+                       const robot::math::HTransform3D<>& T06,
+                       robot::math::Q& q,
+                       const model::Config&) const;
 private:
     double _alpha1, _a1, _calpha1, _salpha1, _d1;
     double _alpha2, _a2, _calpha2, _salpha2, _d2;
@@ -14,84 +14,80 @@ namespace robot {
 namespace kinematic {
 
 State::State(int size):
-		_size(size)
+		_size(size), _angle(Q::zero(size)), _velocity(Q::zero(size)), _acceleration(Q::zero(size))
 {
-	_state.push_back(Q::zero(size));
-	_state.push_back(Q::zero(size));
-	_state.push_back(Q::zero(size));
 }
 
-State::State(Q pos, Q vel, Q acc)
+State::State(const Q& pos, const Q& vel, const Q& acc):
+		_size(pos.size()), _angle(pos), _velocity(vel), _acceleration(acc)
 {
-	_size = pos.size();
-	_state.push_back(pos);
-	_state.push_back(vel);
-	_state.push_back(acc);
 }
 
 const robot::math::Q& State::getAngle() const
 {
-	return _state[0];
+	return _angle;
 }
 
 const robot::math::Q& State::getVelocity() const
 {
-	return _state[1];
+	return _velocity;
 }
 
 const robot::math::Q& State::getAcceleration() const
 {
-	return _state[2];
+	return _acceleration;
 }
 
 const double State::getAngle(int jointNumber) const
 {
-	return _state[0][jointNumber];
+	return _angle[jointNumber];
 }
 
 const double State::getVelocity(int jointNumber) const
 {
-	return _state[1][jointNumber];
+	return _velocity[jointNumber];
 }
 
 const double State::getAcceleration(int jointNumber) const
 {
-	return _state[2][jointNumber];
+	return _acceleration[jointNumber];
 }
 
 void State::setAngle(const robot::math::Q& angle)
 {
-	_state[0] = angle;
+	_angle = angle;
 }
 
 void State::setVelocity(const robot::math::Q& veloccity)
 {
-	_state[1] = veloccity;
+	_velocity = veloccity;
 }
 
 void State::setAcceleration(const robot::math::Q& acceleration)
 {
-	_state[2] = acceleration;
+	_acceleration = acceleration;
 }
 
 void State::setAngle(double angle, int jointNumber)
 {
-	_state[0](jointNumber) = angle;
+	_angle(jointNumber) = angle;
 }
 void State::setVelocity(double velocity, int jointNumber)
 {
-	_state[1](jointNumber) = velocity;
+	_velocity(jointNumber) = velocity;
 }
 
 void State::setAcceleration(double acceleration, int jointNumber)
 {
-	_state[2](jointNumber) = jointNumber;
+	_acceleration(jointNumber) = acceleration;
 }
 
 void State::operator=(const State &state)
 {
 	_size = state._size;
-	_state = state._state;
+	_angle = state._angle;
+	_velocity = state._velocity;
+	_acceleration = state._acceleration;
 }
 
 State::~State()
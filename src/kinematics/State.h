@@ -39,7 +39,7 @@ public:
 	 * @param vel [in] 关节速度
 	 * @param acc [in] 关节加速度
 	 */
-	State(Q pos, Q vel, Q acc);
+	State(const Q& pos, const Q& vel, const Q& acc);
 
 	/**
 	 * @brief 获取所有位置
@@ -132,9 +132,19 @@ private:
 	int _size;
 
 	/**
-	 * @brief 关节信息[位置, 速度, 加速度]
+	 * @brief 关节位置
 	 */
-	std::vector<Q> _state;
+	Q _angle;
+
+	/**
+	 * @brief 关节速度
+	 */
+	Q _velocity;
+
+	/**
+	 * @brief 关节加速度
+	 */
+	Q _acceleration;
 };
 
 /** @} */
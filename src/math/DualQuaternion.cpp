@@ -0,0 +1,292 @@
+/*
+ * DualQuaternion.cpp
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: a1994846931931
+ */
+
+# include "DualQuaternion.h"
+# include <math.h>
+# include "../common/printAdvance.h"
+
+namespace robot {
+namespace math {
+
+namespace {
+
+/**
+ * @brief 四元数相乘(Hamilton), out不能与a或b相同
+ */
+inline void multiply(const double* a, const double* b, double* out)
+{
+	out[0] = a[0]*b[0] - a[1]*b[1] - a[2]*b[2] - a[3]*b[3];
+	out[1] = a[0]*b[1] + a[1]*b[0] + a[2]*b[3] - a[3]*b[2];
+	out[2] = a[0]*b[2] + a[2]*b[0] + a[3]*b[1] - a[1]*b[3];
+	out[3] = a[0]*b[3] + a[3]*b[0] + a[1]*b[2] - a[2]*b[1];
+}
+
+/**
+ * @brief 右乘只有w, x分量的四元数(w, x, 0, 0), out不能与a相同
+ */
+inline void multiplyWX(const double* a, double w, double x, double* out)
+{
+	out[0] = a[0]*w - a[1]*x;
+	out[1] = a[0]*x + a[1]*w;
+	out[2] = a[2]*w + a[3]*x;
+	out[3] = a[3]*w - a[2]*x;
+}
+
+/**
+ * @brief 右乘只有w, z分量的四元数(w, 0, 0, z), out不能与a相同
+ */
+inline void multiplyWZ(const double* a, double w, double z, double* out)
+{
+	out[0] = a[0]*w - a[3]*z;
+	out[1] = a[1]*w + a[2]*z;
+	out[2] = a[2]*w - a[1]*z;
+	out[3] = a[3]*w + a[0]*z;
+}
+
+/**
+ * @brief 由位移和实部计算对偶部: d = t*r/2
+ */
+inline void dualFromTranslation(double x, double y, double z, const double* r, double* d)
+{
+	const double t[4] = {0, x/2, y/2, z/2};
+	multiply(t, r, d);
+}
+
+}
+
+DualQuaternion::DualQuaternion()
+{
+	_real[0] = 1;
+	_real[1] = _real[2] = _real[3] = 0;
+	_dual[0] = _dual[1] = _dual[2] = _dual[3] = 0;
+}
+
+DualQuaternion::DualQuaternion(double rw, double rx, double ry, double rz, double dw, double dx, double dy, double dz)
+{
+	_real[0] = rw; _real[1] = rx; _real[2] = ry; _real[3] = rz;
+	_dual[0] = dw; _dual[1] = dx; _dual[2] = dy; _dual[3] = dz;
+}
+
+DualQuaternion::DualQuaternion(const HTransform3D<double>& tran)
+{
+	const Rotation3D<double>& R = tran.getRotation();
+	const double trace = R(0, 0) + R(1, 1) + R(2, 2);
+	if (trace > 0)
+	{
+		const double S = sqrt(trace + 1.0)*2;
+		_real[0] = 0.25*S;
+		_real[1] = (R(2, 1) - R(1, 2))/S;
+		_real[2] = (R(0, 2) - R(2, 0))/S;
+		_real[3] = (R(1, 0) - R(0, 1))/S;
+	}
+	else if (R(0, 0) > R(1, 1) && R(0, 0) > R(2, 2))
+	{
+		const double S = sqrt(1.0 + R(0, 0) - R(1, 1) - R(2, 2))*2;
+		_real[0] = (R(2, 1) - R(1, 2))/S;
+		_real[1] = 0.25*S;
+		_real[2] = (R(0, 1) + R(1, 0))/S;
+		_real[3] = (R(0, 2) + R(2, 0))/S;
+	}
+	else if (R(1, 1) > R(2, 2))
+	{
+		const double S = sqrt(1.0 + R(1, 1) - R(0, 0) - R(2, 2))*2;
+		_real[0] = (R(0, 2) - R(2, 0))/S;
+		_real[1] = (R(0, 1) + R(1, 0))/S;
+		_real[2] = 0.25*S;
+		_real[3] = (R(1, 2) + R(2, 1))/S;
+	}
+	else
+	{
+		const double S = sqrt(1.0 + R(2, 2) - R(0, 0) - R(1, 1))*2;
+		_real[0] = (R(1, 0) - R(0, 1))/S;
+		_real[1] = (R(0, 2) + R(2, 0))/S;
+		_real[2] = (R(1, 2) + R(2, 1))/S;
+		_real[3] = 0.25*S;
+	}
+	const Vector3D<double>& p = tran.getPosition();
+	dualFromTranslation(p(0), p(1), p(2), _real, _dual);
+	normalize();
+}
+
+DualQuaternion DualQuaternion::operator*(const DualQuaternion& dq) const
+{
+	DualQuaternion result;
+	double rd[4], dr[4];
+	multiply(_real, dq._real, result._real);
+	multiply(_real, dq._dual, rd);
+	multiply(_dual, dq._real, dr);
+	for (int i=0; i<4; i++)
+		result._dual[i] = rd[i] + dr[i];
+	return result;
+}
+
+void DualQuaternion::operator*=(const DualQuaternion& dq)
+{
+	*this = (*this)*dq;
+}
+
+DualQuaternion DualQuaternion::operator*(double num) const
+{
+	return DualQuaternion(
+			_real[0]*num, _real[1]*num, _real[2]*num, _real[3]*num,
+			_dual[0]*num, _dual[1]*num, _dual[2]*num, _dual[3]*num);
+}
+
+DualQuaternion DualQuaternion::operator+(const DualQuaternion& dq) const
+{
+	return DualQuaternion(
+			_real[0] + dq._real[0], _real[1] + dq._real[1], _real[2] + dq._real[2], _real[3] + dq._real[3],
+			_dual[0] + dq._dual[0], _dual[1] + dq._dual[1], _dual[2] + dq._dual[2], _dual[3] + dq._dual[3]);
+}
+
+DualQuaternion DualQuaternion::operator-() const
+{
+	return (*this)*(-1.0);
+}
+
+DualQuaternion DualQuaternion::conjugate() const
+{
+	return DualQuaternion(
+			_real[0], -_real[1], -_real[2], -_real[3],
+			_dual[0], -_dual[1], -_dual[2], -_dual[3]);
+}
+
+void DualQuaternion::normalize()
+{
+	const double norm = sqrt(_real[0]*_real[0] + _real[1]*_real[1] + _real[2]*_real[2] + _real[3]*_real[3]);
+	if (norm < 1e-12)
+		throw("错误<DualQuaternion>: 实部为0, 无法规范化!");
+	for (int i=0; i<4; i++)
+	{
+		_real[i] /= norm;
+		_dual[i] /= norm;
+	}
+	const double dot = _real[0]*_dual[0] + _real[1]*_dual[1] + _real[2]*_dual[2] + _real[3]*_dual[3];
+	for (int i=0; i<4; i++)
+		_dual[i] -= dot*_real[i];
+}
+
+Rotation3D<double> DualQuaternion::toRotation3D() const
+{
+	const double w = _real[0], x = _real[1], y = _real[2], z = _real[3];
+	return Rotation3D<double>(
+			1 - 2*(y*y + z*z), 2*(x*y - w*z), 2*(x*z + w*y),
+			2*(x*y + w*z), 1 - 2*(x*x + z*z), 2*(y*z - w*x),
+			2*(x*z - w*y), 2*(y*z + w*x), 1 - 2*(x*x + y*y));
+}
+
+Vector3D<double> DualQuaternion::getPosition() const
+{
+	// t = 2*d*r^*
+	const double rc[4] = {_real[0], -_real[1], -_real[2], -_real[3]};
+	double t[4];
+	multiply(_dual, rc, t);
+	return Vector3D<double>(2*t[1], 2*t[2], 2*t[3]);
+}
+
+HTransform3D<double> DualQuaternion::toHTransform3D() const
+{
+	return HTransform3D<double>(getPosition(), toRotation3D());
+}
+
+DualQuaternion::screwVar DualQuaternion::getScrewVariables() const
+{
+	screwVar var;
+	const double w = _real[0];
+	const double s = sqrt(_real[1]*_real[1] + _real[2]*_real[2] + _real[3]*_real[3]);
+	if (s < 1e-12) // 纯移动
+	{
+		Vector3D<double> t = getPosition();
+		var.theta = 0;
+		var.d = t.getLength();
+		var.l = (var.d > 1e-12) ? Vector3D<double>(t/var.d) : Vector3D<double>(0, 0, 1);
+		var.m = Vector3D<double>(0, 0, 0);
+		return var;
+	}
+	var.theta = 2*atan2(s, w);
+	var.l = Vector3D<double>(_real[1]/s, _real[2]/s, _real[3]/s);
+	var.d = -2*_dual[0]/s;
+	const double k = var.d/2*w;
+	var.m = Vector3D<double>(
+			(_dual[1] - k*var.l(0))/s,
+			(_dual[2] - k*var.l(1))/s,
+			(_dual[3] - k*var.l(2))/s);
+	return var;
+}
+
+DualQuaternion DualQuaternion::pow(double t) const
+{
+	screwVar var = getScrewVariables();
+	const double theta = var.theta*t;
+	const double d = var.d*t;
+	const double s = sin(theta/2);
+	const double c = cos(theta/2);
+	return DualQuaternion(
+			c, s*var.l(0), s*var.l(1), s*var.l(2),
+			-d/2*s, s*var.m(0) + d/2*c*var.l(0), s*var.m(1) + d/2*c*var.l(1), s*var.m(2) + d/2*c*var.l(2));
+}
+
+DualQuaternion DualQuaternion::log() const
+{
+	screwVar var = getScrewVariables();
+	const double h = var.theta/2;
+	return DualQuaternion(
+			0, h*var.l(0), h*var.l(1), h*var.l(2),
+			0, h*var.m(0) + var.d/2*var.l(0), h*var.m(1) + var.d/2*var.l(1), h*var.m(2) + var.d/2*var.l(2));
+}
+
+void DualQuaternion::print() const
+{
+	cout << "(" << _real[0] << ", " << _real[1] << ", " << _real[2] << ", " << _real[3] << ") + e("
+			<< _dual[0] << ", " << _dual[1] << ", " << _dual[2] << ", " << _dual[3] << ")" << endl;
+}
+
+DualQuaternion DualQuaternion::DHFast(double sa, double ca, double sha, double cha, double a, double d, double sht, double cht)
+{
+	DualQuaternion dq;
+	dq._real[0] = cha*cht;
+	dq._real[1] = sha*cht;
+	dq._real[2] = -sha*sht;
+	dq._real[3] = cha*sht;
+	// 位移为Rx(alpha)*(a, 0, d)
+	dualFromTranslation(a, -d*sa, d*ca, dq._real, dq._dual);
+	return dq;
+}
+
+void DualQuaternion::multiplyDH(double sha, double cha, double a, double d, double sht, double cht)
+{
+	double real[4], dual[4], temp[4];
+	// Rx(alpha)Tx(a): 实部(cha, sha, 0, 0), 对偶部a/2*(-sha, cha, 0, 0)
+	multiplyWX(_real, cha, sha, real);
+	multiplyWX(_real, -a*sha/2, a*cha/2, dual);
+	multiplyWX(_dual, cha, sha, temp);
+	for (int i=0; i<4; i++)
+		dual[i] += temp[i];
+	// Rz(theta)Tz(d): 实部(cht, 0, 0, sht), 对偶部d/2*(-sht, 0, 0, cht)
+	multiplyWZ(real, cht, sht, _real);
+	multiplyWZ(real, -d*sht/2, d*cht/2, _dual);
+	multiplyWZ(dual, cht, sht, temp);
+	for (int i=0; i<4; i++)
+		_dual[i] += temp[i];
+}
+
+DualQuaternion DualQuaternion::interpolate(const DualQuaternion& dq1, const DualQuaternion& dq2, double ratio)
+{
+	DualQuaternion delta = dq1.conjugate()*dq2;
+	if (delta._real[0] < 0)
+		delta = -delta; // 保证转角小于pi
+	DualQuaternion result = dq1*delta.pow(ratio);
+	result.normalize();
+	return result;
+}
+
+DualQuaternion::~DualQuaternion()
+{
+}
+
+} /* namespace math */
+} /* namespace robot */
@@ -0,0 +1,225 @@
+/**
+ * @brief 对偶四元数类DualQuaternion
+ * @date Oct 16, 2026
+ * @author a1994846931931
+ */
+
+#ifndef DUALQUATERNION_H_
+#define DUALQUATERNION_H_
+
+# include "Rotation3D.h"
+# include "HTransform3D.h"
+
+namespace robot {
+namespace math {
+
+/** @addtogroup math
+* @{
+*/
+
+/**
+ * @brief 对偶四元数类
+ *
+ * @f$ \sigma = \mathbf{r} + \varepsilon \mathbf{d} @f$, 其中实部@f$ \mathbf{r} @f$为
+ * 描述旋转的单位四元数, 对偶部@f$ \mathbf{d} = \frac{1}{2}\mathbf{t}\mathbf{r} @f$
+ * 描述位移@f$ \mathbf{t} @f$. 单位对偶四元数与齐次变换矩阵一一对应(相差符号), 相乘即为
+ * 变换的复合, 只需对8个数做规范化, 不需要对3X3旋转矩阵重新正交化.
+ *
+ * 四元数按Hamilton约定计算(@f$ \mathbf{v}' = \mathbf{r}\mathbf{v}\mathbf{r}^* @f$),
+ * toRotation3D与toHTransform3D得到的就是通常意义下的旋转矩阵和变换矩阵.
+ * 各个分量以(w, x, y, z)的顺序保存, real(0)为实部四元数的标量部分.
+ *
+ * 为了表示速度和加速度(插补器的dx, ddx), 对象本身不强制为单位对偶四元数, 需要时调用normalize.
+ */
+class DualQuaternion {
+public:
+	/**
+	 * @brief 螺旋运动参数
+	 *
+	 * 绕轴@f$ \mathbf{l} @f$(过点, 矩@f$ \mathbf{m} = \mathbf{p} \times \mathbf{l} @f$)转动theta,
+	 * 同时沿轴移动d.
+	 */
+	class screwVar{
+	public:
+		double theta;
+		double d;
+		Vector3D<double> l;
+		Vector3D<double> m;
+	};
+public:
+	/**
+	 * @brief 默认构造函数
+	 *
+	 * 单位变换(不旋转, 不移动)
+	 */
+	DualQuaternion();
+
+	/**
+	 * @brief 显式给出8个分量的构造函数
+	 *
+	 * 不进行规范化
+	 */
+	DualQuaternion(double rw, double rx, double ry, double rz, double dw, double dx, double dy, double dz);
+
+	/**
+	 * @brief 由齐次变换矩阵构造
+	 * @param tran [in] 变换矩阵
+	 */
+	explicit DualQuaternion(const HTransform3D<double>& tran);
+
+	/**
+	 * @brief 实部的第i个分量
+	 * @param i [in] 0~3, 依次为w, x, y, z
+	 */
+	inline double real(int i) const
+	{
+		return _real[i];
+	}
+
+	/**
+	 * @brief 对偶部的第i个分量
+	 * @param i [in] 0~3, 依次为w, x, y, z
+	 */
+	inline double dual(int i) const
+	{
+		return _dual[i];
+	}
+
+	/**
+	 * @brief 对偶四元数相乘, 即变换的复合
+	 */
+	DualQuaternion operator*(const DualQuaternion&) const;
+
+	/**
+	 * @brief *=操作
+	 */
+	void operator*=(const DualQuaternion&);
+
+	/**
+	 * @brief 与常量相乘
+	 */
+	DualQuaternion operator*(double num) const;
+
+	/**
+	 * @brief 对应分量相加
+	 */
+	DualQuaternion operator+(const DualQuaternion&) const;
+
+	/**
+	 * @brief 取负
+	 *
+	 * 与原对偶四元数表示相同的变换
+	 */
+	DualQuaternion operator-() const;
+
+	/**
+	 * @brief 共轭(实部与对偶部分别取四元数共轭)
+	 *
+	 * 对于单位对偶四元数, 共轭就是逆变换
+	 */
+	DualQuaternion conjugate() const;
+
+	/**
+	 * @brief 规范化
+	 *
+	 * 实部单位化, 同时去除对偶部中与实部平行的分量, 使其重新成为单位对偶四元数
+	 */
+	void normalize();
+
+	/**
+	 * @brief 获取旋转矩阵
+	 */
+	Rotation3D<double> toRotation3D() const;
+
+	/**
+	 * @brief 获取位移
+	 */
+	Vector3D<double> getPosition() const;
+
+	/**
+	 * @brief 转换为齐次变换矩阵
+	 */
+	HTransform3D<double> toHTransform3D() const;
+
+	/**
+	 * @brief 获取螺旋运动参数
+	 * @return 单位对偶四元数对应的螺旋运动
+	 */
+	screwVar getScrewVariables() const;
+
+	/**
+	 * @brief 幂运算
+	 * @param t [in] 指数
+	 * @return 螺旋运动参数theta和d都乘以t得到的单位对偶四元数
+	 */
+	DualQuaternion pow(double t) const;
+
+	/**
+	 * @brief 对数
+	 * @return 纯对偶四元数@f$ \frac{1}{2}(\theta\mathbf{l} + \varepsilon(\theta\mathbf{m} + d\mathbf{l})) @f$,
+	 * 满足@f$ \frac{d}{dt}\sigma^t = \sigma^t\log\sigma @f$
+	 */
+	DualQuaternion log() const;
+
+	/**
+	 * @brief 右乘DH变换(Modified DH), 结果与*=DHFast(sa, ca, sha, cha, a, d, sht, cht)相同
+	 * @param sha [in] @f$ sin(\alpha/2) @f$
+	 * @param cha [in] @f$ cos(\alpha/2) @f$
+	 * @param a [in] @f$ a @f$
+	 * @param d [in] @f$ d @f$
+	 * @param sht [in] @f$ sin(\theta/2) @f$
+	 * @param cht [in] @f$ cos(\theta/2) @f$
+	 *
+	 * DH变换是@f$ R_x(\alpha)T_x(a) @f$与@f$ R_z(\theta)T_z(d) @f$的乘积, 两个因子的实部和对偶部都只有两个非零分量.
+	 * 依次右乘两个因子只需要48次乘法, 而构造DHFast再做一般的乘法需要60次以上, 也不产生临时对象.
+	 */
+	void multiplyDH(double sha, double cha, double a, double d, double sht, double cht);
+
+	/**
+	 * @brief 格式化打印
+	 */
+	void print() const;
+
+	virtual ~DualQuaternion();
+public:
+	/**
+	 * @brief 由缓存的三角函数构造DH变换(Modified DH)
+	 * @param sa [in] @f$ sin(\alpha) @f$
+	 * @param ca [in] @f$ cos(\alpha) @f$
+	 * @param sha [in] @f$ sin(\alpha/2) @f$
+	 * @param cha [in] @f$ cos(\alpha/2) @f$
+	 * @param a [in] @f$ a @f$
+	 * @param d [in] @f$ d @f$
+	 * @param sht [in] @f$ sin(\theta/2) @f$
+	 * @param cht [in] @f$ cos(\theta/2) @f$
+	 * @return 与HTransform3D<T>::DHFast相同的变换
+	 */
+	static DualQuaternion DHFast(double sa, double ca, double sha, double cha, double a, double d, double sht, double cht);
+
+	/**
+	 * @brief 螺旋线性插值(ScLERP)
+	 * @param dq1 [in] @f$ \sigma_1 @f$
+	 * @param dq2 [in] @f$ \sigma_2 @f$
+	 * @param ratio [in] 比例因子 @f$ k @f$
+	 * @return @f$ \sigma_1(\sigma_1^*\sigma_2)^k @f$, 沿最短路径
+	 *
+	 * 旋转与位移一起沿螺旋运动平滑插补
+	 */
+	static DualQuaternion interpolate(const DualQuaternion& dq1, const DualQuaternion& dq2, double ratio);
+private:
+	/**
+	 * @brief 实部(w, x, y, z)
+	 */
+	double _real[4];
+
+	/**
+	 * @brief 对偶部(w, x, y, z)
+	 */
+	double _dual[4];
+};
+
+/** @} */
+} /* namespace math */
+} /* namespace robot */
+
+#endif /* DUALQUATERNION_H_ */
@@ -0,0 +1,15 @@
+/*
+ * JointVector.cpp
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: a1994846931931
+ */
+
+# include "JointVector.h"
+
+namespace robot {
+namespace math {
+
+
+} /* namespace math */
+} /* namespace robot */
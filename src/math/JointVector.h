@@ -0,0 +1,290 @@
+/**
+ * @brief JointVector类
+ * @date Oct 16, 2026
+ * @author a1994846931931
+ */
+
+#ifndef JOINTVECTOR_H_
+#define JOINTVECTOR_H_
+
+# include <array>
+# include <algorithm>
+# include <math.h>
+# include "Q.h"
+
+namespace robot {
+namespace math {
+
+/** @addtogroup math
+ * @{
+ */
+
+/**
+ * @brief 编译期定长的关节数组
+ * @param N [in] 关节个数
+ *
+ * 数据保存在std::array中, 全部运算都在栈上完成, 不会申请堆内存. 接口与Q保持一致,
+ * 可以和Q相互转换. 关节数在编译期确定时(如6轴机器人)可以代替Q使用.
+ */
+template<int N>
+class JointVector {
+public:
+	/**
+	 * @brief 默认构造函数
+	 *
+	 * 全部数据初始化为0
+	 */
+	JointVector()
+	{
+		_value.fill(0);
+	}
+
+	/**
+	 * @brief 从Q构造
+	 * @param q [in] 长度为N的数组
+	 */
+	explicit JointVector(const Q& q)
+	{
+		if (q.size() != N)
+			throw ("错误<JointVector>: 数组长度与关节个数不一致!");
+		std::copy(q.data(), q.data() + N, _value.begin());
+	}
+
+	/**
+	 * @brief 转换成Q
+	 * @return 长度为N的Q数组
+	 *
+	 * N不超过Q::inlineSize时不会申请堆内存
+	 */
+	Q toQ() const
+	{
+		Q q = Q::zero(N);
+		std::copy(_value.begin(), _value.end(), q.data());
+		return q;
+	}
+
+	/**
+	 * @brief 获取数组的长度
+	 */
+	inline int size() const
+	{
+		return N;
+	}
+
+	/**
+	 * @brief 获取数据首地址
+	 */
+	inline double* data()
+	{
+		return _value.data();
+	}
+
+	/**
+	 * @brief 获取数据首地址
+	 */
+	inline const double* data() const
+	{
+		return _value.data();
+	}
+
+	/**
+	 * @brief 获取数值
+	 * @param index [in] 索引位置
+	 * @return 获取索引位置变量的非const引用
+	 */
+	inline double& operator()(int index)
+	{
+		return _value[index];
+	}
+
+	/**
+	 * @brief 获取数值
+	 * @param index [in] 索引位置
+	 * @return 获取索引位置变量的值
+	 */
+	inline double operator[](int index) const
+	{
+		return _value[index];
+	}
+
+	JointVector operator+(const JointVector& q) const
+	{
+		JointVector r(*this);
+		r += q;
+		return r;
+	}
+
+	JointVector operator-(const JointVector& q) const
+	{
+		JointVector r(*this);
+		r -= q;
+		return r;
+	}
+
+	JointVector operator*(const JointVector& q) const
+	{
+		JointVector r(*this);
+		r *= q;
+		return r;
+	}
+
+	JointVector operator/(const JointVector& q) const
+	{
+		JointVector r(*this);
+		r /= q;
+		return r;
+	}
+
+	JointVector operator+(double num) const
+	{
+		JointVector r(*this);
+		r += num;
+		return r;
+	}
+
+	JointVector operator-(double num) const
+	{
+		JointVector r(*this);
+		r -= num;
+		return r;
+	}
+
+	JointVector operator*(double num) const
+	{
+		JointVector r(*this);
+		r *= num;
+		return r;
+	}
+
+	JointVector operator/(double num) const
+	{
+		JointVector r(*this);
+		r /= num;
+		return r;
+	}
+
+	void operator+=(const JointVector& q)
+	{
+		for (int i=0; i<N; i++)
+			_value[i] += q._value[i];
+	}
+
+	void operator-=(const JointVector& q)
+	{
+		for (int i=0; i<N; i++)
+			_value[i] -= q._value[i];
+	}
+
+	void operator*=(const JointVector& q)
+	{
+		for (int i=0; i<N; i++)
+			_value[i] *= q._value[i];
+	}
+
+	void operator/=(const JointVector& q)
+	{
+		for (int i=0; i<N; i++)
+			_value[i] /= q._value[i];
+	}
+
+	void operator+=(double num)
+	{
+		for (int i=0; i<N; i++)
+			_value[i] += num;
+	}
+
+	void operator-=(double num)
+	{
+		for (int i=0; i<N; i++)
+			_value[i] -= num;
+	}
+
+	void operator*=(double num)
+	{
+		for (int i=0; i<N; i++)
+			_value[i] *= num;
+	}
+
+	void operator/=(double num)
+	{
+		const double factor = 1.0/num;
+		for (int i=0; i<N; i++)
+			_value[i] *= factor;
+	}
+
+	bool operator==(const JointVector& q) const
+	{
+		return _value == q._value;
+	}
+
+	bool operator!=(const JointVector& q) const
+	{
+		return _value != q._value;
+	}
+
+	/**
+	 * @brief 将数组中的所有元素变成它的绝对值
+	 */
+	void abs()
+	{
+		for (int i=0; i<N; i++)
+			_value[i] = fabs(_value[i]);
+	}
+
+	/**
+	 * @brief 获取最小的数值
+	 */
+	double getMin() const
+	{
+		return *std::min_element(_value.begin(), _value.end());
+	}
+
+	/**
+	 * @brief 获取最大的数值
+	 */
+	double getMax() const
+	{
+		return *std::max_element(_value.begin(), _value.end());
+	}
+
+	/**
+	 * @brief 判断是否为0数组
+	 */
+	bool isZero(double precision=1e-12) const
+	{
+		for (int i=0; i<N; i++)
+			if (fabs(_value[i]) > precision)
+				return false;
+		return true;
+	}
+public:
+	/**
+	 * @brief 构造纯0数组
+	 */
+	static JointVector zero()
+	{
+		return JointVector();
+	}
+
+	/**
+	 * @brief 返回两个数组的距离(二次范数)
+	 */
+	static double distance(const JointVector& q1, const JointVector& q2)
+	{
+		double sum = 0;
+		for (int i=0; i<N; i++)
+			sum += (q1._value[i] - q2._value[i])*(q1._value[i] - q2._value[i]);
+		return sqrt(sum);
+	}
+private:
+	/**
+	 * @brief 数据
+	 */
+	std::array<double, N> _value;
+};
+
+/** @} */
+} /* namespace math */
+} /* namespace robot */
+
+#endif /* JOINTVECTOR_H_ */
@@ -8,126 +8,51 @@
 #include "Q.h"
 # include "../common/printAdvance.h"
 # include <algorithm>
+# include <math.h>
 
 namespace robot {
 namespace math {
 
-Q::Q() {
-	_size = 0;
-}
-
-Q::Q(double q1, double q2, double q3, double q4, double q5, double q6)
+Q::Q() : _size(0), _data(_inline)
 {
-	_size = 6;
-	_value.push_back(q1);
-	_value.push_back(q2);
-	_value.push_back(q3);
-	_value.push_back(q4);
-	_value.push_back(q5);
-	_value.push_back(q6);
 }
 
-//Q::Q(Q& q)
-//{
-//	_size = q.size();
-//	for (int i=0; i<_size; i++)
-//		_value.push_back(q[i]);
-//}
-
-
-int Q::size() const
+Q::Q(const Q& q) : _size(0), _data(_inline)
 {
-	return _size;
+	resize(q._size);
+	std::copy(q._data, q._data + _size, _data);
 }
 
-double& Q::operator()(int index)
+Q::Q(double q1, double q2, double q3, double q4, double q5, double q6) : _size(6), _data(_inline)
 {
-	return _value[index];
+	_data[0] = q1;
+	_data[1] = q2;
+	_data[2] = q3;
+	_data[3] = q4;
+	_data[4] = q5;
+	_data[5] = q6;
 }
 
-double Q::operator[](int index) const
+void Q::resize(int size)
 {
-	return _value[index];
+	_size = size;
+	if (size <= inlineSize)
+	{
+		_data = _inline;
+	}
+	else
+	{
+		_heap.resize(size);
+		_data = &_heap[0];
+	}
 }
 
 void Q::operator=(const Q& q)
 {
-	_size = q.size();
-	_value.clear();
-	_value = q._value;
-}
-
-Q Q::operator+(const Q& q1) const
-{
-	if (this->size() != q1.size())
-		throw("错误: 尝试将不同大小的数组相加!");
-	Q q(*this);
-	for (int i=0; i<(int)_size; i++)
-		q(i) += q1[i];
-	return q;
-}
-
-Q Q::operator-(const Q& q1) const
-{
-	if (this->size() != q1.size())
-		throw("错误: 尝试将不同大小的数组相减!!");
-	Q q(*this);
-	for (int i=0; i<(int)_size; i++)
-		q(i) -= q1[i];
-	return q;
-}
-
-Q Q::operator*(const Q& q1) const
-{
-	if (this->size() != q1.size())
-		throw("错误: 尝试将不同大小的数组相乘!!");
-	Q q(*this);
-	for (int i=0; i<(int)_size; i++)
-		q(i) *= q1[i];
-	return q;
-}
-
-Q Q::operator/(const Q& q1) const
-{
-	if (this->size() != q1.size())
-		throw("错误: 尝试将不同大小的数组相除!!");
-	Q q(*this);
-	for (int i=0; i<(int)_size; i++)
-		q(i) = q(i)/q1[i];
-	return q;
-}
-
-Q Q::operator+(double num) const
-{
-	Q q(*this);
-	for (int i=0; i<this->size(); i++)
-		q(i) += num;
-	return q;
-}
-
-Q Q::operator-(double num) const
-{
-	Q q(*this);
-	for (int i=0; i<this->size(); i++)
-		q(i) -= num;
-	return q;
-}
-
-Q Q::operator*(double num) const
-{
-	Q q(*this);
-	for (int i=0; i<this->size(); i++)
-		q(i) *= num;
-	return q;
-}
-
-Q Q::operator/(double num) const
-{
-	double factor = 1.0/num;
-	Q q(*this);
-	for (int i=0; i<this->size(); i++)
-		q(i) *= factor;
-	return q;
+	if (this == &q)
+		return;
+	resize(q._size);
+	std::copy(q._data, q._data + _size, _data);
 }
 
 void Q::operator+=(const Q& q)
@@ -135,7 +60,7 @@ void Q::operator+=(const Q& q)
 	if (this->size() != q.size())
 		throw("错误: 尝试将不同大小的数组相乘!!");
 	for (int i=0; i<this->size(); i++)
-		_value[i] += q[i];
+		_data[i] += q[i];
 }
 
 void Q::operator-=(const Q& q)
@@ -143,7 +68,7 @@ void Q::operator-=(const Q& q)
 	if (this->size() != q.size())
 		throw("错误: 尝试将不同大小的数组相乘!!");
 	for (int i=0; i<this->size(); i++)
-		_value[i] -= q[i];
+		_data[i] -= q[i];
 }
 
 void Q::operator*=(const Q& q)
@@ -151,7 +76,7 @@ void Q::operator*=(const Q& q)
 	if (this->size() != q.size())
 		throw("错误: 尝试将不同大小的数组相乘!!");
 	for (int i=0; i<this->size(); i++)
-		_value[i] *= q[i];
+		_data[i] *= q[i];
 }
 
 void Q::operator/=(const Q& q)
@@ -159,38 +84,38 @@ void Q::operator/=(const Q& q)
 	if (this->size() != q.size())
 		throw("错误: 尝试将不同大小的数组相乘!!");
 	for (int i=0; i<this->size(); i++)
-		_value[i] /= q[i];
+		_data[i] /= q[i];
 }
 
 void Q::operator+=(double num)
 {
 	for (int i=0; i<this->size(); i++)
-		_value[i] += num;
+		_data[i] += num;
 }
 
 void Q::operator-=(double num)
 {
 	for (int i=0; i<this->size(); i++)
-		_value[i] -= num;
+		_data[i] -= num;
 }
 
 void Q::operator*=(double num)
 {
 	for (int i=0; i<this->size(); i++)
-		_value[i] *= num;
+		_data[i] *= num;
 }
 
 void Q::operator/=(double num)
 {
 	for (int i=0; i<this->size(); i++)
-		_value[i] /= num;
+		_data[i] /= num;
 }
 
 Q Q::zero(int size)
 {
 	Q q;
-	for (int i=0; i<size; i++)
-		q.pushBack(0);
+	q.resize(size);
+	std::fill(q._data, q._data + size, 0.0);
 	return q;
 }
 
@@ -200,7 +125,7 @@ bool Q::operator==(const Q& q) const
 		return false;
 	for (int i=0; i<_size; i++)
 	{
-		if (fabs(_value[i] - q[i]) > 1e-12)
+		if (fabs(_data[i] - q[i]) > 1e-12)
 			return false;
 	}
 	return true;
@@ -216,7 +141,7 @@ bool Q::operator<(const Q& q) const
 {
 	for (int i=0; i<_size; i++)
 	{
-		if (_value[i] >= q[i])
+		if (_data[i] >= q[i])
 			return false;
 	}
 	return true;
@@ -226,7 +151,7 @@ bool Q::operator<=(const Q& q) const
 {
 	for (int i=0; i<_size; i++)
 	{
-		if (_value[i] > q[i])
+		if (_data[i] > q[i])
 			return false;
 	}
 	return true;
@@ -236,7 +161,7 @@ bool Q::operator>(const Q& q) const
 {
 	for (int i=0; i<_size; i++)
 	{
-		if (_value[i] <= q[i])
+		if (_data[i] <= q[i])
 			return false;
 	}
 	return true;
@@ -246,7 +171,7 @@ bool Q::operator>=(const Q& q) const
 {
 	for (int i=0; i<_size; i++)
 	{
-		if (_value[i] < q[i])
+		if (_data[i] < q[i])
 			return false;
 	}
 	return true;
@@ -254,13 +179,22 @@ bool Q::operator>=(const Q& q) const
 
 void Q::pushBack(double newValue)
 {
+	if (_size < inlineSize)
+	{
+		_inline[_size++] = newValue;
+		return;
+	}
+	if (_size == inlineSize)
+		_heap.assign(_inline, _inline + inlineSize);
+	_heap.push_back(newValue);
 	_size++;
-	_value.push_back(newValue);
+	_data = &_heap[0];
 }
 
 void Q::abs()
 {
-	for_each(_value.begin(), _value.end(), [](double &value){value = fabs(value);});
+	for (int i=0; i<_size; i++)
+		_data[i] = fabs(_data[i]);
 }
 
 
@@ -268,13 +202,13 @@ void Q::doMinmax(Q&min, Q&max)
 {
 	for (int i=0; i<_size; i++)
 	{
-		if (_value[i] < min[i])
+		if (_data[i] < min[i])
 		{
-			min(i) = _value[i];
+			min(i) = _data[i];
 		}
-		else if (_value[i] > max[i])
+		else if (_data[i] > max[i])
 		{
-			max(i) = _value[i];
+			max(i) = _data[i];
 		}
 	}
 }
@@ -283,9 +217,9 @@ void Q::doMin(Q&min)
 {
 	for (int i=0; i<_size; i++)
 	{
-		if (_value[i] < min[i])
+		if (_data[i] < min[i])
 		{
-			min(i) = _value[i];
+			min(i) = _data[i];
 		}
 	}
 }
@@ -294,28 +228,28 @@ void Q::doMax(Q&max)
 {
 	for (int i=0; i<_size; i++)
 	{
-		if (_value[i] > max[i])
+		if (_data[i] > max[i])
 		{
-			max(i) = _value[i];
+			max(i) = _data[i];
 		}
 	}
 }
 
 double Q::getMin() const
 {
-	return *(min_element(_value.begin(), _value.end()));
+	return *(std::min_element(_data, _data + _size));
 }
 
 double Q::getMax() const
 {
-	return *(max_element(_value.begin(), _value.end()));
+	return *(std::max_element(_data, _data + _size));
 }
 
 bool Q::isZero(double precision) const
 {
 	for (int i=0; i<_size; i++)
 	{
-		if (fabs(_value[i]) > precision )
+		if (fabs(_data[i]) > precision )
 		{
 			return false;
 		}
@@ -327,7 +261,7 @@ void Q::print() const
 {
 	cout.precision(4);
 	for (int i = 0; i<_size; i++)
-		cout << _value[i] << " || ";
+		cout << _data[i] << " || ";
 	robot::common::println();
 }
 
@@ -9,6 +9,7 @@
 
 # include <stddef.h>
 # include <vector>
+# include "QExpression.h"
 
 namespace robot {
 namespace math {
@@ -21,9 +22,18 @@ namespace math {
  * @brief Q数组类
  *
  * 本质上是double类型的数组, 为操作方便而建立. 用来描述机器人的关节角度, 速度等信息.
+ *
+ * 长度不超过inlineSize时数据直接保存在对象内部(栈上), 构造, 复制和四则运算都不会申请堆内存;
+ * 超过inlineSize时才退回到std::vector保存. 这样实时插补周期中的关节运算不会产生内存分配.
+ * 编译期已知长度的场合可以使用robot::math::JointVector.
+ *
+ * 四则运算(+, -, *, /)由QExpression.h中的表达式模板实现, 连续的运算在赋值时一次性计算.
  */
-class Q {
+class Q : public QExpression<Q> {
 public:
+	/** @brief 内部(栈上)保存的最大长度 */
+	static const int inlineSize = 8;
+
 	/**
 	 * @brief 默认构造函数
 	 *
@@ -31,6 +41,27 @@ public:
 	 */
 	Q();
 
+	/**
+	 * @brief 复制构造函数
+	 * @param q [in] 复制源
+	 */
+	Q(const Q& q);
+
+	/**
+	 * @brief 由表达式构造
+	 * @param e [in] 数组运算表达式
+	 *
+	 * 按元素一次性计算表达式的值
+	 */
+	template<class E>
+	Q(const QExpression<E>& e) : _size(0), _data(_inline)
+	{
+		const E& expression = e.derived();
+		resize(expression.size());
+		for (int i=0; i<_size; i++)
+			_data[i] = expression[i];
+	}
+
 	/**
 	 * @brief 构造长度为6的数组
 	 *
@@ -40,21 +71,48 @@ public:
 	/**
 	 * @brief 获取数组的长度
 	 */
-	int size() const;
+	inline int size() const
+	{
+		return _size;
+	}
+
+	/**
+	 * @brief 获取数据首地址
+	 * @return 连续保存的_size个数据的首地址
+	 */
+	inline double* data()
+	{
+		return _data;
+	}
+
+	/**
+	 * @brief 获取数据首地址
+	 * @return 连续保存的_size个数据的首地址
+	 */
+	inline const double* data() const
+	{
+		return _data;
+	}
 
 	/**
 	 * @brief 获取数值
 	 * @param index [in] 索引位置
 	 * @return 获取索引位置变量的非const引用
 	 */
-	double& operator()(int index);
+	inline double& operator()(int index)
+	{
+		return _data[index];
+	}
 
 	/**
 	 * @brief 获取数值
 	 * @param index [in] 索引位置
 	 * @return 获取索引位置变量的值, 要修改数组中的值时, 请用"()"操作
 	 */
-	double operator[](int index) const;
+	inline double operator[](int index) const
+	{
+		return _data[index];
+	}
 
 	/**
 	 * @brief 赋值
@@ -63,60 +121,18 @@ public:
 	void operator=(const Q& q);
 
 	/**
-	 * @brief 数组相加
-	 * @param q [in] 被加数组
-	 * @return 对应位置相加, 返回得到的数组
+	 * @brief 由表达式赋值
+	 * @param e [in] 数组运算表达式
 	 */
-	Q operator+(const Q& q) const;
-
-	/**
-	 * @brief 数组相减
-	 * @param q [in] 被减数组
-	 * @return 对应位置相减, 返回得到的数组
-	 */
-	Q operator-(const Q& q) const;
-
-	/**
-	 * @brief 数组相乘
-	 * @param q [in] 被乘数组
-	 * @return 对应位置相乘, 返回得到的数组
-	 */
-	Q operator*(const Q& q) const;
-
-	/**
-	 * @brief 数组相除
-	 * @param q [in] 被除数组
-	 * @return 对应位置相除, 返回得到的数组
-	 */
-	Q operator/(const Q& q) const;
-
-	/**
-	 * @brief 与常量相加
-	 * @param num [in] 加数
-	 * @return 分别加num, 返回得到的数组
-	 */
-	Q operator+(double num) const;
-
-	/**
-	 * @brief 与常量相乘
-	 * @param num [in] 减数
-	 * @return 分别减num, 返回得到的数组
-	 */
-	Q operator-(double num) const;
-
-	/**
-	 * @brief 与常量相乘
-	 * @param num [in] 乘数
-	 * @return 分别乘以乘数, 返回得到的数组
-	 */
-	Q operator*(double num) const;
-
-	/**
-	 * @brief 与常量相除
-	 * @param num [in] 除数
-	 * @return 分别乘以除数, 返回得到的数组
-	 */
-	Q operator/(double num) const;
+	template<class E>
+	void operator=(const QExpression<E>& e)
+	{
+		const E& expression = e.derived();
+		if (expression.size() != _size)
+			resize(expression.size());
+		for (int i=0; i<_size; i++)
+			_data[i] = expression[i];
+	}
 
 	/**
 	 * @brief 数组相加
@@ -146,6 +162,34 @@ public:
 	 */
 	void operator/=(const Q& q);
 
+	/**
+	 * @brief 加上表达式的值
+	 * @param e [in] 数组运算表达式
+	 */
+	template<class E>
+	void operator+=(const QExpression<E>& e)
+	{
+		const E& expression = e.derived();
+		if (expression.size() != _size)
+			throw("错误: 尝试将不同大小的数组相乘!!");
+		for (int i=0; i<_size; i++)
+			_data[i] += expression[i];
+	}
+
+	/**
+	 * @brief 减去表达式的值
+	 * @param e [in] 数组运算表达式
+	 */
+	template<class E>
+	void operator-=(const QExpression<E>& e)
+	{
+		const E& expression = e.derived();
+		if (expression.size() != _size)
+			throw("错误: 尝试将不同大小的数组相乘!!");
+		for (int i=0; i<_size; i++)
+			_data[i] -= expression[i];
+	}
+
 	/**
 	 * @brief 与常量相加
 	 * @param num [in] 加数
@@ -294,6 +338,14 @@ public:
 	 * @return
 	 */
 	static double distance(const Q& q1, const Q& q2, int size);
+private:
+	/**
+	 * @brief 按照长度size选择数据的保存位置
+	 * @param size [in] 数组长度
+	 *
+	 * 不保留原有数据. size不超过inlineSize时使用内部数组, 否则使用_heap.
+	 */
+	void resize(int size);
 private:
 	/**
 	 * @brief 数组大小
@@ -301,9 +353,19 @@ private:
 	int _size;
 
 	/**
-	 * @brief 数据
+	 * @brief 指向当前使用的数据(_inline或_heap)
+	 */
+	double* _data;
+
+	/**
+	 * @brief 内部数据
+	 */
+	double _inline[inlineSize];
+
+	/**
+	 * @brief 长度超过inlineSize时使用的数据
 	 */
-	std::vector<double> _value;
+	std::vector<double> _heap;
 };
 
 /** @} */
@@ -0,0 +1,233 @@
+/**
+ * @brief Q数组的表达式模板
+ * @date Oct 16, 2026
+ * @author a1994846931931
+ */
+
+#ifndef QEXPRESSION_H_
+#define QEXPRESSION_H_
+
+namespace robot {
+namespace math {
+
+class Q;
+
+/** @addtogroup math
+ * @{
+ */
+
+/**
+ * @brief Q数组表达式的基类
+ *
+ * Q的四则运算不再立即计算, 而是返回记录了运算过程的表达式对象. 表达式在赋值给Q(构造,
+ * =, +=等)时才按元素一次性计算, 因此(x0 + x2 - x1*2.0)/h这样的连续运算只会有一次循环,
+ * 不会产生中间Q对象.
+ *
+ * 所有运算都是按元素进行的, 所以q = q + dq这样左右两边出现同一个数组的写法也是安全的.
+ * @warning 表达式以引用的方式保存参与运算的Q, 不要用auto保存表达式, 应直接赋值给Q.
+ */
+template<class E>
+class QExpression {
+public:
+	inline const E& derived() const
+	{
+		return static_cast<const E&>(*this);
+	}
+
+	/**
+	 * @brief 表达式的长度
+	 */
+	inline int size() const
+	{
+		return derived().size();
+	}
+
+	/**
+	 * @brief 计算索引位置的值
+	 * @param index [in] 索引位置
+	 */
+	inline double operator[](int index) const
+	{
+		return derived()[index];
+	}
+
+	/**
+	 * @brief 获取表达式结果中最小的数值
+	 *
+	 * 使(a/b).getMin()这样的写法不需要构造中间数组
+	 */
+	double getMin() const
+	{
+		const E& e = derived();
+		double result = e[0];
+		for (int i=1; i<e.size(); i++)
+			if (e[i] < result)
+				result = e[i];
+		return result;
+	}
+
+	/**
+	 * @brief 获取表达式结果中最大的数值
+	 */
+	double getMax() const
+	{
+		const E& e = derived();
+		double result = e[0];
+		for (int i=1; i<e.size(); i++)
+			if (e[i] > result)
+				result = e[i];
+		return result;
+	}
+};
+
+/**
+ * @brief 表达式中保存操作数的方式
+ *
+ * Q按引用保存, 表达式(体积很小)按值保存.
+ */
+template<class E>
+struct QOperand {
+	typedef const E type;
+};
+
+template<>
+struct QOperand<Q> {
+	typedef const Q& type;
+};
+
+struct QAdd { static inline double apply(double a, double b) { return a + b; } };
+struct QSub { static inline double apply(double a, double b) { return a - b; } };
+struct QMul { static inline double apply(double a, double b) { return a*b; } };
+struct QDiv { static inline double apply(double a, double b) { return a/b; } };
+
+/**
+ * @brief 两个数组按元素运算的表达式
+ */
+template<class L, class R, class Op>
+class QBinaryExpression : public QExpression<QBinaryExpression<L, R, Op> > {
+public:
+	QBinaryExpression(const L& l, const R& r, const char* sizeError) : _l(l), _r(r)
+	{
+		if (l.size() != r.size())
+			throw(sizeError);
+	}
+
+	inline int size() const
+	{
+		return _l.size();
+	}
+
+	inline double operator[](int index) const
+	{
+		return Op::apply(_l[index], _r[index]);
+	}
+private:
+	typename QOperand<L>::type _l;
+	typename QOperand<R>::type _r;
+};
+
+/**
+ * @brief 数组与常量按元素运算的表达式
+ */
+template<class L, class Op>
+class QScalarExpression : public QExpression<QScalarExpression<L, Op> > {
+public:
+	QScalarExpression(const L& l, double num) : _l(l), _num(num){}
+
+	inline int size() const
+	{
+		return _l.size();
+	}
+
+	inline double operator[](int index) const
+	{
+		return Op::apply(_l[index], _num);
+	}
+private:
+	typename QOperand<L>::type _l;
+	const double _num;
+};
+
+/**
+ * @brief 数组相加
+ * @return 对应位置相加的表达式
+ */
+template<class L, class R>
+inline QBinaryExpression<L, R, QAdd> operator+(const QExpression<L>& l, const QExpression<R>& r)
+{
+	return QBinaryExpression<L, R, QAdd>(l.derived(), r.derived(), "错误: 尝试将不同大小的数组相加!");
+}
+
+/**
+ * @brief 数组相减
+ * @return 对应位置相减的表达式
+ */
+template<class L, class R>
+inline QBinaryExpression<L, R, QSub> operator-(const QExpression<L>& l, const QExpression<R>& r)
+{
+	return QBinaryExpression<L, R, QSub>(l.derived(), r.derived(), "错误: 尝试将不同大小的数组相减!!");
+}
+
+/**
+ * @brief 数组相乘
+ * @return 对应位置相乘的表达式
+ */
+template<class L, class R>
+inline QBinaryExpression<L, R, QMul> operator*(const QExpression<L>& l, const QExpression<R>& r)
+{
+	return QBinaryExpression<L, R, QMul>(l.derived(), r.derived(), "错误: 尝试将不同大小的数组相乘!!");
+}
+
+/**
+ * @brief 数组相除
+ * @return 对应位置相除的表达式
+ */
+template<class L, class R>
+inline QBinaryExpression<L, R, QDiv> operator/(const QExpression<L>& l, const QExpression<R>& r)
+{
+	return QBinaryExpression<L, R, QDiv>(l.derived(), r.derived(), "错误: 尝试将不同大小的数组相除!!");
+}
+
+/**
+ * @brief 与常量相加
+ */
+template<class L>
+inline QScalarExpression<L, QAdd> operator+(const QExpression<L>& l, double num)
+{
+	return QScalarExpression<L, QAdd>(l.derived(), num);
+}
+
+/**
+ * @brief 与常量相减
+ */
+template<class L>
+inline QScalarExpression<L, QSub> operator-(const QExpression<L>& l, double num)
+{
+	return QScalarExpression<L, QSub>(l.derived(), num);
+}
+
+/**
+ * @brief 与常量相乘
+ */
+template<class L>
+inline QScalarExpression<L, QMul> operator*(const QExpression<L>& l, double num)
+{
+	return QScalarExpression<L, QMul>(l.derived(), num);
+}
+
+/**
+ * @brief 与常量相除
+ *
+ * 与原有实现一致, 转换为乘以1/num
+ */
+template<class L>
+inline QScalarExpression<L, QMul> operator/(const QExpression<L>& l, double num)
+{
+	return QScalarExpression<L, QMul>(l.derived(), 1.0/num);
+}
+
+/** @} */
+} /* namespace math */
+} /* namespace robot */
+
+#endif /* QEXPRESSION_H_ */
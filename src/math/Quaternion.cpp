@@ -206,6 +206,11 @@ Quaternion Quaternion::DH(double alpha, double theta)
 	return Quaternion(ca*ct, sa*ct, -sa*st, ca*st);
 }
 
+Quaternion Quaternion::DHFast(double sa, double ca, double st, double ct)
+{
+	return Quaternion(ca*ct, sa*ct, -sa*st, ca*st);
+}
+
 Quaternion Quaternion::interpolate(const Quaternion& quat1, const Quaternion& quat2, double ratio)
 {
 	Quaternion startToEndQuat = quat1.conjugate()*quat2;
@@ -223,6 +223,15 @@ public:
 	*/
 	static Quaternion DH(double alpha, double theta);
 
+	/**
+	* @brief 由预先计算好的半角正弦余弦得到DH四元数, 参见DH
+	* @param sa [in] @f$ sin(\alpha/2) @f$
+	* @param ca [in] @f$ cos(\alpha/2) @f$
+	* @param st [in] @f$ sin(\theta/2) @f$
+	* @param ct [in] @f$ cos(\theta/2) @f$
+	*/
+	static Quaternion DHFast(double sa, double ca, double st, double ct);
+
 	/**
 	 * @brief 差值
 	 * @param quat1 [in] @f$ Q_1 @f$
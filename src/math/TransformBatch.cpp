@@ -0,0 +1,315 @@
+/*
+ * TransformBatch.cpp
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: a1994846931931
+ */
+
+# include "TransformBatch.h"
+# include <algorithm>
+# include <math.h>
+
+# if defined(__AVX__)
+# include <immintrin.h>
+# elif defined(__SSE2__)
+# include <emmintrin.h>
+# endif
+
+namespace robot {
+namespace math {
+
+namespace {
+
+/**
+ * @brief 逐个计算
+ */
+struct ScalarPack {
+	typedef double type;
+	static const int width = 1;
+	static inline type load(const double* p) { return *p; }
+	static inline void store(double* p, type v) { *p = v; }
+	static inline type set1(double v) { return v; }
+	static inline type add(type a, type b) { return a + b; }
+	static inline type mul(type a, type b) { return a*b; }
+};
+
+# if defined(__AVX__)
+/**
+ * @brief AVX, 每次4个
+ */
+struct SIMDPack {
+	typedef __m256d type;
+	static const int width = 4;
+	static inline type load(const double* p) { return _mm256_loadu_pd(p); }
+	static inline void store(double* p, type v) { _mm256_storeu_pd(p, v); }
+	static inline type set1(double v) { return _mm256_set1_pd(v); }
+	static inline type add(type a, type b) { return _mm256_add_pd(a, b); }
+	static inline type mul(type a, type b) { return _mm256_mul_pd(a, b); }
+};
+# elif defined(__SSE2__)
+/**
+ * @brief SSE2, 每次2个
+ */
+struct SIMDPack {
+	typedef __m128d type;
+	static const int width = 2;
+	static inline type load(const double* p) { return _mm_loadu_pd(p); }
+	static inline void store(double* p, type v) { _mm_storeu_pd(p, v); }
+	static inline type set1(double v) { return _mm_set1_pd(v); }
+	static inline type add(type a, type b) { return _mm_add_pd(a, b); }
+	static inline type mul(type a, type b) { return _mm_mul_pd(a, b); }
+};
+# else
+typedef ScalarPack SIMDPack;
+# endif
+
+/**
+ * @brief 右手边的矩阵组, 按位置读取
+ */
+template<class P>
+struct BatchOperand {
+	const double* const* b;
+	inline typename P::type operator()(int k, int i) const { return P::load(b[k] + i); }
+};
+
+/**
+ * @brief 右手边为同一个矩阵, 每个元素预先广播
+ */
+template<class P>
+struct ConstantOperand {
+	typename P::type b[TransformBatch::ComponentCount];
+	inline typename P::type operator()(int k, int) const { return b[k]; }
+};
+
+/**
+ * @brief A(i) = A(i)*B(i), i属于[begin, end)
+ *
+ * 计算顺序与HTransform3D<T>::operator*=相同, 因此结果与逐个相乘完全一致
+ */
+template<class P, class Operand>
+void multiplyKernel(double* const* A, const Operand& B, int begin, int end)
+{
+	typedef typename P::type V;
+	for (int i=begin; i<end; i+=P::width)
+	{
+		const V a00 = P::load(A[0] + i), a01 = P::load(A[1] + i), a02 = P::load(A[2] + i);
+		const V a10 = P::load(A[3] + i), a11 = P::load(A[4] + i), a12 = P::load(A[5] + i);
+		const V a20 = P::load(A[6] + i), a21 = P::load(A[7] + i), a22 = P::load(A[8] + i);
+
+		/**> 位移: R_A*d_B + d_A */
+		const V bx = B(9, i), by = B(10, i), bz = B(11, i);
+		P::store(A[9] + i, P::add(P::add(P::add(P::mul(a00, bx), P::mul(a01, by)), P::mul(a02, bz)), P::load(A[9] + i)));
+		P::store(A[10] + i, P::add(P::add(P::add(P::mul(a10, bx), P::mul(a11, by)), P::mul(a12, bz)), P::load(A[10] + i)));
+		P::store(A[11] + i, P::add(P::add(P::add(P::mul(a20, bx), P::mul(a21, by)), P::mul(a22, bz)), P::load(A[11] + i)));
+
+		/**> 旋转: R_A*R_B */
+		for (int c=0; c<3; c++)
+		{
+			const V b0 = B(c, i), b1 = B(3 + c, i), b2 = B(6 + c, i);
+			P::store(A[c] + i, P::add(P::add(P::mul(a00, b0), P::mul(a01, b1)), P::mul(a02, b2)));
+			P::store(A[3 + c] + i, P::add(P::add(P::mul(a10, b0), P::mul(a11, b1)), P::mul(a12, b2)));
+			P::store(A[6 + c] + i, P::add(P::add(P::mul(a20, b0), P::mul(a21, b1)), P::mul(a22, b2)));
+		}
+	}
+}
+
+
+/**
+ * @brief A(i) = A(i)*DH(i), i属于[begin, end)
+ *
+ * DH(i)的元素见TransformBatch::setDHFast. 计算顺序与multiplyKernel相同, 只省去了与0相乘的项,
+ * 因此结果与先setDHFast再相乘一致.
+ */
+template<class P>
+void multiplyDHKernel(double* const* A, double sa, double ca, double a, double d, const double* st, const double* ct, int begin, int end)
+{
+	typedef typename P::type V;
+	const V vsa = P::set1(sa), vca = P::set1(ca), nsa = P::set1(-sa);
+	const V bx = P::set1(a), by = P::set1(-d*sa), bz = P::set1(d*ca);
+	for (int i=begin; i<end; i+=P::width)
+	{
+		const V a00 = P::load(A[0] + i), a01 = P::load(A[1] + i), a02 = P::load(A[2] + i);
+		const V a10 = P::load(A[3] + i), a11 = P::load(A[4] + i), a12 = P::load(A[5] + i);
+		const V a20 = P::load(A[6] + i), a21 = P::load(A[7] + i), a22 = P::load(A[8] + i);
+		const V s = P::load(st + i), c = P::load(ct + i);
+
+		/**> 位移: R_A*d_B + d_A */
+		P::store(A[9] + i, P::add(P::add(P::add(P::mul(a00, bx), P::mul(a01, by)), P::mul(a02, bz)), P::load(A[9] + i)));
+		P::store(A[10] + i, P::add(P::add(P::add(P::mul(a10, bx), P::mul(a11, by)), P::mul(a12, bz)), P::load(A[10] + i)));
+		P::store(A[11] + i, P::add(P::add(P::add(P::mul(a20, bx), P::mul(a21, by)), P::mul(a22, bz)), P::load(A[11] + i)));
+
+		/**> 第0列: (ct, st*ca, st*sa) */
+		V b0 = c, b1 = P::mul(s, vca), b2 = P::mul(s, vsa);
+		P::store(A[0] + i, P::add(P::add(P::mul(a00, b0), P::mul(a01, b1)), P::mul(a02, b2)));
+		P::store(A[3] + i, P::add(P::add(P::mul(a10, b0), P::mul(a11, b1)), P::mul(a12, b2)));
+		P::store(A[6] + i, P::add(P::add(P::mul(a20, b0), P::mul(a21, b1)), P::mul(a22, b2)));
+
+		/**> 第1列: (-st, ct*ca, ct*sa) */
+		b0 = P::mul(s, P::set1(-1.0)); b1 = P::mul(c, vca); b2 = P::mul(c, vsa);
+		P::store(A[1] + i, P::add(P::add(P::mul(a00, b0), P::mul(a01, b1)), P::mul(a02, b2)));
+		P::store(A[4] + i, P::add(P::add(P::mul(a10, b0), P::mul(a11, b1)), P::mul(a12, b2)));
+		P::store(A[7] + i, P::add(P::add(P::mul(a20, b0), P::mul(a21, b1)), P::mul(a22, b2)));
+
+		/**> 第2列: (0, -sa, ca) */
+		P::store(A[2] + i, P::add(P::mul(a01, nsa), P::mul(a02, vca)));
+		P::store(A[5] + i, P::add(P::mul(a11, nsa), P::mul(a12, vca)));
+		P::store(A[8] + i, P::add(P::mul(a21, nsa), P::mul(a22, vca)));
+	}
+}
+
+}
+
+TransformBatch::TransformBatch(int size) : _size(0), _stride(0)
+{
+	resize(size);
+}
+
+void TransformBatch::resize(int size)
+{
+	if (size < 0)
+		throw("错误<TransformBatch>: 个数不能小于0");
+	_size = size;
+	_stride = (size + 3)/4*4;
+	if ((int)_data.size() < ComponentCount*_stride)
+		_data.resize(ComponentCount*_stride);
+	setIdentity();
+}
+
+void TransformBatch::setIdentity()
+{
+	std::fill(component(0), component(ComponentCount), 0.0);
+	std::fill(component(R00), component(R00) + _stride, 1.0);
+	std::fill(component(R11), component(R11) + _stride, 1.0);
+	std::fill(component(R22), component(R22) + _stride, 1.0);
+}
+
+void TransformBatch::set(int index, const HTransform3D<double>& tran)
+{
+	const Rotation3D<double>& rot = tran.getRotation();
+	const Vector3D<double>& pos = tran.getPosition();
+	for (int r=0; r<3; r++)
+	{
+		for (int c=0; c<3; c++)
+			component(3*r + c)[index] = rot(r, c);
+		component(PX + r)[index] = pos(r);
+	}
+}
+
+HTransform3D<double> TransformBatch::get(int index) const
+{
+	return HTransform3D<double>(
+			component(R00)[index], component(R01)[index], component(R02)[index], component(PX)[index],
+			component(R10)[index], component(R11)[index], component(R12)[index], component(PY)[index],
+			component(R20)[index], component(R21)[index], component(R22)[index], component(PZ)[index]);
+}
+
+void TransformBatch::operator*=(const TransformBatch& batch)
+{
+	if (batch._size != _size)
+		throw("错误<TransformBatch>: 尝试将不同大小的矩阵组相乘!");
+	double* A[ComponentCount];
+	const double* b[ComponentCount];
+	for (int k=0; k<ComponentCount; k++)
+	{
+		A[k] = component(k);
+		b[k] = batch.component(k);
+	}
+	BatchOperand<SIMDPack> B;
+	B.b = b;
+	// _stride是4的倍数, 多出的部分是单位矩阵, 一起计算不影响结果
+	multiplyKernel<SIMDPack>(A, B, 0, _stride);
+}
+
+void TransformBatch::operator*=(const HTransform3D<double>& tran)
+{
+	double* A[ComponentCount];
+	for (int k=0; k<ComponentCount; k++)
+		A[k] = component(k);
+	const Rotation3D<double>& rot = tran.getRotation();
+	const Vector3D<double>& pos = tran.getPosition();
+	ConstantOperand<SIMDPack> B;
+	for (int r=0; r<3; r++)
+	{
+		for (int c=0; c<3; c++)
+			B.b[3*r + c] = SIMDPack::set1(rot(r, c));
+		B.b[PX + r] = SIMDPack::set1(pos(r));
+	}
+	multiplyKernel<SIMDPack>(A, B, 0, _stride);
+}
+
+void TransformBatch::setDHFast(double sa, double ca, double a, double d, const double* st, const double* ct)
+{
+	double* r00 = component(R00); double* r01 = component(R01); double* r02 = component(R02);
+	double* r10 = component(R10); double* r11 = component(R11); double* r12 = component(R12);
+	double* r20 = component(R20); double* r21 = component(R21); double* r22 = component(R22);
+	double* px = component(PX); double* py = component(PY); double* pz = component(PZ);
+	for (int i=0; i<_size; i++)
+	{
+		r00[i] = ct[i]; r01[i] = -st[i]; r02[i] = 0; px[i] = a;
+		r10[i] = st[i]*ca; r11[i] = ct[i]*ca; r12[i] = -sa; py[i] = -d*sa;
+		r20[i] = st[i]*sa; r21[i] = ct[i]*sa; r22[i] = ca; pz[i] = d*ca;
+	}
+}
+
+void TransformBatch::setDH(double sa, double ca, double a, double d, double theta, const double* q)
+{
+	if (_size == 0)
+		return;
+	if ((int)_sin.size() < _size)
+	{
+		_sin.resize(_size);
+		_cos.resize(_size);
+	}
+	for (int i=0; i<_size; i++)
+	{
+		_sin[i] = sin(theta + q[i]);
+		_cos[i] = cos(theta + q[i]);
+	}
+	setDHFast(sa, ca, a, d, &_sin[0], &_cos[0]);
+}
+
+void TransformBatch::multiplyDHFast(double sa, double ca, double a, double d, const double* st, const double* ct)
+{
+	double* A[ComponentCount];
+	for (int k=0; k<ComponentCount; k++)
+		A[k] = component(k);
+	// st, ct只有size()个, 按SIMD宽度能整除的部分批量计算, 其余逐个计算
+	const int simdEnd = _size/SIMDPack::width*SIMDPack::width;
+	multiplyDHKernel<SIMDPack>(A, sa, ca, a, d, st, ct, 0, simdEnd);
+	multiplyDHKernel<ScalarPack>(A, sa, ca, a, d, st, ct, simdEnd, _size);
+}
+
+void TransformBatch::multiplyDH(double sa, double ca, double a, double d, double theta, const double* q)
+{
+	if (_size == 0)
+		return;
+	if ((int)_sin.size() < _size)
+	{
+		_sin.resize(_size);
+		_cos.resize(_size);
+	}
+	for (int i=0; i<_size; i++)
+	{
+		_sin[i] = sin(theta + q[i]);
+		_cos[i] = cos(theta + q[i]);
+	}
+	multiplyDHFast(sa, ca, a, d, &_sin[0], &_cos[0]);
+}
+
+const char* TransformBatch::instructionSet()
+{
+# if defined(__AVX__)
+	return "AVX";
+# elif defined(__SSE2__)
+	return "SSE2";
+# else
+	return "scalar";
+# endif
+}
+
+TransformBatch::~TransformBatch()
+{
+}
+
+} /* namespace math */
+} /* namespace robot */
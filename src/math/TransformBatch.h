@@ -0,0 +1,196 @@
+/**
+ * @brief 批量变换矩阵类TransformBatch
+ * @date Oct 16, 2026
+ * @author a1994846931931
+ */
+
+#ifndef TRANSFORMBATCH_H_
+#define TRANSFORMBATCH_H_
+
+# include "HTransform3D.h"
+# include <vector>
+
+namespace robot {
+namespace math {
+
+/** @addtogroup math
+ * @{
+ */
+
+/**
+ * @brief 以结构数组(SoA)形式保存的一组变换矩阵
+ *
+ * 变换矩阵的12个元素(旋转矩阵9个, 位移3个)分别连续保存, 第k个元素的全部数据位于
+ * component(k)中. 对应位置的批量相乘可以一次处理多个变换矩阵: 编译时开启AVX(-mavx或
+ * -mavx2)时每次处理4个, 否则在x86-64上使用SSE2每次处理2个, 其它平台逐个计算.
+ *
+ * 用于多组关节角度的正运动学计算, 参见robot::model::SerialLink::getTransform.
+ */
+class TransformBatch {
+public:
+	/**
+	 * @brief 各元素在component中的索引
+	 */
+	enum Component{
+		R00 = 0, R01, R02,
+		R10, R11, R12,
+		R20, R21, R22,
+		PX, PY, PZ,
+		ComponentCount
+	};
+
+	/**
+	 * @brief 构造函数
+	 * @param size [in] 变换矩阵的个数
+	 *
+	 * 全部初始化为单位矩阵
+	 */
+	TransformBatch(int size=0);
+
+	/**
+	 * @brief 改变变换矩阵的个数
+	 * @param size [in] 变换矩阵的个数
+	 *
+	 * 全部重新初始化为单位矩阵. 个数不超过已申请的容量时不会申请内存.
+	 */
+	void resize(int size);
+
+	/**
+	 * @brief 变换矩阵的个数
+	 */
+	inline int size() const
+	{
+		return _size;
+	}
+
+	/**
+	 * @brief 获取第k个元素的数据首地址
+	 * @param k [in] 元素索引, 见Component
+	 */
+	inline double* component(int k)
+	{
+		return _data.data() + k*_stride;
+	}
+
+	/**
+	 * @brief 获取第k个元素的数据首地址
+	 * @param k [in] 元素索引, 见Component
+	 */
+	inline const double* component(int k) const
+	{
+		return _data.data() + k*_stride;
+	}
+
+	/**
+	 * @brief 全部设为单位矩阵
+	 */
+	void setIdentity();
+
+	/**
+	 * @brief 设置第index个变换矩阵
+	 * @param index [in] 索引
+	 * @param tran [in] 变换矩阵
+	 */
+	void set(int index, const HTransform3D<double>& tran);
+
+	/**
+	 * @brief 获取第index个变换矩阵
+	 * @param index [in] 索引
+	 */
+	HTransform3D<double> get(int index) const;
+
+	/**
+	 * @brief 对应位置相乘
+	 * @param batch [in] 右手边的被乘矩阵组, 个数必须与this相同
+	 *
+	 * this中的第i个矩阵变为this(i)*batch(i)
+	 */
+	void operator*=(const TransformBatch& batch);
+
+	/**
+	 * @brief 全部右乘同一个变换矩阵
+	 * @param tran [in] 右手边的被乘矩阵
+	 */
+	void operator*=(const HTransform3D<double>& tran);
+
+	/**
+	 * @brief 批量构造DH变换矩阵, 参见HTransform3D<T>::DHFast
+	 * @param sa [in] @f$ sin(\alpha) @f$
+	 * @param ca [in] @f$ cos(\alpha) @f$
+	 * @param a [in] @f$ a @f$
+	 * @param d [in] @f$ d @f$
+	 * @param st [in] size()个@f$ sin(\theta) @f$
+	 * @param ct [in] size()个@f$ cos(\theta) @f$
+	 */
+	void setDHFast(double sa, double ca, double a, double d, const double* st, const double* ct);
+
+	/**
+	 * @brief 批量构造关节的DH变换矩阵
+	 * @param sa [in] @f$ sin(\alpha) @f$
+	 * @param ca [in] @f$ cos(\alpha) @f$
+	 * @param a [in] @f$ a @f$
+	 * @param d [in] @f$ d @f$
+	 * @param theta [in] 关节的初始角度
+	 * @param q [in] size()个关节角度, 第i个矩阵的角度为theta + q[i]
+	 */
+	void setDH(double sa, double ca, double a, double d, double theta, const double* q);
+
+	/**
+	 * @brief 全部右乘各自关节的DH变换矩阵
+	 * @param sa [in] @f$ sin(\alpha) @f$
+	 * @param ca [in] @f$ cos(\alpha) @f$
+	 * @param a [in] @f$ a @f$
+	 * @param d [in] @f$ d @f$
+	 * @param st [in] size()个@f$ sin(\theta) @f$
+	 * @param ct [in] size()个@f$ cos(\theta) @f$
+	 *
+	 * 与setDHFast后相乘的结果相同, 但DH矩阵的元素在计算中直接生成, 不写入内存, 并跳过其中的0元素.
+	 */
+	void multiplyDHFast(double sa, double ca, double a, double d, const double* st, const double* ct);
+
+	/**
+	 * @brief 全部右乘各自关节的DH变换矩阵
+	 * @param sa [in] @f$ sin(\alpha) @f$
+	 * @param ca [in] @f$ cos(\alpha) @f$
+	 * @param a [in] @f$ a @f$
+	 * @param d [in] @f$ d @f$
+	 * @param theta [in] 关节的初始角度
+	 * @param q [in] size()个关节角度, 第i个矩阵的角度为theta + q[i]
+	 */
+	void multiplyDH(double sa, double ca, double a, double d, double theta, const double* q);
+
+	virtual ~TransformBatch();
+public:
+	/**
+	 * @brief 当前编译使用的指令集
+	 * @return "AVX", "SSE2"或"scalar"
+	 */
+	static const char* instructionSet();
+private:
+	/**
+	 * @brief 变换矩阵的个数
+	 */
+	int _size;
+
+	/**
+	 * @brief 每个元素的数据长度(个数向上取整到4的倍数, 多出的部分保持为单位矩阵)
+	 */
+	int _stride;
+
+	/**
+	 * @brief ComponentCount*_stride个数据
+	 */
+	std::vector<double> _data;
+
+	/**
+	 * @brief setDH, multiplyDH时使用的sin, cos缓存
+	 */
+	std::vector<double> _sin;
+	std::vector<double> _cos;
+};
+
+/** @} */
+} /* namespace math */
+} /* namespace robot */
+
+#endif /* TRANSFORMBATCH_H_ */
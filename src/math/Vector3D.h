@@ -8,6 +8,7 @@
 #define VECTOR3D_H_
 
 # include "Rotation3D.h"
+# include "Vector3DExpression.h"
 # include <iostream>
 # include "../common/printAdvance.h"
 # include "math.h"
@@ -22,10 +23,11 @@ namespace math {
 /**
  * @brief 3X1向量模板类
  *
- * 用以描述坐标系的位移, 可以进行+, -, dot, cross等操作
+ * 用以描述坐标系的位移, 可以进行+, -, dot, cross等操作.
+ * +, -和数乘, 数除由Vector3DExpression.h中的表达式模板实现.
  */
 template<typename T=double>
-class Vector3D {
+class Vector3D : public Vector3DExpression<Vector3D<T>, T> {
 public:
 	/**
 	 * @brief 默认构造函数
@@ -76,6 +78,19 @@ public:
 		_v[2] = vSource(2);
 	}
 
+	/**
+	 * @brief 由表达式构造
+	 * @param e [in] 向量运算表达式
+	 */
+	template<class E>
+	Vector3D(const Vector3DExpression<E, T>& e)
+	{
+		const E& expression = e.derived();
+		_v[0] = expression(0);
+		_v[1] = expression(1);
+		_v[2] = expression(2);
+	}
+
 	/**
 	 * @brief 获取向量的长度
 	 * @return
@@ -126,6 +141,21 @@ public:
 		_v[2] = vSource(2);
 	}
 
+	/**
+	 * @brief 由表达式赋值
+	 * @param e [in] 向量运算表达式
+	 *
+	 * 表达式都是按元素计算的, 所以v = v + dv这样包含自身的写法也是安全的
+	 */
+	template<class E>
+	void operator=(const Vector3DExpression<E, T>& e)
+	{
+		const E& expression = e.derived();
+		_v[0] = expression(0);
+		_v[1] = expression(1);
+		_v[2] = expression(2);
+	}
+
 	/**
 	 * @brief 向量+=操作
 	 * @param vSource [in] 加数
@@ -163,69 +193,6 @@ public:
 		return (!this->operator ==(vSource));
 	}
 
-	/**
-	 * @brief 负操作
-	 * @return
-	 * @f$
-	 * - \left[ \begin{array}{ccc}
-	 * v_1 \\ v_2 \\ v_3
-	 * \end{array} \right]
-	 * =
-	 * \left[ \begin{array}{ccc}
-	 * -v_1 \\ -v_2 \\ -v_3
-	 * \end{array} \right]
-	 * @f$
-	 */
-	Vector3D<T> operator-() const
-	{
-		return Vector3D<T>(
-				-_v[0], -_v[1], -_v[2]);
-	}
-
-	/**
-	 * @brief 向量相加操作
-	 * @param vec [in] 加数
-	 * @return 两个向量对应位置元素相减得到的新向量
-	 */
-	Vector3D<T> operator+(Vector3D<T> vec) const
-	{
-		return Vector3D<T>(
-				vec(0) + _v[0], vec(1) + _v[1], vec(2) + _v[2]);
-	}
-
-	/**
-	 * @brief 向量相减操作
-	 * @param vec [in] 减数
-	 * @return 两个向量对应位置元素相减得到的新向量
-	 */
-	Vector3D<T> operator-(const Vector3D<T>& vec) const
-	{
-		return Vector3D<T>(
-				_v[0] - vec(0), _v[1] - vec(1), _v[2] - vec(2));
-	}
-
-	/**
-	 * @brief 向量与常亮相乘操作
-	 * @param factor [in] 相乘的常量
-	 * @return 向量每个元素与factor相乘得到的新向量
-	 */
-	Vector3D<T> operator*(T factor) const
-	{
-		return Vector3D<T>(
-				_v[0]*factor, _v[1]*factor, _v[2]*factor);
-	}
-
-	/**
-	 * @brief 向量与常亮相除操作
-	 * @param factor [in] 相除的常量
-	 * @return 向量每个元素与factor相除得到的新向量
-	 */
-	Vector3D<T> operator/(T factor) const
-	{
-		return Vector3D<T>(
-				_v[0]/factor, _v[1]/factor, _v[2]/factor);
-	}
-
 	/**
 	 * @brief 向量点乘
 	 * @param a [in]
@@ -0,0 +1,176 @@
+/**
+ * @brief Vector3D向量的表达式模板
+ * @date Oct 16, 2026
+ * @author a1994846931931
+ */
+
+#ifndef VECTOR3DEXPRESSION_H_
+#define VECTOR3DEXPRESSION_H_
+
+# include <math.h>
+
+namespace robot {
+namespace math {
+
+template<typename T> class Vector3D;
+
+/** @addtogroup math
+ * @{
+ */
+
+/**
+ * @brief Vector3D表达式的基类
+ *
+ * 与QExpression相同, 向量的+, -, 数乘和数除返回表达式对象, 在赋值给Vector3D时才按元素
+ * 计算. Vector3D带有虚析构函数, 避免中间对象同时也避免了每个临时对象的构造开销.
+ * @warning 表达式以引用的方式保存参与运算的Vector3D, 不要用auto保存表达式.
+ */
+template<class E, typename T>
+class Vector3DExpression {
+public:
+	typedef T value_type;
+
+	inline const E& derived() const
+	{
+		return static_cast<const E&>(*this);
+	}
+
+	/**
+	 * @brief 计算索引位置的值
+	 * @param i [in] 索引位置
+	 */
+	inline T operator()(int i) const
+	{
+		return derived()(i);
+	}
+
+	/**
+	 * @brief 获取表达式结果向量的长度
+	 *
+	 * 使(a - b).getLength()这样的写法不需要构造中间向量
+	 */
+	double getLength() const
+	{
+		const E& e = derived();
+		const T v0 = e(0);
+		const T v1 = e(1);
+		const T v2 = e(2);
+		return sqrt(v0*v0 + v1*v1 + v2*v2);
+	}
+};
+
+/**
+ * @brief 表达式中保存操作数的方式
+ *
+ * Vector3D按引用保存, 表达式按值保存.
+ */
+template<class E>
+struct Vector3DOperand {
+	typedef const E type;
+};
+
+template<typename T>
+struct Vector3DOperand<Vector3D<T> > {
+	typedef const Vector3D<T>& type;
+};
+
+/**
+ * @brief 两个向量相加(sign=1)或相减(sign=-1)的表达式
+ */
+template<class L, class R, typename T, int sign>
+class Vector3DBinaryExpression : public Vector3DExpression<Vector3DBinaryExpression<L, R, T, sign>, T> {
+public:
+	Vector3DBinaryExpression(const L& l, const R& r) : _l(l), _r(r){}
+
+	inline T operator()(int i) const
+	{
+		return (sign > 0) ? _l(i) + _r(i) : _l(i) - _r(i);
+	}
+private:
+	typename Vector3DOperand<L>::type _l;
+	typename Vector3DOperand<R>::type _r;
+};
+
+/**
+ * @brief 向量与常量相乘(divide=false)或相除(divide=true)的表达式
+ */
+template<class L, typename T, bool divide>
+class Vector3DScalarExpression : public Vector3DExpression<Vector3DScalarExpression<L, T, divide>, T> {
+public:
+	Vector3DScalarExpression(const L& l, T factor) : _l(l), _factor(factor){}
+
+	inline T operator()(int i) const
+	{
+		return divide ? _l(i)/_factor : _l(i)*_factor;
+	}
+private:
+	typename Vector3DOperand<L>::type _l;
+	const T _factor;
+};
+
+/**
+ * @brief 向量取负的表达式
+ */
+template<class L, typename T>
+class Vector3DNegateExpression : public Vector3DExpression<Vector3DNegateExpression<L, T>, T> {
+public:
+	Vector3DNegateExpression(const L& l) : _l(l){}
+
+	inline T operator()(int i) const
+	{
+		return -_l(i);
+	}
+private:
+	typename Vector3DOperand<L>::type _l;
+};
+
+/**
+ * @brief 向量相加
+ */
+template<class L, class R, typename T>
+inline Vector3DBinaryExpression<L, R, T, 1> operator+(const Vector3DExpression<L, T>& l, const Vector3DExpression<R, T>& r)
+{
+	return Vector3DBinaryExpression<L, R, T, 1>(l.derived(), r.derived());
+}
+
+/**
+ * @brief 向量相减
+ */
+template<class L, class R, typename T>
+inline Vector3DBinaryExpression<L, R, T, -1> operator-(const Vector3DExpression<L, T>& l, const Vector3DExpression<R, T>& r)
+{
+	return Vector3DBinaryExpression<L, R, T, -1>(l.derived(), r.derived());
+}
+
+/**
+ * @brief 向量与常量相乘
+ */
+template<class L, typename T>
+inline Vector3DScalarExpression<L, T, false> operator*(const Vector3DExpression<L, T>& l, typename Vector3DExpression<L, T>::value_type factor)
+{
+	return Vector3DScalarExpression<L, T, false>(l.derived(), factor);
+}
+
+/**
+ * @brief 向量与常量相除
+ */
+template<class L, typename T>
+inline Vector3DScalarExpression<L, T, true> operator/(const Vector3DExpression<L, T>& l, typename Vector3DExpression<L, T>::value_type factor)
+{
+	return Vector3DScalarExpression<L, T, true>(l.derived(), factor);
+}
+
+/**
+ * @brief 向量取负
+ */
+template<class L, typename T>
+inline Vector3DNegateExpression<L, T> operator-(const Vector3DExpression<L, T>& l)
+{
+	return Vector3DNegateExpression<L, T>(l.derived());
+}
+
+/** @} */
+} /* namespace math */
+} /* namespace robot */
+
+#endif /* VECTOR3DEXPRESSION_H_ */
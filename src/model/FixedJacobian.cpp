@@ -0,0 +1,14 @@
+/*
+ * FixedJacobian.cpp
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: a1994846931931
+ */
+
+# include "FixedJacobian.h"
+
+namespace robot {
+namespace model {
+
+} /* namespace model */
+} /* namespace robot */
@@ -0,0 +1,222 @@
+/**
+ * @brief 定长雅克比矩阵类FixedJacobian
+ * @date Oct 16, 2026
+ * @author a1994846931931
+ */
+
+#ifndef FIXEDJACOBIAN_H_
+#define FIXEDJACOBIAN_H_
+
+# include "../ext/Eigen/Dense"
+# include "../math/Q.h"
+# include "../common/printAdvance.h"
+# include <math.h>
+
+namespace robot {
+namespace model {
+
+/** @addtogroup model
+ * @{
+ */
+
+/**
+ * @brief 编译期定长的雅克比矩阵
+ *
+ * 与Jacobian相同, 为@f$ \mathbf{J}\cdot\dot\mathbf{q} = \mathbf{V} @f$中的矩阵, 但数据保存在
+ * Eigen::Matrix<double, Rows, Cols>中(栈上), 求解时使用调用者提供的Workspace,
+ * 填充(SerialLink::getJacobian(const JointTrig&, FixedJacobian<6, N>&)), 相乘和求解都不会申请堆内存,
+ * 适合在插补周期内做笛卡尔空间的速度控制.
+ *
+ * 关节速度与末端速度都以robot::math::Q传递(长度不超过Q::inlineSize时不申请内存).
+ * @tparam Rows 行数, 一般为6
+ * @tparam Cols 列数, 即关节数
+ */
+template<int Rows=6, int Cols=6>
+class FixedJacobian {
+public:
+	typedef Eigen::Matrix<double, Rows, Cols> MatrixType;
+	typedef Eigen::Matrix<double, Rows, Rows> SquareType;
+	typedef Eigen::Matrix<double, Rows, 1> RowVector;
+	typedef Eigen::Matrix<double, Cols, 1> ColVector;
+
+	/**
+	 * @brief 求解时使用的工作空间
+	 *
+	 * 分解结果和中间矩阵都是定长的, 在控制循环外构造一次, 之后反复使用.
+	 */
+	class Workspace {
+	public:
+		Workspace() : lu(Rows), llt(Rows){}
+
+		/** @brief LU分解(部分主元) */
+		Eigen::PartialPivLU<SquareType> lu;
+
+		/** @brief @f$ \mathbf{J}\mathbf{J}^T + \lambda^2\mathbf{I} @f$的Cholesky分解 */
+		Eigen::LLT<SquareType> llt;
+
+		/** @brief @f$ \mathbf{J}\mathbf{J}^T + \lambda^2\mathbf{I} @f$ */
+		SquareType square;
+
+		/** @brief 中间向量 */
+		RowVector y;
+
+		EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+	};
+public:
+	/**
+	 * @brief 默认构造函数
+	 *
+	 * 元素全部为0
+	 */
+	FixedJacobian()
+	{
+		_j.setZero();
+	}
+
+	/**
+	 * @brief 取值操作
+	 * @param row [in] 行(从0开始)
+	 * @param col [in] 列(从0开始)
+	 */
+	inline double operator()(int row, int col) const
+	{
+		return _j(row, col);
+	}
+
+	/**
+	 * @brief 取值操作
+	 * @param row [in] 行(从0开始)
+	 * @param col [in] 列(从0开始)
+	 */
+	inline double& operator()(int row, int col)
+	{
+		return _j(row, col);
+	}
+
+	/**
+	 * @brief 数据首地址(列优先保存)
+	 */
+	inline double* data()
+	{
+		return _j.data();
+	}
+
+	/**
+	 * @brief 获取Eigen矩阵
+	 */
+	inline const MatrixType& matrix() const
+	{
+		return _j;
+	}
+
+	/** @brief 行数 */
+	static int rows()
+	{
+		return Rows;
+	}
+
+	/** @brief 列数(关节数) */
+	static int size()
+	{
+		return Cols;
+	}
+
+	/**
+	 * @brief 与关节速度相乘
+	 * @param jointVelocity [in] 关节速度, 长度为Cols
+	 * @param endVelocity [out] 末端速度, 长度变为Rows(不超过Q::inlineSize时不申请内存)
+	 */
+	void multiply(const robot::math::Q& jointVelocity, robot::math::Q& endVelocity) const
+	{
+		if (jointVelocity.size() != Cols)
+			throw("错误<FixedJacobian>: 关节速度与雅克比矩阵大小不匹配!");
+		if (endVelocity.size() != Rows)
+			endVelocity = robot::math::Q::zero(Rows);
+		Eigen::Map<RowVector>(endVelocity.data()) = _j*Eigen::Map<const ColVector>(jointVelocity.data());
+	}
+
+	/**
+	 * @brief LU分解求解关节速度
+	 * @param endVelocity [in] 末端速度, 长度为Rows
+	 * @param jointVelocity [out] 关节速度, 长度变为Cols
+	 * @param ws [in] 工作空间
+	 *
+	 * 仅对方阵有效, 矩阵奇异时抛出异常. 与Jacobian::doInverse()后相乘的结果相同, 但不计算逆矩阵.
+	 */
+	void solveLU(const robot::math::Q& endVelocity, robot::math::Q& jointVelocity, Workspace& ws) const
+	{
+		static_assert(Rows == Cols, "FixedJacobian::solveLU requires a square matrix");
+		if (endVelocity.size() != Rows)
+			throw("错误<FixedJacobian>: 末端速度与雅克比矩阵大小不匹配!");
+		ws.lu.compute(_j);
+		if (fabs(ws.lu.determinant()) < 1e-12)
+			throw("错误<FixedJacobian>: 雅克比矩阵奇异, 无法使用LU分解求解!");
+		if (jointVelocity.size() != Cols)
+			jointVelocity = robot::math::Q::zero(Cols);
+		Eigen::Map<ColVector>(jointVelocity.data()) = ws.lu.solve(Eigen::Map<const RowVector>(endVelocity.data()));
+	}
+
+	/**
+	 * @brief 阻尼最小二乘法(DLS)求解关节速度
+	 * @param endVelocity [in] 末端速度, 长度为Rows
+	 * @param lambda [in] 阻尼系数@f$ \lambda @f$
+	 * @param jointVelocity [out] 关节速度, 长度变为Cols
+	 * @param ws [in] 工作空间
+	 *
+	 * @f$ \dot\mathbf{q} = \mathbf{J}^T(\mathbf{J}\mathbf{J}^T + \lambda^2\mathbf{I})^{-1}\mathbf{V} @f$,
+	 * 在奇异位形附近关节速度有界, 也适用于冗余(Cols > Rows)的情况. lambda为0时退化为伪逆.
+	 */
+	void solveDLS(const robot::math::Q& endVelocity, double lambda, robot::math::Q& jointVelocity, Workspace& ws) const
+	{
+		if (endVelocity.size() != Rows)
+			throw("错误<FixedJacobian>: 末端速度与雅克比矩阵大小不匹配!");
+		ws.square.noalias() = _j*_j.transpose();
+		ws.square.diagonal().array() += lambda*lambda;
+		ws.llt.compute(ws.square);
+		if (ws.llt.info() != Eigen::Success)
+			throw("错误<FixedJacobian>: 雅克比矩阵奇异, 请增大阻尼系数!");
+		ws.y = ws.llt.solve(Eigen::Map<const RowVector>(endVelocity.data()));
+		if (jointVelocity.size() != Cols)
+			jointVelocity = robot::math::Q::zero(Cols);
+		Eigen::Map<ColVector>(jointVelocity.data()).noalias() = _j.transpose()*ws.y;
+	}
+
+	/**
+	 * @brief 求秩, 参见Jacobian::rank()
+	 */
+	int rank() const
+	{
+		Eigen::ColPivHouseholderQR<MatrixType> QR_decomp(_j);
+		return QR_decomp.rank();
+	}
+
+	/**
+	 * @brief 格式化打印
+	 */
+	void print() const
+	{
+		cout.precision(4);
+		cout << setfill('_') << setw(14*Cols) <<  "_" << endl;
+		for (int i=0; i<Rows; i++)
+		{
+			for (int j=0; j<Cols; j++)
+			{
+				cout << setfill(' ') << setw(12) << _j(i, j) << " |";
+			}
+			cout << endl;
+		}
+	}
+
+	virtual ~FixedJacobian(){}
+
+	EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+private:
+	/** @brief Eigen::Matrix<double, Rows, Cols> 记录的矩阵 */
+	MatrixType _j;
+};
+
+/** @} */
+} /* namespace model */
+} /* namespace robot */
+
+#endif /* FIXEDJACOBIAN_H_ */
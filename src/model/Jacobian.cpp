@@ -31,6 +31,13 @@ Jacobian::Jacobian(std::vector< std::vector<double> > j):_j(6, j[0].size())
 	}
 }
 
+Jacobian::Jacobian(const Eigen::MatrixXd& j):_j(j)
+{
+	if (j.rows() != 6)
+		throw("错误: 用于雅克比矩阵初始化的数组大小必须为6! ");
+	_size = j.cols();
+}
+
 
 void Jacobian::doInverse()
 {
@@ -47,6 +47,13 @@ public:
 	 */
 	Jacobian(std::vector< std::vector<double> >);
 
+	/**
+	 * @brief 从Eigen矩阵生成的构造函数
+	 *
+	 * 矩阵必须有6行, 例如FixedJacobian<6, N>::matrix()
+	 */
+	Jacobian(const Eigen::MatrixXd& j);
+
 	/**
 	 * @brief 雅克比矩阵求逆
 	 *
@@ -0,0 +1,53 @@
+/*
+ * JointTrig.cpp
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: a1994846931931
+ */
+
+# include "JointTrig.h"
+# include <math.h>
+
+namespace robot {
+namespace model {
+
+JointTrig::JointTrig() : _size(0), _halfAngle(false)
+{
+}
+
+void JointTrig::update(const double* theta, const robot::math::Q& q, int size, bool halfAngle)
+{
+	if (size > maxDOF)
+		throw("错误<JointTrig>: 关节个数超过maxDOF!");
+	_size = size;
+	_halfAngle = halfAngle;
+	double angle[maxDOF];
+	for (int i=0; i<size; i++)
+		angle[i] = theta[i] + q[i];
+	// 连续的数组上单独的sin, cos循环, 编译器可以合并为sincos, 并在开启-ffast-math时使用向量化的数学库
+	if (!halfAngle)
+	{
+		for (int i=0; i<size; i++)
+			_s[i] = sin(angle[i]);
+		for (int i=0; i<size; i++)
+			_c[i] = cos(angle[i]);
+		return;
+	}
+	// 只计算半角, 全角由二倍角公式得到, 不再调用三角函数
+	for (int i=0; i<size; i++)
+		_sh[i] = sin(angle[i]/2);
+	for (int i=0; i<size; i++)
+		_ch[i] = cos(angle[i]/2);
+	for (int i=0; i<size; i++)
+	{
+		_s[i] = 2*_sh[i]*_ch[i];
+		_c[i] = (_ch[i] - _sh[i])*(_ch[i] + _sh[i]);
+	}
+}
+
+JointTrig::~JointTrig()
+{
+}
+
+} /* namespace model */
+} /* namespace robot */
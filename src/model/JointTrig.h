@@ -0,0 +1,94 @@
+/**
+ * @brief JointTrig类
+ * @date Oct 16, 2026
+ * @author a1994846931931
+ */
+
+#ifndef JOINTTRIG_H_
+#define JOINTTRIG_H_
+
+# include "../math/Q.h"
+
+namespace robot {
+namespace model {
+
+/** @addtogroup model
+ * @{
+ */
+
+/**
+ * @brief 一组关节角度的正弦, 余弦缓存
+ *
+ * 正运动学, 雅克比矩阵等计算都需要每个关节的@f$ sin(\theta_i + q_i) @f$与
+ * @f$ cos(\theta_i + q_i) @f$. 对同一组关节角度先用SerialLink::getJointTrig一次性
+ * 计算出全部的正弦余弦, 再传给SerialLink中接受JointTrig的各个函数, 三角函数只需要计算一次.
+ *
+ * 数据保存在对象内部, 不申请堆内存. 四元数计算需要半角的正弦余弦, 构造时指定halfAngle才会计算.
+ */
+class JointTrig {
+public:
+	/** @brief 最大关节数 */
+	static const int maxDOF = robot::math::Q::inlineSize;
+
+	JointTrig();
+
+	/**
+	 * @brief 计算正弦余弦
+	 * @param theta [in] 各关节的初始角度(DH参数中的theta)
+	 * @param q [in] 关节角度
+	 * @param size [in] 关节个数
+	 * @param halfAngle [in] 是否同时计算半角的正弦余弦. 计算半角时全角由二倍角公式得到, 与直接计算相差一个ulp左右
+	 */
+	void update(const double* theta, const robot::math::Q& q, int size, bool halfAngle=false);
+
+	/** @brief 关节个数 */
+	inline int size() const
+	{
+		return _size;
+	}
+
+	/** @brief 是否计算了半角 */
+	inline bool hasHalfAngle() const
+	{
+		return _halfAngle;
+	}
+
+	/** @brief 第i个关节的@f$ sin(\theta_i + q_i) @f$ */
+	inline double s(int i) const
+	{
+		return _s[i];
+	}
+
+	/** @brief 第i个关节的@f$ cos(\theta_i + q_i) @f$ */
+	inline double c(int i) const
+	{
+		return _c[i];
+	}
+
+	/** @brief 第i个关节的@f$ sin((\theta_i + q_i)/2) @f$ */
+	inline double sh(int i) const
+	{
+		return _sh[i];
+	}
+
+	/** @brief 第i个关节的@f$ cos((\theta_i + q_i)/2) @f$ */
+	inline double ch(int i) const
+	{
+		return _ch[i];
+	}
+
+	virtual ~JointTrig();
+private:
+	int _size;
+	bool _halfAngle;
+	double _s[maxDOF];
+	double _c[maxDOF];
+	double _sh[maxDOF];
+	double _ch[maxDOF];
+};
+
+/** @} */
+} /* namespace model */
+} /* namespace robot */
+
+#endif /* JOINTTRIG_H_ */
@@ -0,0 +1,111 @@
+/*
+ * KinematicsCache.cpp
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: a1994846931931
+ */
+
+# include "KinematicsCache.h"
+# include <math.h>
+
+using robot::math::Q;
+
+namespace robot {
+namespace model {
+
+KinematicsCache::KinematicsCache(SerialLink::ptr robot) :
+		_robot(robot),
+		_dof(robot->getDOF()),
+		_valid(false),
+		_hits(0),
+		_misses(0),
+		_reusedLinks(0),
+		_recomputedLinks(0)
+{
+	if (_dof > JointTrig::maxDOF)
+		throw("错误<KinematicsCache>: 关节数超过JointTrig::maxDOF!");
+}
+
+void KinematicsCache::update(const Q& q)
+{
+	if (q.size() != _dof)
+		throw("错误<KinematicsCache>: 关节数值的个数与关节数不符!");
+	int first = 0;
+	if (_valid)
+	{
+		while (first < _dof && q[first] == _q[first])
+			first++;
+	}
+	if (_valid && first == _dof)
+	{
+		_hits++;
+		_reusedLinks += _dof;
+		return;
+	}
+	_misses++;
+	_reusedLinks += first;
+	_recomputedLinks += _dof - first;
+	for (int i=first; i<_dof; i++)
+	{
+		const Link::ptr link = _robot->getLink(i);
+		const double theta = link->theta() + q[i];
+		if (i > 0)
+			_frames[i] = _frames[i - 1];
+		else
+			_frames[i] = HTransform3D<double>();
+		_frames[i] *= HTransform3D<double>::DHFast(link->sa(), link->ca(), link->a(), link->d(), sin(theta), cos(theta));
+		_q[i] = q[i];
+	}
+	_valid = true;
+}
+
+HTransform3D<double> KinematicsCache::getTransform(unsigned int endLink, const Q& q)
+{
+	if ((int)endLink > _dof)
+		throw("错误<KinematicsCache>: 关节索引超出范围!");
+	update(q);
+	return (endLink == 0) ? HTransform3D<double>() : _frames[endLink - 1];
+}
+
+HTransform3D<double> KinematicsCache::getEndTransform(const Q& q)
+{
+	HTransform3D<double> result = getTransform(_dof, q);
+	result *= _robot->getTool()->getTransform();
+	return result;
+}
+
+Vector3D<double> KinematicsCache::getEndPosition(const Q& q)
+{
+	Vector3D<double> pEnd = _robot->getTool()->getTransform().getPosition();
+	update(q);
+	if (_dof > 0)
+		_frames[_dof - 1] *= pEnd;
+	return pEnd;
+}
+
+Jacobian KinematicsCache::getJacobian(const Q& q)
+{
+	FixedJacobian<6, 6> j; // 目前只处理6X6的雅克比矩阵
+	getJacobian(q, j);
+	return Jacobian(j.matrix());
+}
+
+void KinematicsCache::invalidate()
+{
+	_valid = false;
+}
+
+void KinematicsCache::resetCounters()
+{
+	_hits = 0;
+	_misses = 0;
+	_reusedLinks = 0;
+	_recomputedLinks = 0;
+}
+
+KinematicsCache::~KinematicsCache()
+{
+}
+
+} /* namespace model */
+} /* namespace robot */
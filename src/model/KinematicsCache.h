@@ -0,0 +1,155 @@
+/**
+ * @brief KinematicsCache类
+ * @date Oct 16, 2026
+ * @author a1994846931931
+ */
+
+#ifndef KINEMATICSCACHE_H_
+#define KINEMATICSCACHE_H_
+
+# include "SerialLink.h"
+# include "JointTrig.h"
+# include "Jacobian.h"
+# include "FixedJacobian.h"
+# include "../math/HTransform3D.h"
+# include "../math/Q.h"
+# include <memory>
+
+namespace robot {
+namespace model {
+
+/** @addtogroup model
+ * @{
+ */
+
+/**
+ * @brief 增量正运动学缓存
+ *
+ * 保存上一次计算的关节角度与各关节坐标系相对于基坐标系的位姿@f$ \mathbf{T}_{0i} @f$.
+ * 再次计算时从第一个发生变化的关节开始重新相乘, 之前的@f$ \mathbf{T}_{0i} @f$直接复用;
+ * 关节角度完全相同时不做任何计算. 适用于轨迹采样, 点动(例如只动腕部关节调整姿态)等
+ * 相邻两次计算只有部分关节变化的场合.
+ *
+ * SerialLink的成员函数都是const的, 可以在多个线程中共用; 缓存需要修改内部状态, 因此作为
+ * 独立的对象按需使用(每个线程各自构造). tool在每次调用时实时读取, 修改tool不需要清空缓存;
+ * 修改DH参数或关节后需要调用invalidate().
+ */
+class KinematicsCache {
+public:
+	using ptr = std::shared_ptr<KinematicsCache>;
+
+	/**
+	 * @brief 构造函数
+	 * @param robot [in] 机器人模型, 关节数不能超过JointTrig::maxDOF
+	 */
+	KinematicsCache(SerialLink::ptr robot);
+
+	/**
+	 * @brief 获取变换矩阵
+	 * @param endLink [in] 结束关节的索引位置(0~dof)
+	 * @param q [in] 关节数值
+	 * @return 基坐标系到关节endLink坐标系的变换矩阵(不含tool)
+	 */
+	HTransform3D<double> getTransform(unsigned int endLink, const robot::math::Q& q);
+
+	/**
+	 * @brief 获取末端变换矩阵, 同SerialLink::getEndTransform
+	 * @param q [in] 关节数值
+	 */
+	HTransform3D<double> getEndTransform(const robot::math::Q& q);
+
+	/**
+	 * @brief 获取末端位置, 同SerialLink::getEndPosition
+	 * @param q [in] 关节数值
+	 */
+	Vector3D<double> getEndPosition(const robot::math::Q& q);
+
+	/**
+	 * @brief 获取雅克比矩阵, 同SerialLink::getJacobian
+	 * @param q [in] 关节数值
+	 */
+	Jacobian getJacobian(const robot::math::Q& q);
+
+	/**
+	 * @brief 获取定长雅克比矩阵(不申请内存)
+	 * @param q [in] 关节数值
+	 * @param result [out] 前N个关节的6XN雅克比矩阵, 包含tool
+	 */
+	template<int N>
+	void getJacobian(const robot::math::Q& q, FixedJacobian<6, N>& result)
+	{
+		if (N > _dof)
+			throw("错误<KinematicsCache>: 雅克比矩阵的列数大于关节数!");
+		update(q);
+		Vector3D<double> pEnd = _robot->getTool()->getTransform().getPosition();
+		_frames[N - 1] *= pEnd;
+		SerialLink::getJacobian(_frames, N, pEnd, result.data());
+	}
+
+	/**
+	 * @brief 清空缓存, 下一次调用重新计算全部关节
+	 */
+	void invalidate();
+
+	/** @brief 关节角度与上一次完全相同的调用次数 */
+	inline unsigned long long hitCount() const
+	{
+		return _hits;
+	}
+
+	/** @brief 需要重新计算(部分或全部关节)的调用次数 */
+	inline unsigned long long missCount() const
+	{
+		return _misses;
+	}
+
+	/** @brief 直接复用的关节变换个数 */
+	inline unsigned long long reusedLinkCount() const
+	{
+		return _reusedLinks;
+	}
+
+	/** @brief 重新计算的关节变换个数 */
+	inline unsigned long long recomputedLinkCount() const
+	{
+		return _recomputedLinks;
+	}
+
+	/** @brief 计数清零 */
+	void resetCounters();
+
+	virtual ~KinematicsCache();
+private:
+	/**
+	 * @brief 从第一个变化的关节开始更新_frames
+	 * @param q [in] 关节数值
+	 */
+	void update(const robot::math::Q& q);
+private:
+	/** @brief 机器人模型 */
+	SerialLink::ptr _robot;
+
+	/** @brief 关节数 */
+	int _dof;
+
+	/** @brief 缓存是否有效 */
+	bool _valid;
+
+	/** @brief 上一次计算的关节角度 */
+	double _q[JointTrig::maxDOF];
+
+	/** @brief 第i个关节坐标系相对于基坐标系的位姿 */
+	HTransform3D<double> _frames[JointTrig::maxDOF];
+
+	/** @brief 计数 */
+	unsigned long long _hits;
+	unsigned long long _misses;
+	unsigned long long _reusedLinks;
+	unsigned long long _recomputedLinks;
+};
+
+/** @} */
+} /* namespace model */
+} /* namespace robot */
+
+#endif /* KINEMATICSCACHE_H_ */
@@ -0,0 +1,14 @@
+/*
+ * KinematicsKernel.cpp
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: a1994846931931
+ */
+
+# include "KinematicsKernel.h"
+
+namespace robot {
+namespace model {
+
+} /* namespace model */
+} /* namespace robot */
@@ -0,0 +1,78 @@
+/**
+ * @brief KinematicsKernel类
+ * @date Oct 16, 2026
+ * @author a1994846931931
+ */
+
+#ifndef KINEMATICSKERNEL_H_
+#define KINEMATICSKERNEL_H_
+
+# include "../math/HTransform3D.h"
+# include "../math/Vector3D.h"
+# include "JointTrig.h"
+# include "DHParameters.h"
+# include <memory>
+
+namespace robot {
+namespace model {
+
+/** @addtogroup model
+ * @{
+ */
+
+/**
+ * @brief 特定机器人的运动学计算核
+ *
+ * 通用的SerialLink对每个关节都乘以完整的DH矩阵. 对于确定的机器人, 大部分@f$ \alpha @f$为0或
+ * @f$ \pm 90^\circ @f$, @f$ a @f$, @f$ d @f$中也有很多0, 展开并化简常量后计算量可以大大减少.
+ * 这样的代码由robot::parse::KinematicsCodeGenerator根据机器人模型文件生成(见model/generated),
+ * 通过SerialLink::setKinematicsKernel挂到SerialLink上后, getEndTransform, getEndPosition,
+ * getJacobian以及调用它们的逆解器和规划器都自动使用生成的代码.
+ *
+ * 计算核只负责到法兰(不含tool)的部分, tool仍由SerialLink处理, 可以随时更换.
+ */
+class KinematicsKernel {
+public:
+	using ptr = std::shared_ptr<KinematicsKernel>;
+
+	/** @brief 关节数 */
+	virtual int getDOF() const = 0;
+
+	/** @brief 生成时的机器人名字 */
+	virtual const char* getName() const = 0;
+
+	/**
+	 * @brief 生成时的DH参数
+	 * @param i [in] 关节索引(从0开始)
+	 */
+	virtual DHParameters getDHParameters(int i) const = 0;
+
+	/**
+	 * @brief 法兰相对于基坐标系的变换矩阵
+	 * @param trig [in] 关节数值的正弦余弦缓存
+	 */
+	virtual robot::math::HTransform3D<double> getFlangeTransform(const JointTrig& trig) const = 0;
+
+	/**
+	 * @brief 法兰坐标系中一点相对于基坐标系的位置
+	 * @param trig [in] 关节数值的正弦余弦缓存
+	 * @param point [in] 法兰坐标系中的点(一般为tool的位置)
+	 */
+	virtual robot::math::Vector3D<double> getPosition(const JointTrig& trig, const robot::math::Vector3D<double>& point) const = 0;
+
+	/**
+	 * @brief 雅克比矩阵
+	 * @param trig [in] 关节数值的正弦余弦缓存
+	 * @param point [in] 法兰坐标系中的末端点(一般为tool的位置)
+	 * @param j [out] 6XgetDOF()的矩阵, 列优先保存, 与SerialLink::getJacobian(frames, dof, p, j)相同
+	 */
+	virtual void getJacobian(const JointTrig& trig, const robot::math::Vector3D<double>& point, double* j) const = 0;
+
+	virtual ~KinematicsKernel(){}
+};
+
+/** @} */
+} /* namespace model */
+} /* namespace robot */
+
+#endif /* KINEMATICSKERNEL_H_ */
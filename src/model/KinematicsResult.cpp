@@ -0,0 +1,59 @@
+/*
+ * KinematicsResult.cpp
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: a1994846931931
+ */
+
+# include "KinematicsResult.h"
+
+using robot::math::Q;
+
+namespace robot {
+namespace model {
+
+KinematicsResult::KinematicsResult() : dof(0), jacobian(6, 0)
+{
+	jacobianDotQd.setZero();
+}
+
+Q KinematicsResult::getEndVelocity() const
+{
+	Q v = Q::zero(6);
+	Eigen::Map<Eigen::Matrix<double, 6, 1> >(v.data()) =
+			jacobian*Eigen::Map<const Eigen::VectorXd>(dq.data(), dof);
+	return v;
+}
+
+Q KinematicsResult::getEndAcceleration(const Q& ddq) const
+{
+	if (ddq.size() != dof)
+		throw("错误<KinematicsResult>: 关节加速度与雅克比矩阵大小不匹配!");
+	Q a = Q::zero(6);
+	Eigen::Map<Eigen::Matrix<double, 6, 1> >(a.data()) =
+			jacobian*Eigen::Map<const Eigen::VectorXd>(ddq.data(), dof) + jacobianDotQd;
+	return a;
+}
+
+Q KinematicsResult::getJointAcceleration(const Q& endAcceleration, double lambda) const
+{
+	if (endAcceleration.size() != 6)
+		throw("错误<KinematicsResult>: 末端加速度的长度必须为6!");
+	Eigen::Matrix<double, 6, 6> square;
+	square.noalias() = jacobian*jacobian.transpose();
+	square.diagonal().array() += lambda*lambda;
+	Eigen::LLT<Eigen::Matrix<double, 6, 6> > llt(square);
+	if (llt.info() != Eigen::Success)
+		throw("错误<KinematicsResult>: 雅克比矩阵奇异, 无法求解关节加速度!");
+	const Eigen::Matrix<double, 6, 1> y = llt.solve(Eigen::Map<const Eigen::Matrix<double, 6, 1> >(endAcceleration.data()) - jacobianDotQd);
+	Q ddq = Q::zero(dof);
+	Eigen::Map<Eigen::VectorXd>(ddq.data(), dof).noalias() = jacobian.transpose()*y;
+	return ddq;
+}
+
+KinematicsResult::~KinematicsResult()
+{
+}
+
+} /* namespace model */
+} /* namespace robot */
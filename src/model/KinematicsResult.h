@@ -0,0 +1,98 @@
+/**
+ * @brief KinematicsResult类
+ * @date Oct 16, 2026
+ * @author a1994846931931
+ */
+
+#ifndef KINEMATICSRESULT_H_
+#define KINEMATICSRESULT_H_
+
+# include "../ext/Eigen/Dense"
+# include "../math/HTransform3D.h"
+# include "../math/Q.h"
+# include "JointTrig.h"
+
+namespace robot {
+namespace model {
+
+/** @addtogroup model
+ * @{
+ */
+
+/**
+ * @brief 一次正向递推得到的运动学结果
+ *
+ * 由SerialLink::computeKinematics填充, 包含末端(tool)位姿, 各个关节坐标系相对于基坐标系的位姿,
+ * 6XN雅克比矩阵@f$ \mathbf{J} @f$以及@f$ \dot{\mathbf{J}}\dot{\mathbf{q}} @f$. 由此可以得到
+ * 跟踪控制需要的前馈量: <br>
+ * @f$ \mathbf{a} = \mathbf{J}\ddot{\mathbf{q}} + \dot{\mathbf{J}}\dot{\mathbf{q}} @f$ <br>
+ * @f$ \ddot{\mathbf{q}} = \mathbf{J}^{-1}(\mathbf{a} - \dot{\mathbf{J}}\dot{\mathbf{q}}) @f$ <br>
+ *
+ * 全部数据保存在对象内部(最多JointTrig::maxDOF个关节), 反复使用同一个对象时不申请堆内存.
+ * 速度和加速度向量的顺序与Jacobian相同: @f$ v_x, v_y, v_z, w_x, w_y, w_z @f$.
+ */
+class KinematicsResult {
+public:
+	/** @brief 6XN雅克比矩阵, 最大列数固定, 不申请堆内存 */
+	typedef Eigen::Matrix<double, 6, Eigen::Dynamic, Eigen::ColMajor, 6, JointTrig::maxDOF> JacobianType;
+
+	KinematicsResult();
+
+	/** @brief 关节数 */
+	inline int size() const
+	{
+		return dof;
+	}
+
+	/**
+	 * @brief 末端速度
+	 * @return @f$ \mathbf{J}\dot{\mathbf{q}} @f$
+	 */
+	robot::math::Q getEndVelocity() const;
+
+	/**
+	 * @brief 末端加速度
+	 * @param ddq [in] 关节加速度
+	 * @return @f$ \mathbf{J}\ddot{\mathbf{q}} + \dot{\mathbf{J}}\dot{\mathbf{q}} @f$
+	 */
+	robot::math::Q getEndAcceleration(const robot::math::Q& ddq) const;
+
+	/**
+	 * @brief 由末端加速度求关节加速度
+	 * @param endAcceleration [in] 末端加速度
+	 * @param lambda [in] 阻尼系数, 为0时(6关节)即@f$ \mathbf{J}^{-1}(\mathbf{a} - \dot{\mathbf{J}}\dot{\mathbf{q}}) @f$
+	 * @return 关节加速度
+	 *
+	 * 按阻尼最小二乘@f$ \mathbf{J}^T(\mathbf{J}\mathbf{J}^T + \lambda^2\mathbf{I})^{-1} @f$求解,
+	 * 与FixedJacobian::solveDLS相同. 矩阵奇异时抛出异常.
+	 */
+	robot::math::Q getJointAcceleration(const robot::math::Q& endAcceleration, double lambda=0) const;
+
+	virtual ~KinematicsResult();
+public:
+	/** @brief 关节数 */
+	int dof;
+
+	/** @brief 第i个关节坐标系相对于基坐标系的位姿(i=0~dof-1, 不含tool) */
+	robot::math::HTransform3D<double> frames[JointTrig::maxDOF];
+
+	/** @brief 末端(含tool)相对于基坐标系的位姿 */
+	robot::math::HTransform3D<double> endTransform;
+
+	/** @brief 雅克比矩阵 */
+	JacobianType jacobian;
+
+	/** @brief @f$ \dot{\mathbf{J}}\dot{\mathbf{q}} @f$ */
+	Eigen::Matrix<double, 6, 1> jacobianDotQd;
+
+	/** @brief 计算时的关节速度 */
+	robot::math::Q dq;
+
+	EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+};
+
+/** @} */
+} /* namespace model */
+} /* namespace robot */
+
+#endif /* KINEMATICSRESULT_H_ */
@@ -28,6 +28,7 @@ Link::Link(double alpha, double a, double d, double theta, double min, double ma
 		_sigma(sigma),_offset(0),_lmin(min),_lmax(max),
 		_dHParam(_alpha, _a, _d, _theta),
 		_sa(sin(_alpha)), _ca(cos(_alpha)),
+		_sha(sin(_alpha/2)), _cha(cos(_alpha/2)),
 		_st(sin(theta)), _ct(cos(theta))
 {
 	double a11=_ct;double a12=-_st;double a13=0;double a14=_a;
@@ -50,6 +51,7 @@ Link::Link(const Link& link):
 		_sigma(link._sigma),_offset(0),_lmin(link._lmin),_lmax(link._lmax),
 		_dHParam(_alpha, _a, _d, _theta),
 		_sa(sin(_alpha)), _ca(cos(_alpha)),
+		_sha(sin(_alpha/2)), _cha(cos(_alpha/2)),
 		_st(sin(link._theta)), _ct(cos(link._theta))
 {
 	double a11=_ct;double a12=-_st;double a13=0;double a14=_a;
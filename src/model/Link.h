@@ -121,6 +121,24 @@ public:
 		return _ca;
 	}
 
+	/**
+	 * @brief 返回sin(alpha/2), 用于四元数计算
+	 * @return  @f$ sin(\alpha/2) @f$
+	 */
+	inline double sha() const
+	{
+		return _sha;
+	}
+
+	/**
+	 * @brief 返回cos(alpha/2), 用于四元数计算
+	 * @return  @f$ cos(\alpha/2) @f$
+	 */
+	inline double cha() const
+	{
+		return _cha;
+	}
+
 	/**
 	* @brief 获取DH参数类
 	* @return 返回DH参数类
@@ -151,6 +169,8 @@ private:
 	DHParameters _dHParam;
 	const double _sa; //sin(_a)
 	const double _ca; //cos(_a)
+	const double _sha; //sin(_a/2)
+	const double _cha; //cos(_a/2)
 	const double _st; //sin(_theta)
 	const double _ct; //cos(_theta)
 };
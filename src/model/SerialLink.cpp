@@ -51,6 +51,7 @@ void SerialLink::append(Link::ptr link)
 		parent = _linkList[_linkList.size() - 1]->getFrame();
 	_linkList.push_back(link);
 	parent->addChild(link->getFrame());
+	_kernel.reset();
 }
 
 void SerialLink::append(Link* link)
@@ -76,9 +77,32 @@ Link::ptr SerialLink::pop()
 	Link::ptr link = *_linkList.end();
 	_linkList.pop_back();
 	link->getFrame()->removeParent();
+	_kernel.reset();
 	return link;
 }
 
+void SerialLink::setKinematicsKernel(KinematicsKernel::ptr kernel)
+{
+	if (kernel.get() != NULL)
+	{
+		if (kernel->getDOF() != getDOF())
+			throw("错误<SerialLink::setKinematicsKernel>: 计算核的关节数与模型不符!");
+		for (int i=0; i<getDOF(); i++)
+		{
+			DHParameters dh = kernel->getDHParameters(i);
+			if (fabs(dh.alpha() - _linkList[i]->alpha()) > 1e-9 || fabs(dh.a() - _linkList[i]->a()) > 1e-9
+					|| fabs(dh.d() - _linkList[i]->d()) > 1e-9 || fabs(dh.theta() - _linkList[i]->theta()) > 1e-9)
+				throw("错误<SerialLink::setKinematicsKernel>: 计算核的DH参数与模型不符!");
+		}
+	}
+	_kernel = kernel;
+}
+
+KinematicsKernel::ptr SerialLink::getKinematicsKernel() const
+{
+	return _kernel;
+}
+
 int SerialLink::getDOF() const
 {
 	return (int)_linkList.size();
@@ -95,13 +119,36 @@ DHTable SerialLink::getDHTable() const
 	return dHTable;
 }
 
+JointTrig SerialLink::getJointTrig(const robot::math::Q& q, bool halfAngle) const
+{
+	const int size = q.size() < getDOF() ? q.size() : getDOF();
+	double theta[JointTrig::maxDOF];
+	for (int i=0; i<size && i<JointTrig::maxDOF; i++)
+		theta[i] = _linkList[i]->theta();
+	JointTrig trig;
+	trig.update(theta, q, size, halfAngle);
+	return trig;
+}
+
 HTransform3D<double> SerialLink::getTransform(
 		unsigned int startLink, unsigned int endLink, const robot::math::Q& q) const
+{
+	return this->getTransform(startLink, endLink, getJointTrig(q));
+}
+
+HTransform3D<double> SerialLink::getTransform(
+		unsigned int startLink, unsigned int endLink, const JointTrig& trig) const
 {
 	/*
 	 * 获取连个关节之间的变换矩阵；
 	 * 例如startLink = 0, endLink = 1，获得第一个关节到世界坐标系的转变；
 	 */
+	if (_kernel.get() != NULL && startLink == 0 && endLink == _linkList.size())
+	{
+		HTransform3D<double> tran = _kernel->getFlangeTransform(trig);
+		tran *= _endToTool->getTransform();
+		return tran;
+	}
 	HTransform3D<double> tran = HTransform3D<double>::identity();
 	for (unsigned int i=startLink; i<endLink; i++)
 	{
@@ -110,14 +157,41 @@ HTransform3D<double> SerialLink::getTransform(
 				_linkList[i]->ca(),
 				_linkList[i]->a(),
 				_linkList[i]->d(),
-				sin(_linkList[i]->theta() + q[i]),
-				cos(_linkList[i]->theta() + q[i])));
+				trig.s(i),
+				trig.c(i)));
 	}
 	if (endLink == _linkList.size())
 		tran *= _endToTool->getTransform();
 	return tran;
 }
 
+void SerialLink::getTransform(unsigned int startLink, unsigned int endLink,
+		const std::vector<robot::math::Q>& q, robot::math::TransformBatch& result) const
+{
+	getTransform(startLink, endLink, q.data(), (int)q.size(), result);
+}
+
+void SerialLink::getTransform(unsigned int startLink, unsigned int endLink,
+		const robot::math::Q* q, int size, robot::math::TransformBatch& result) const
+{
+	result.resize(size);
+	vector<double> qi(size);
+	for (unsigned int i=startLink; i<endLink; i++)
+	{
+		for (int k=0; k<size; k++)
+			qi[k] = q[k][i];
+		result.multiplyDH(
+				_linkList[i]->sa(),
+				_linkList[i]->ca(),
+				_linkList[i]->a(),
+				_linkList[i]->d(),
+				_linkList[i]->theta(),
+				qi.data());
+	}
+	if (endLink == _linkList.size())
+		result *= _endToTool->getTransform();
+}
+
 HTransform3D<double> SerialLink::getEndTransform() const
 {
 	return this->getTransform(0, _linkList.size(), Q::zero(getDOF()));
@@ -129,6 +203,28 @@ HTransform3D<double> SerialLink::getEndTransform(const robot::math::Q& q) const
 	return this->getTransform(0, _linkList.size(), q);
 }
 
+HTransform3D<double> SerialLink::getEndTransform(const JointTrig& trig) const
+{
+	return this->getTransform(0, _linkList.size(), trig);
+}
+
+void SerialLink::getEndTransform(const std::vector<robot::math::Q>& q, robot::math::TransformBatch& result) const
+{
+	this->getTransform(0, _linkList.size(), q, result);
+}
+
+void SerialLink::getEndTransforms(const std::vector<robot::math::Q>& q, std::vector<HTransform3D<double> >& result,
+		const robot::common::ExecPolicy& policy) const
+{
+	result.resize(q.size());
+	policy.run((int)q.size(), [this, &q, &result](int begin, int end){
+		TransformBatch batch;
+		this->getTransform(0, _linkList.size(), q.data() + begin, end - begin, batch);
+		for (int i=begin; i<end; i++)
+			result[i] = batch.get(i - begin);
+	});
+}
+
 Vector3D<double> SerialLink::getEndPosition(void) const
 {
 	return this->getEndPosition(Q::zero(getDOF()));
@@ -137,6 +233,13 @@ Vector3D<double> SerialLink::getEndPosition(void) const
 
 Vector3D<double> SerialLink::getEndPosition(const robot::math::Q& q) const
 {
+	return this->getEndPosition(getJointTrig(q));
+}
+
+Vector3D<double> SerialLink::getEndPosition(const JointTrig& trig) const
+{
+	if (_kernel.get() != NULL)
+		return _kernel->getPosition(trig, _endToTool->getTransform().getPosition());
 	Vector3D<double> endPos = (_endToTool->getTransform()).getPosition();
 	for (int i=_linkList.size() - 1; i>=0; i--)
 	{
@@ -145,18 +248,25 @@ Vector3D<double> SerialLink::getEndPosition(const robot::math::Q& q) const
 			_linkList[i]->ca(),
 			_linkList[i]->a(),
 			_linkList[i]->d(),
-			sin(_linkList[i]->theta() + q[i]),
-			cos(_linkList[i]->theta() + q[i]))) *= endPos;
+			trig.s(i),
+			trig.c(i))) *= endPos;
 	}
 	return endPos;
 }
 
 Quaternion SerialLink::getQuaternion(unsigned int startLink, unsigned int endLink, const robot::math::Q& q) const
 {
+	return getQuaternion(startLink, endLink, getJointTrig(q, true));
+}
+
+Quaternion SerialLink::getQuaternion(unsigned int startLink, unsigned int endLink, const JointTrig& trig) const
+{
+	if (!trig.hasHalfAngle())
+		throw("错误<SerialLink::getQuaternion>: JointTrig中没有计算半角!");
 	Quaternion quat(1, 0, 0, 0);
 	for (unsigned int i=startLink; i<endLink; i++)
 	{
-		quat *= Quaternion::DH(_linkList[i]->alpha(), _linkList[i]->theta() + q[i]);
+		quat *= Quaternion::DHFast(_linkList[i]->sha(), _linkList[i]->cha(), trig.sh(i), trig.ch(i));
 	}
 	return quat;
 }
@@ -171,6 +281,36 @@ Quaternion SerialLink::getEndQuaternion(const Q& q) const
 	return getQuaternion(0, getDOF(), q);
 }
 
+Quaternion SerialLink::getEndQuaternion(const JointTrig& trig) const
+{
+	return getQuaternion(0, getDOF(), trig);
+}
+
+DualQuaternion SerialLink::getEndDualQuaternion(const Q& q) const
+{
+	return getEndDualQuaternion(getJointTrig(q, true));
+}
+
+DualQuaternion SerialLink::getEndDualQuaternion(const JointTrig& trig) const
+{
+	if (!trig.hasHalfAngle())
+		throw("错误<SerialLink::getEndDualQuaternion>: JointTrig中没有计算半角!");
+	DualQuaternion result;
+	for (unsigned int i=0; i<_linkList.size(); i++)
+	{
+		result.multiplyDH(
+				_linkList[i]->sha(),
+				_linkList[i]->cha(),
+				_linkList[i]->a(),
+				_linkList[i]->d(),
+				trig.sh(i),
+				trig.ch(i));
+	}
+	result *= DualQuaternion(_endToTool->getTransform());
+	result.normalize();
+	return result;
+}
+
 Jacobian SerialLink::getJacobian() const
 {
 	return getJacobian(getQ());
@@ -178,69 +318,156 @@ Jacobian SerialLink::getJacobian() const
 
 Jacobian SerialLink::getJacobian(const robot::math::Q& q) const
 {
-	int dof = getDOF();
-	dof = 6; // 目前只处理6关节的雅克比矩阵
-	vector< vector<double> > j(6, vector<double>(dof)); // 只处理6X6的雅克比矩阵 // TODO static?
+	return getJacobian(getJointTrig(q));
+}
 
-	// 计算每个关节相对上一坐标系的变换矩阵
-	std::vector< HTransform3D<double> > Ti_1i; // i=1~n
-	for (int i=0; i<dof; i++)
+Jacobian SerialLink::getJacobian(const JointTrig& trig) const
+{
+	FixedJacobian<6, 6> j; // 目前只处理6X6的雅克比矩阵
+	getJacobian(trig, j);
+	return Jacobian(j.matrix());
+}
+
+void SerialLink::fillJacobian(const JointTrig& trig, int dof, double* j) const
+{
+	if (dof > (int)_linkList.size() || dof > trig.size())
+		throw("错误<SerialLink::getJacobian>: 雅克比矩阵的列数大于关节数!");
+	if (_kernel.get() != NULL && dof == (int)_linkList.size())
 	{
-		Ti_1i.push_back(this->getTransform(i, i + 1, q));
+		_kernel->getJacobian(trig, _endToTool->getTransform().getPosition(), j);
+		return;
 	}
 
-	// 计算每个关节变换矩阵的导
-	std::vector< Rotation3D<double> > dTi_1i; // i=1~n
+	// 各个关节坐标系相对于0坐标系的位姿
+	HTransform3D<double> T0i[JointTrig::maxDOF];
 	for (int i=0; i<dof; i++)
 	{
-		Link::ptr link = _linkList[i];
-//		dTi_1i.push_back(Rotation3D<double>::dDH(link->alpha(), link->a(), link->d(), link->theta() + q[i]));
-		dTi_1i.push_back(Rotation3D<double>::dDHFast(link->sa(), link->ca(), link->a(), link->d(), sin(link->theta() + q[i]), cos(link->theta() + q[i])));
+		if (i > 0)
+			T0i[i] = T0i[i - 1];
+		T0i[i] *= HTransform3D<double>::DHFast(
+				_linkList[i]->sa(),
+				_linkList[i]->ca(),
+				_linkList[i]->a(),
+				_linkList[i]->d(),
+				trig.s(i),
+				trig.c(i));
 	}
 
-	// 计算每个关节相对于0坐标系的矩阵变换
-	std::vector< Rotation3D<double> > R0i; // i=1~n
-	R0i.push_back(Ti_1i[0].getRotation());
-	for (int i=1; i<dof; i++)
-	{
-		R0i.push_back(R0i[i-1]*(Ti_1i[i].getRotation()));
-	}
+	// 工具末端相对于0坐标系的位置
+	Vector3D<double> pEnd = _endToTool->getTransform().getPosition();
+	if (dof > 0)
+		T0i[dof - 1] *= pEnd;
+	getJacobian(T0i, dof, pEnd, j);
+}
 
-	// 计算工具末端相对于各个关节坐标的坐标值
-	Vector3D<double> nPend = _endToTool->getTransform().getPosition();
-	std::vector< Vector3D<double> > iPend; // i=n~1 注意为逆向储存
-	iPend.push_back(nPend);
-	for (int i=dof; i>1; i--)
+void SerialLink::getJacobian(const HTransform3D<double>* frames, int dof, const Vector3D<double>& endPosition, double* j)
+{
+	// 第i列: Jv = z_i X (p - o_i), Jw = z_i
+	for (int i=0; i<dof; i++)
 	{
-		iPend.push_back( Ti_1i[i-1]*iPend[dof-i] );
+		const Rotation3D<double>& R = frames[i].getRotation();
+		const Vector3D<double>& o = frames[i].getPosition();
+		const double z[3] = {R(0, 2), R(1, 2), R(2, 2)};
+		const double rx = endPosition(0) - o(0);
+		const double ry = endPosition(1) - o(1);
+		const double rz = endPosition(2) - o(2);
+		double* col = j + 6*i;
+		col[0] = z[1]*rz - z[2]*ry;
+		col[1] = z[2]*rx - z[0]*rz;
+		col[2] = z[0]*ry - z[1]*rx;
+		col[3] = z[0];
+		col[4] = z[1];
+		col[5] = z[2];
 	}
+}
 
-	// Jv速度雅克比
-	Vector3D<double> temp = dTi_1i[0]*iPend[dof-1];
-	j[0][0] = temp(0);
-	j[1][0] = temp(1);
-	j[2][0] = temp(2);
+void SerialLink::computeKinematics(const robot::math::Q& q, const robot::math::Q& dq, KinematicsResult& result) const
+{
+	computeKinematics(getJointTrig(q), dq, result);
+}
 
-	for (int i=1; i<dof; i++)
+void SerialLink::computeKinematics(const JointTrig& trig, const robot::math::Q& dq, KinematicsResult& result) const
+{
+	const int dof = trig.size();
+	if (dof != getDOF() || dq.size() != dof)
+		throw("错误<SerialLink::computeKinematics>: 关节数值或关节速度的个数与关节数不符!");
+	result.dof = dof;
+	result.dq = dq;
+	result.jacobian.resize(6, dof);
+
+	// 正向递推: 关节i的轴z_i及原点o_i固定在连杆i-1上,
+	// 其导数为 dz_i = w_{i-1} X z_i, do_i = v_{i-1} + w_{i-1} X (o_i - o_{i-1})
+	double z[JointTrig::maxDOF][3];
+	double o[JointTrig::maxDOF][3];
+	double dz[JointTrig::maxDOF][3];
+	double dO[JointTrig::maxDOF][3];
+	double w[3] = {0, 0, 0}; // 连杆i-1的角速度
+	double v[3] = {0, 0, 0}; // 连杆i-1坐标原点的速度
+	double prev[3] = {0, 0, 0}; // 连杆i-1坐标原点
+	HTransform3D<double> T0i;
+	for (int i=0; i<dof; i++)
 	{
-		temp = R0i[i-1]*dTi_1i[i]*iPend[dof-i-1];
-		j[0][i] = temp(0);
-		j[1][i] = temp(1);
-		j[2][i] = temp(2);
+		T0i *= HTransform3D<double>::DHFast(
+				_linkList[i]->sa(),
+				_linkList[i]->ca(),
+				_linkList[i]->a(),
+				_linkList[i]->d(),
+				trig.s(i),
+				trig.c(i));
+		result.frames[i] = T0i;
+		for (int k=0; k<3; k++)
+		{
+			z[i][k] = T0i.getRotation()(k, 2);
+			o[i][k] = T0i.getPosition()(k);
+		}
+		const double r[3] = {o[i][0] - prev[0], o[i][1] - prev[1], o[i][2] - prev[2]};
+		dz[i][0] = w[1]*z[i][2] - w[2]*z[i][1];
+		dz[i][1] = w[2]*z[i][0] - w[0]*z[i][2];
+		dz[i][2] = w[0]*z[i][1] - w[1]*z[i][0];
+		dO[i][0] = v[0] + w[1]*r[2] - w[2]*r[1];
+		dO[i][1] = v[1] + w[2]*r[0] - w[0]*r[2];
+		dO[i][2] = v[2] + w[0]*r[1] - w[1]*r[0];
+		for (int k=0; k<3; k++)
+		{
+			v[k] = dO[i][k];
+			prev[k] = o[i][k];
+			w[k] += z[i][k]*dq[i];
+		}
 	}
+	result.endTransform = T0i;
+	result.endTransform *= _endToTool->getTransform();
+	const Vector3D<double>& p = result.endTransform.getPosition();
 
-	// Jw角速度雅克比
+	// 雅克比矩阵: Jv_i = z_i X (p - o_i), Jw_i = z_i
+	double pd[3] = {0, 0, 0}; // 末端速度
 	for (int i=0; i<dof; i++)
 	{
-		j[3][i] = R0i[i](0, 2);
-		j[4][i] = R0i[i](1, 2);
-		j[5][i] = R0i[i](2, 2);
+		const double r[3] = {p(0) - o[i][0], p(1) - o[i][1], p(2) - o[i][2]};
+		result.jacobian(0, i) = z[i][1]*r[2] - z[i][2]*r[1];
+		result.jacobian(1, i) = z[i][2]*r[0] - z[i][0]*r[2];
+		result.jacobian(2, i) = z[i][0]*r[1] - z[i][1]*r[0];
+		result.jacobian(3, i) = z[i][0];
+		result.jacobian(4, i) = z[i][1];
+		result.jacobian(5, i) = z[i][2];
+		for (int k=0; k<3; k++)
+			pd[k] += result.jacobian(k, i)*dq[i];
 	}
 
-	return Jacobian(j); // 返回6X6的雅克比矩阵
+	// dJ*dq: dJv_i = dz_i X (p - o_i) + z_i X (dp - do_i), dJw_i = dz_i
+	result.jacobianDotQd.setZero();
+	for (int i=0; i<dof; i++)
+	{
+		const double r[3] = {p(0) - o[i][0], p(1) - o[i][1], p(2) - o[i][2]};
+		const double dr[3] = {pd[0] - dO[i][0], pd[1] - dO[i][1], pd[2] - dO[i][2]};
+		result.jacobianDotQd(0) += (dz[i][1]*r[2] - dz[i][2]*r[1] + z[i][1]*dr[2] - z[i][2]*dr[1])*dq[i];
+		result.jacobianDotQd(1) += (dz[i][2]*r[0] - dz[i][0]*r[2] + z[i][2]*dr[0] - z[i][0]*dr[2])*dq[i];
+		result.jacobianDotQd(2) += (dz[i][0]*r[1] - dz[i][1]*r[0] + z[i][0]*dr[1] - z[i][1]*dr[0])*dq[i];
+		result.jacobianDotQd(3) += dz[i][0]*dq[i];
+		result.jacobianDotQd(4) += dz[i][1]*dq[i];
+		result.jacobianDotQd(5) += dz[i][2]*dq[i];
+	}
 }
 
-
 const robot::math::Q SerialLink::getQ() const
 {
 	robot::math::Q q = robot::math::Q::zero(getDOF());
@@ -280,15 +507,21 @@ void SerialLink::setQ(robot::math::Q q)
 
 const robot::math::Q SerialLink::getEndVelocity(const robot::kinematic::State& state) const
 {
-	Jacobian jacob = getJacobian(state.getAngle());
-	return jacob*(state.getVelocity());
+	FixedJacobian<6, 6> jacob;
+	getJacobian(getJointTrig(state.getAngle()), jacob);
+	Q endVelocity;
+	jacob.multiply(state.getVelocity(), endVelocity);
+	return endVelocity;
 }
 
 const robot::math::Q SerialLink::getEndVelocity(const robot::math::Q endVelocity, const robot::math::Q robotPos) const
 {
-	Jacobian jacob = getJacobian(robotPos);
-	jacob.doInverse();
-	return (jacob*endVelocity);
+	FixedJacobian<6, 6> jacob;
+	FixedJacobian<6, 6>::Workspace ws;
+	getJacobian(getJointTrig(robotPos), jacob);
+	Q jointVelocity;
+	jacob.solveLU(endVelocity, jointVelocity, ws);
+	return jointVelocity;
 }
 
 Frame* SerialLink::getTool() const
@@ -329,12 +562,12 @@ vector<Q> SerialLink::fixJoint(Q& joint) const
 		double original = joint[i];
 		double jointMin = _linkList[i]->lmin();
 		double jointMax = _linkList[i]->lmax();
-		int kmin = ceil((jointMin - original)/360.0);
-		int kmax = floor((jointMax - original)/360.0);
+		int kmin = ceil((jointMin - original)/(2*M_PI));
+		int kmax = floor((jointMax - original)/(2*M_PI));
 		if (kmin > kmax)
 			return result; //zero result
 		for (int k=kmin; k<=kmax; k++)
-			valueList.push_back(360.0*((double)k) + original);
+			valueList.push_back(2*M_PI*((double)k) + original);
 		jointList.push_back(valueList);
 	}
 	///only for dof = 6
@@ -15,9 +15,16 @@
 # include "../math/Q.h"
 # include "../model/Jacobian.h"
 # include "Jacobian.h"
+# include "FixedJacobian.h"
+# include "KinematicsResult.h"
+# include "KinematicsKernel.h"
 # include "Config.h"
+# include "JointTrig.h"
 # include "../kinematics/State.h"
 # include "../math/Quaternion.h"
+# include "../math/DualQuaternion.h"
+# include "../math/TransformBatch.h"
+# include "../common/ThreadPool.h"
 # include <memory>
 
 using robot::kinematic::Frame;
@@ -89,6 +96,18 @@ public:
 	 */
 	Link::ptr pop();
 
+	/**
+	 * @brief 设置特定机器人的运动学计算核
+	 * @param kernel [in] 计算核(例如model/generated中生成的代码), 为NULL时恢复通用计算
+	 *
+	 * 计算核的关节数与DH参数必须与当前模型一致, 否则抛出异常. 设置后getEndTransform,
+	 * getEndPosition, getJacobian使用计算核计算. append或pop关节后自动取消.
+	 */
+	void setKinematicsKernel(KinematicsKernel::ptr kernel);
+
+	/** @brief 获取运动学计算核, 未设置时为NULL */
+	KinematicsKernel::ptr getKinematicsKernel() const;
+
 	/** @brief 获取关节 */
 	inline Link::ptr getLink(int index) const
 	{
@@ -104,6 +123,14 @@ public:
 	/** @brief 获取DH参数表 */
 	DHTable getDHTable() const;
 
+	/**
+	 * @brief 一次性计算全部关节的正弦余弦
+	 * @param q [in] 关节数值
+	 * @param halfAngle [in] 是否同时计算半角(四元数计算需要)
+	 * @return 可传给getTransform, getEndPosition, getQuaternion, getJacobian等函数的缓存
+	 */
+	JointTrig getJointTrig(const robot::math::Q& q, bool halfAngle=false) const;
+
 	/**
 	 * @brief 获取变换矩阵
 	 * @param startLink [in] 开始关节的索引位置(从0开始)
@@ -113,6 +140,37 @@ public:
 	 */
 	HTransform3D<double> getTransform(unsigned int startLink, unsigned int endLink, const robot::math::Q& q) const;
 
+	/**
+	 * @brief 获取变换矩阵
+	 * @param startLink [in] 开始关节的索引位置(从0开始)
+	 * @param endLink [in] 结束关节的索引位置(从0开始)
+	 * @param trig [in] 关节数值的正弦余弦缓存
+	 * @return 关节startLink到endLink的变换矩阵
+	 */
+	HTransform3D<double> getTransform(unsigned int startLink, unsigned int endLink, const JointTrig& trig) const;
+
+	/**
+	 * @brief 批量获取变换矩阵
+	 * @param startLink [in] 开始关节的索引位置(从0开始)
+	 * @param endLink [in] 结束关节的索引位置(从0开始)
+	 * @param q [in] 多组关节数值
+	 * @param result [out] 第i个为关节数值为q[i]时关节startLink到endLink的变换矩阵
+	 *
+	 * 与逐个调用getTransform的结果完全相同, 但每个关节的DH矩阵与矩阵相乘都以
+	 * TransformBatch批量计算, 适合一次计算整条路径上的大量位姿.
+	 */
+	void getTransform(unsigned int startLink, unsigned int endLink, const std::vector<robot::math::Q>& q, robot::math::TransformBatch& result) const;
+
+	/**
+	 * @brief 批量获取变换矩阵
+	 * @param startLink [in] 开始关节的索引位置(从0开始)
+	 * @param endLink [in] 结束关节的索引位置(从0开始)
+	 * @param q [in] size组关节数值的首地址
+	 * @param size [in] 关节数值的组数
+	 * @param result [out] 第i个为关节数值为q[i]时关节startLink到endLink的变换矩阵
+	 */
+	void getTransform(unsigned int startLink, unsigned int endLink, const robot::math::Q* q, int size, robot::math::TransformBatch& result) const;
+
 	/**
 	 * @brief 获取末端变换矩阵
 	 * @return 当所有关节均为0时, 末端执行器相对于基座标的变换矩阵
@@ -125,6 +183,32 @@ public:
 	 */
 	HTransform3D<double> getEndTransform(const robot::math::Q& q) const;
 
+	/**
+	 * @brief 获取末端变换矩阵
+	 * @param trig [in] 关节数值的正弦余弦缓存
+	 * @return 末端执行器相对于基座标的变换矩阵
+	 */
+	HTransform3D<double> getEndTransform(const JointTrig& trig) const;
+
+	/**
+	 * @brief 批量获取末端变换矩阵
+	 * @param q [in] 多组关节数值
+	 * @param result [out] 第i个为关节为q[i]时, 末端执行器相对于基座标的变换矩阵
+	 */
+	void getEndTransform(const std::vector<robot::math::Q>& q, robot::math::TransformBatch& result) const;
+
+	/**
+	 * @brief 多线程批量获取末端变换矩阵
+	 * @param q [in] 多组关节数值
+	 * @param result [out] 第i个为关节为q[i]时, 末端执行器相对于基座标的变换矩阵
+	 * @param policy [in] 执行策略, 默认在全局线程池中每1024组一块并行计算
+	 *
+	 * 每一块内部使用TransformBatch(SIMD)计算, 结果与逐个调用getEndTransform完全相同.
+	 * 适合离线路径校验等需要计算大量关节位置的场合.
+	 */
+	void getEndTransforms(const std::vector<robot::math::Q>& q, std::vector<HTransform3D<double> >& result,
+			const robot::common::ExecPolicy& policy=robot::common::ExecPolicy()) const;
+
 	/**
 	 * @brief 获取末端的位置
 	 * @return 当所有关节均为0时, 末端执行器的位置
@@ -138,6 +222,13 @@ public:
 	 */
 	Vector3D<double> getEndPosition(const robot::math::Q& q) const;
 
+	/**
+	 * @brief 获取末端的位置
+	 * @param trig [in] 关节数值的正弦余弦缓存
+	 * @return 末端执行器的位置
+	 */
+	Vector3D<double> getEndPosition(const JointTrig& trig) const;
+
 	/**
 	 * @brief 获取四元数表达的旋转量
 	 * @param startLink [in] 开始关节的索引位置(从0开始)
@@ -147,6 +238,15 @@ public:
 	 */
 	Quaternion getQuaternion(unsigned int startLink, unsigned int endLink, const robot::math::Q& q) const;
 
+	/**
+	 * @brief 获取四元数表达的旋转量
+	 * @param startLink [in] 开始关节的索引位置(从0开始)
+	 * @param endLink [in] 结束关节的索引位置(从0开始)
+	 * @param trig [in] 关节数值的正弦余弦缓存, 必须包含半角
+	 * @return 关节startLink到endLink的旋转量(四元数表示)
+	 */
+	Quaternion getQuaternion(unsigned int startLink, unsigned int endLink, const JointTrig& trig) const;
+
 	/**
 	 * @brief 获取末端变换矩阵
 	 * @return 当所有关节均为0时, 末端执行器相对于基座标的旋转量(四元数表示)
@@ -159,6 +259,27 @@ public:
 	 */
 	Quaternion getEndQuaternion(const Q& q) const;
 
+	/**
+	 * @brief 获取末端变换矩阵
+	 * @param trig [in] 关节数值的正弦余弦缓存, 必须包含半角
+	 * @return 末端执行器相对于基座标的旋转量(四元数表示)
+	 */
+	Quaternion getEndQuaternion(const JointTrig& trig) const;
+
+	/**
+	 * @brief 获取末端位姿的对偶四元数
+	 * @param q [in] 关节数值
+	 * @return 当关节为Q时, 末端执行器相对于基座标的位姿(对偶四元数表示), 包含tool
+	 */
+	robot::math::DualQuaternion getEndDualQuaternion(const Q& q) const;
+
+	/**
+	 * @brief 获取末端位姿的对偶四元数
+	 * @param trig [in] 关节数值的正弦余弦缓存, 必须包含半角
+	 * @return 末端执行器相对于基座标的位姿(对偶四元数表示), 包含tool
+	 */
+	robot::math::DualQuaternion getEndDualQuaternion(const JointTrig& trig) const;
+
 	/**
 	 * @brief 获取默认雅克比矩阵
 	 * @return 当所有关节为0时机器人的雅克比矩阵
@@ -173,6 +294,52 @@ public:
 	 */
 	Jacobian getJacobian(const robot::math::Q& q) const;
 
+	/**
+	 * @brief 获取雅克比矩阵
+	 * @param trig [in] 关节数值的正弦余弦缓存
+	 * @return 机器人的雅克比矩阵
+	 */
+	Jacobian getJacobian(const JointTrig& trig) const;
+
+	/**
+	 * @brief 获取定长雅克比矩阵(不申请内存)
+	 * @param trig [in] 关节数值的正弦余弦缓存
+	 * @param result [out] 前N个关节的6XN雅克比矩阵, 包含tool
+	 */
+	template<int N>
+	void getJacobian(const JointTrig& trig, FixedJacobian<6, N>& result) const
+	{
+		fillJacobian(trig, N, result.data());
+	}
+
+	/**
+	 * @brief 由各关节坐标系计算雅克比矩阵
+	 * @param frames [in] 前dof个关节坐标系相对于基坐标系的位姿
+	 * @param dof [in] 列数
+	 * @param endPosition [in] 末端(tool)相对于基坐标系的位置
+	 * @param j [out] 6Xdof的矩阵, 列优先保存
+	 *
+	 * 第i列为@f$ \mathbf{z}_i \times (\mathbf{p} - \mathbf{o}_i) @f$与@f$ \mathbf{z}_i @f$.
+	 * 供已经保存了各关节坐标系的场合(例如KinematicsCache)使用.
+	 */
+	static void getJacobian(const HTransform3D<double>* frames, int dof, const Vector3D<double>& endPosition, double* j);
+
+	/**
+	 * @brief 一次正向递推计算末端位姿, 各关节坐标系, 雅克比矩阵和@f$ \dot{\mathbf{J}}\dot{\mathbf{q}} @f$
+	 * @param q [in] 关节数值
+	 * @param dq [in] 关节速度
+	 * @param result [out] 计算结果, 参见KinematicsResult
+	 */
+	void computeKinematics(const robot::math::Q& q, const robot::math::Q& dq, KinematicsResult& result) const;
+
+	/**
+	 * @brief 一次正向递推计算末端位姿, 各关节坐标系, 雅克比矩阵和@f$ \dot{\mathbf{J}}\dot{\mathbf{q}} @f$
+	 * @param trig [in] 关节数值的正弦余弦缓存
+	 * @param dq [in] 关节速度
+	 * @param result [out] 计算结果, 参见KinematicsResult
+	 */
+	void computeKinematics(const JointTrig& trig, const robot::math::Q& dq, KinematicsResult& result) const;
+
 	/** @brief 获取关节数值 */
 	const robot::math::Q getQ() const;
 
@@ -193,6 +360,8 @@ public:
 	 * @param endVelocity [in] 末端执行器的速度
 	 * @param robotPos [in] 机器人当前的姿态
 	 * @return 各个关节的速度
+	 *
+	 * 使用FixedJacobian<6, 6>的LU分解求解, 雅克比矩阵奇异时抛出异常
 	 */
 	const robot::math::Q getEndVelocity(const robot::math::Q endVelocity, const robot::math::Q robotPos) const;
 
@@ -228,7 +397,7 @@ public:
 	 * @param joint [in] 要处理的关节, 范围是-180~180
 	 * @return 范围内的关节解. 例如范围是-360 - 360, 判断的角度是30, 则将30和-330都添加到结果中
 	 *
-	 * only for dof=6
+	 * only for dof=6. 逆解器使用robot::ik::IKSolutionSet, 按需生成这些组合
 	 */
 	std::vector<Q> fixJoint(Q& joint) const;
 
@@ -238,6 +407,14 @@ public:
 	void print();
 
 	virtual ~SerialLink();
+private:
+	/**
+	 * @brief 计算前dof个关节的雅克比矩阵
+	 * @param trig [in] 关节数值的正弦余弦缓存
+	 * @param dof [in] 列数
+	 * @param j [out] 6Xdof的矩阵, 列优先保存
+	 */
+	void fillJacobian(const JointTrig& trig, int dof, double* j) const;
 private:
 	/** @brief 模型名字 */
 	const std::string _name;
@@ -256,6 +433,9 @@ private:
 	 * 法兰 */
 	Frame _defaultTool;
 
+	/** @brief 运动学计算核 */
+	KinematicsKernel::ptr _kernel;
+
 };
 
 /** @} */
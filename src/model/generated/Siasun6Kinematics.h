@@ -0,0 +1,265 @@
+/**
+ * @brief Siasun6Kinematics类
+ *
+ * 由robot::parse::KinematicsCodeGenerator根据src/example/modelData/siasun6.xml自动生成, 请勿手动修改.
+ */
+
+#ifndef SIASUN6KINEMATICS_H_
+#define SIASUN6KINEMATICS_H_
+
+# include "../KinematicsKernel.h"
+
+namespace robot {
+namespace model {
+namespace generated {
+
+/** @addtogroup model
+ * @{
+ */
+
+/**
+ * @brief Siasun6Kinematics的运动学计算核, 参见KinematicsKernel
+ */
+class Siasun6Kinematics: public KinematicsKernel {
+public:
+	using ptr = std::shared_ptr<Siasun6Kinematics>;
+
+	int getDOF() const
+	{
+		return 6;
+	}
+
+	const char* getName() const
+	{
+		return "Siasun6Kinematics";
+	}
+
+	DHParameters getDHParameters(int i) const
+	{
+		static const double dh[6][4] = {
+				{0, 0, 0.439, 0},
+				{-1.5707963267948966, 0.16, 0, -1.5707963267948966},
+				{0, 0.57499999999999996, 0, 0},
+				{-1.5707963267948966, 0.13, 0.64400000000000002, 0},
+				{1.5707963267948966, 0, 0, 1.5707963267948966},
+				{-1.5707963267948966, 0, 0.1095, 0}};
+		return DHParameters(dh[i][0], dh[i][1], dh[i][2], dh[i][3]);
+	}
+
+	robot::math::HTransform3D<double> getFlangeTransform(const JointTrig& trig) const
+	{
+		const double s1 = trig.s(0), c1 = trig.c(0), s2 = trig.s(1), c2 = trig.c(1), s3 = trig.s(2), c3 = trig.c(2), s4 = trig.s(3), c4 = trig.c(3), s5 = trig.s(4), c5 = trig.c(4), s6 = trig.s(5), c6 = trig.c(5);
+		// 关节1: alpha = 0, a = 0, d = 0.439
+		// 关节2: alpha = -1.5707963267948966, a = 0.16, d = 0
+		const double r00_2 = c1*c2;
+		const double r01_2 = -c1*s2;
+		const double r10_2 = s1*c2;
+		const double r11_2 = -s1*s2;
+		// 关节3: alpha = 0, a = 0.57499999999999996, d = 0
+		const double p0_3 = 0.57499999999999996*r00_2 + 0.16*c1;
+		const double p1_3 = 0.57499999999999996*r10_2 + 0.16*s1;
+		const double p2_3 = -0.57499999999999996*s2 + 0.439;
+		const double r00_3 = r00_2*c3 + r01_2*s3;
+		const double r01_3 = -r00_2*s3 + r01_2*c3;
+		const double r10_3 = r10_2*c3 + r11_2*s3;
+		const double r11_3 = -r10_2*s3 + r11_2*c3;
+		const double r20_3 = -s2*c3 - c2*s3;
+		const double r21_3 = s2*s3 - c2*c3;
+		// 关节4: alpha = -1.5707963267948966, a = 0.13, d = 0.64400000000000002
+		const double p0_4 = 0.13*r00_3 + 0.64400000000000002*r01_3 + p0_3;
+		const double p1_4 = 0.13*r10_3 + 0.64400000000000002*r11_3 + p1_3;
+		const double p2_4 = 0.13*r20_3 + 0.64400000000000002*r21_3 + p2_3;
+		const double r00_4 = r00_3*c4 + s1*s4;
+		const double r01_4 = -r00_3*s4 + s1*c4;
+		const double r10_4 = r10_3*c4 - c1*s4;
+		const double r11_4 = -r10_3*s4 - c1*c4;
+		const double r20_4 = r20_3*c4;
+		const double r21_4 = -r20_3*s4;
+		// 关节5: alpha = 1.5707963267948966, a = 0, d = 0
+		const double r00_5 = r00_4*c5 + r01_3*s5;
+		const double r01_5 = -r00_4*s5 + r01_3*c5;
+		const double r10_5 = r10_4*c5 + r11_3*s5;
+		const double r11_5 = -r10_4*s5 + r11_3*c5;
+		const double r20_5 = r20_4*c5 + r21_3*s5;
+		const double r21_5 = -r20_4*s5 + r21_3*c5;
+		// 关节6: alpha = -1.5707963267948966, a = 0, d = 0.1095
+		const double p0_6 = 0.1095*r01_5 + p0_4;
+		const double p1_6 = 0.1095*r11_5 + p1_4;
+		const double p2_6 = 0.1095*r21_5 + p2_4;
+		const double r00_6 = r00_5*c6 + r01_4*s6;
+		const double r01_6 = -r00_5*s6 + r01_4*c6;
+		const double r10_6 = r10_5*c6 + r11_4*s6;
+		const double r11_6 = -r10_5*s6 + r11_4*c6;
+		const double r20_6 = r20_5*c6 + r21_4*s6;
+		const double r21_6 = -r20_5*s6 + r21_4*c6;
+		return robot::math::HTransform3D<double>(
+				r00_6, r01_6, r01_5, p0_6,
+				r10_6, r11_6, r11_5, p1_6,
+				r20_6, r21_6, r21_5, p2_6);
+	}
+
+	robot::math::Vector3D<double> getPosition(const JointTrig& trig, const robot::math::Vector3D<double>& point) const
+	{
+		const double s1 = trig.s(0), c1 = trig.c(0), s2 = trig.s(1), c2 = trig.c(1), s3 = trig.s(2), c3 = trig.c(2), s4 = trig.s(3), c4 = trig.c(3), s5 = trig.s(4), c5 = trig.c(4), s6 = trig.s(5), c6 = trig.c(5);
+		// 关节1: alpha = 0, a = 0, d = 0.439
+		// 关节2: alpha = -1.5707963267948966, a = 0.16, d = 0
+		const double r00_2 = c1*c2;
+		const double r01_2 = -c1*s2;
+		const double r10_2 = s1*c2;
+		const double r11_2 = -s1*s2;
+		// 关节3: alpha = 0, a = 0.57499999999999996, d = 0
+		const double p0_3 = 0.57499999999999996*r00_2 + 0.16*c1;
+		const double p1_3 = 0.57499999999999996*r10_2 + 0.16*s1;
+		const double p2_3 = -0.57499999999999996*s2 + 0.439;
+		const double r00_3 = r00_2*c3 + r01_2*s3;
+		const double r01_3 = -r00_2*s3 + r01_2*c3;
+		const double r10_3 = r10_2*c3 + r11_2*s3;
+		const double r11_3 = -r10_2*s3 + r11_2*c3;
+		const double r20_3 = -s2*c3 - c2*s3;
+		const double r21_3 = s2*s3 - c2*c3;
+		// 关节4: alpha = -1.5707963267948966, a = 0.13, d = 0.64400000000000002
+		const double p0_4 = 0.13*r00_3 + 0.64400000000000002*r01_3 + p0_3;
+		const double p1_4 = 0.13*r10_3 + 0.64400000000000002*r11_3 + p1_3;
+		const double p2_4 = 0.13*r20_3 + 0.64400000000000002*r21_3 + p2_3;
+		const double r00_4 = r00_3*c4 + s1*s4;
+		const double r01_4 = -r00_3*s4 + s1*c4;
+		const double r10_4 = r10_3*c4 - c1*s4;
+		const double r11_4 = -r10_3*s4 - c1*c4;
+		const double r20_4 = r20_3*c4;
+		const double r21_4 = -r20_3*s4;
+		// 关节5: alpha = 1.5707963267948966, a = 0, d = 0
+		const double r00_5 = r00_4*c5 + r01_3*s5;
+		const double r01_5 = -r00_4*s5 + r01_3*c5;
+		const double r10_5 = r10_4*c5 + r11_3*s5;
+		const double r11_5 = -r10_4*s5 + r11_3*c5;
+		const double r20_5 = r20_4*c5 + r21_3*s5;
+		const double r21_5 = -r20_4*s5 + r21_3*c5;
+		// 关节6: alpha = -1.5707963267948966, a = 0, d = 0.1095
+		const double p0_6 = 0.1095*r01_5 + p0_4;
+		const double p1_6 = 0.1095*r11_5 + p1_4;
+		const double p2_6 = 0.1095*r21_5 + p2_4;
+		const double r00_6 = r00_5*c6 + r01_4*s6;
+		const double r01_6 = -r00_5*s6 + r01_4*c6;
+		const double r10_6 = r10_5*c6 + r11_4*s6;
+		const double r11_6 = -r10_5*s6 + r11_4*c6;
+		const double r20_6 = r20_5*c6 + r21_4*s6;
+		const double r21_6 = -r20_5*s6 + r21_4*c6;
+		const double x = point(0), y = point(1), z = point(2);
+		const double e0 = r00_6*x + r01_6*y + r01_5*z + p0_6;
+		const double e1 = r10_6*x + r11_6*y + r11_5*z + p1_6;
+		const double e2 = r20_6*x + r21_6*y + r21_5*z + p2_6;
+		return robot::math::Vector3D<double>(e0, e1, e2);
+	}
+
+	void getJacobian(const JointTrig& trig, const robot::math::Vector3D<double>& point, double* j) const
+	{
+		const double s1 = trig.s(0), c1 = trig.c(0), s2 = trig.s(1), c2 = trig.c(1), s3 = trig.s(2), c3 = trig.c(2), s4 = trig.s(3), c4 = trig.c(3), s5 = trig.s(4), c5 = trig.c(4), s6 = trig.s(5), c6 = trig.c(5);
+		// 关节1: alpha = 0, a = 0, d = 0.439
+		// 关节2: alpha = -1.5707963267948966, a = 0.16, d = 0
+		const double r00_2 = c1*c2;
+		const double r01_2 = -c1*s2;
+		const double r10_2 = s1*c2;
+		const double r11_2 = -s1*s2;
+		// 关节3: alpha = 0, a = 0.57499999999999996, d = 0
+		const double p0_3 = 0.57499999999999996*r00_2 + 0.16*c1;
+		const double p1_3 = 0.57499999999999996*r10_2 + 0.16*s1;
+		const double p2_3 = -0.57499999999999996*s2 + 0.439;
+		const double r00_3 = r00_2*c3 + r01_2*s3;
+		const double r01_3 = -r00_2*s3 + r01_2*c3;
+		const double r10_3 = r10_2*c3 + r11_2*s3;
+		const double r11_3 = -r10_2*s3 + r11_2*c3;
+		const double r20_3 = -s2*c3 - c2*s3;
+		const double r21_3 = s2*s3 - c2*c3;
+		// 关节4: alpha = -1.5707963267948966, a = 0.13, d = 0.64400000000000002
+		const double p0_4 = 0.13*r00_3 + 0.64400000000000002*r01_3 + p0_3;
+		const double p1_4 = 0.13*r10_3 + 0.64400000000000002*r11_3 + p1_3;
+		const double p2_4 = 0.13*r20_3 + 0.64400000000000002*r21_3 + p2_3;
+		const double r00_4 = r00_3*c4 + s1*s4;
+		const double r01_4 = -r00_3*s4 + s1*c4;
+		const double r10_4 = r10_3*c4 - c1*s4;
+		const double r11_4 = -r10_3*s4 - c1*c4;
+		const double r20_4 = r20_3*c4;
+		const double r21_4 = -r20_3*s4;
+		// 关节5: alpha = 1.5707963267948966, a = 0, d = 0
+		const double r00_5 = r00_4*c5 + r01_3*s5;
+		const double r01_5 = -r00_4*s5 + r01_3*c5;
+		const double r10_5 = r10_4*c5 + r11_3*s5;
+		const double r11_5 = -r10_4*s5 + r11_3*c5;
+		const double r20_5 = r20_4*c5 + r21_3*s5;
+		const double r21_5 = -r20_4*s5 + r21_3*c5;
+		// 关节6: alpha = -1.5707963267948966, a = 0, d = 0.1095
+		const double p0_6 = 0.1095*r01_5 + p0_4;
+		const double p1_6 = 0.1095*r11_5 + p1_4;
+		const double p2_6 = 0.1095*r21_5 + p2_4;
+		const double r00_6 = r00_5*c6 + r01_4*s6;
+		const double r01_6 = -r00_5*s6 + r01_4*c6;
+		const double r10_6 = r10_5*c6 + r11_4*s6;
+		const double r11_6 = -r10_5*s6 + r11_4*c6;
+		const double r20_6 = r20_5*c6 + r21_4*s6;
+		const double r21_6 = -r20_5*s6 + r21_4*c6;
+		const double x = point(0), y = point(1), z = point(2);
+		const double e0 = r00_6*x + r01_6*y + r01_5*z + p0_6;
+		const double e1 = r10_6*x + r11_6*y + r11_5*z + p1_6;
+		const double e2 = r20_6*x + r21_6*y + r21_5*z + p2_6;
+		j[0] = -e1;
+		j[1] = e0;
+		j[2] = 0;
+		j[3] = 0;
+		j[4] = 0;
+		j[5] = 1;
+		const double d0_2 = e0 - 0.16*c1;
+		const double d1_2 = e1 - 0.16*s1;
+		const double d2_2 = e2 - 0.439;
+		j[6] = c1*d2_2;
+		j[7] = s1*d2_2;
+		j[8] = -s1*d1_2 - c1*d0_2;
+		j[9] = -s1;
+		j[10] = c1;
+		j[11] = 0;
+		const double d0_3 = e0 - p0_3;
+		const double d1_3 = e1 - p1_3;
+		const double d2_3 = e2 - p2_3;
+		j[12] = c1*d2_3;
+		j[13] = s1*d2_3;
+		j[14] = -s1*d1_3 - c1*d0_3;
+		j[15] = -s1;
+		j[16] = c1;
+		j[17] = 0;
+		const double d0_4 = e0 - p0_4;
+		const double d1_4 = e1 - p1_4;
+		const double d2_4 = e2 - p2_4;
+		j[18] = r11_3*d2_4 - r21_3*d1_4;
+		j[19] = r21_3*d0_4 - r01_3*d2_4;
+		j[20] = r01_3*d1_4 - r11_3*d0_4;
+		j[21] = r01_3;
+		j[22] = r11_3;
+		j[23] = r21_3;
+		const double d0_5 = e0 - p0_4;
+		const double d1_5 = e1 - p1_4;
+		const double d2_5 = e2 - p2_4;
+		j[24] = -r11_4*d2_5 + r21_4*d1_5;
+		j[25] = -r21_4*d0_5 + r01_4*d2_5;
+		j[26] = -r01_4*d1_5 + r11_4*d0_5;
+		j[27] = -r01_4;
+		j[28] = -r11_4;
+		j[29] = -r21_4;
+		const double d0_6 = e0 - p0_6;
+		const double d1_6 = e1 - p1_6;
+		const double d2_6 = e2 - p2_6;
+		j[30] = r11_5*d2_6 - r21_5*d1_6;
+		j[31] = r21_5*d0_6 - r01_5*d2_6;
+		j[32] = r01_5*d1_6 - r11_5*d0_6;
+		j[33] = r01_5;
+		j[34] = r11_5;
+		j[35] = r21_5;
+	}
+
+	virtual ~Siasun6Kinematics(){}
+};
+
+/** @} */
+} /* namespace generated */
+} /* namespace model */
+} /* namespace robot */
+
+#endif /* SIASUN6KINEMATICS_H_ */
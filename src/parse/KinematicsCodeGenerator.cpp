@@ -0,0 +1,397 @@
+/*
+ * KinematicsCodeGenerator.cpp
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: a1994846931931
+ */
+
+# include "KinematicsCodeGenerator.h"
+# include <fstream>
+# include <stdio.h>
+# include <math.h>
+
+namespace robot {
+namespace parse {
+
+namespace {
+
+/**
+ * @brief 把非常接近0, 1, -1的常数(如cos(pi/2))视为精确值
+ */
+double snap(double value)
+{
+	if (fabs(value) < 1e-12)
+		return 0;
+	if (fabs(value - 1) < 1e-12)
+		return 1;
+	if (fabs(value + 1) < 1e-12)
+		return -1;
+	return value;
+}
+
+/**
+ * @brief 多项相加的表达式, 常数项合并, 同名项合并系数
+ */
+std::string expression(const std::vector<KinematicsCodeGenerator::Term>& terms, std::vector<KinematicsCodeGenerator::Term>& merged, double& constant)
+{
+	merged.clear();
+	constant = 0;
+	for (size_t i=0; i<terms.size(); i++)
+	{
+		if (terms[i].isConstant())
+		{
+			constant += terms[i].value;
+			continue;
+		}
+		size_t k = 0;
+		for (; k<merged.size(); k++)
+		{
+			if (merged[k].name == terms[i].name)
+			{
+				merged[k].value += terms[i].value;
+				break;
+			}
+		}
+		if (k == merged.size())
+			merged.push_back(terms[i]);
+	}
+	constant = snap(constant);
+	std::string expr;
+	for (size_t k=0; k<merged.size(); k++)
+	{
+		if (merged[k].value == 0)
+			continue;
+		char buf[64];
+		std::string item;
+		if (merged[k].value == 1)
+			item = merged[k].name;
+		else if (merged[k].value == -1)
+			item = "-" + merged[k].name;
+		else
+		{
+			snprintf(buf, sizeof(buf), "%.17g", merged[k].value);
+			item = std::string(buf) + "*" + merged[k].name;
+		}
+		if (expr.empty())
+			expr = item;
+		else if (item[0] == '-')
+			expr += " - " + item.substr(1);
+		else
+			expr += " + " + item;
+	}
+	if (constant != 0 || expr.empty())
+	{
+		char buf[64];
+		snprintf(buf, sizeof(buf), "%.17g", constant);
+		std::string item(buf);
+		if (expr.empty())
+			expr = item;
+		else if (item[0] == '-')
+			expr += " - " + item.substr(1);
+		else
+			expr += " + " + item;
+	}
+	return expr;
+}
+
+}
+
+KinematicsCodeGenerator::KinematicsCodeGenerator(SerialLink::ptr robot, const std::string& className, const std::string& source) :
+		_robot(robot),
+		_className(className),
+		_source(source)
+{
+	if (robot->getDOF() > JointTrig::maxDOF)
+		throw("错误<KinematicsCodeGenerator>: 关节数超过JointTrig::maxDOF!");
+}
+
+KinematicsCodeGenerator::Term KinematicsCodeGenerator::multiply(const Term& a, const Term& b)
+{
+	if (a.isZero() || b.isZero() || a.value == 0 || b.value == 0)
+		return Term(0);
+	const double value = snap(a.value*b.value);
+	if (a.isConstant() && b.isConstant())
+		return Term(value);
+	if (a.isConstant())
+		return Term(value, b.name);
+	if (b.isConstant())
+		return Term(value, a.name);
+	return Term(value, a.name + "*" + b.name);
+}
+
+KinematicsCodeGenerator::Term KinematicsCodeGenerator::sum(const std::vector<Term>& terms, const std::string& name, std::ostringstream& out)
+{
+	std::vector<Term> merged;
+	double constant;
+	std::string expr = expression(terms, merged, constant);
+	int count = 0;
+	Term single;
+	for (size_t k=0; k<merged.size(); k++)
+	{
+		if (merged[k].value != 0)
+		{
+			count++;
+			single = merged[k];
+		}
+	}
+	if (count == 0)
+		return Term(constant);
+	if (count == 1 && constant == 0 && single.name.find('*') == std::string::npos)
+		return single; // 单个变量(可能带系数)不需要新变量
+	out << "\t\tconst double " << name << " = " << expr << ";\n";
+	return Term(1, name);
+}
+
+bool KinematicsCodeGenerator::references(const std::vector<Term>& terms, const std::string& name)
+{
+	if (name.empty())
+		return false;
+	for (size_t k=0; k<terms.size(); k++)
+	{
+		if (terms[k].value == 0)
+			continue;
+		/**> 按'*'分开的各个因子 */
+		const std::string& factors = terms[k].name;
+		size_t begin = 0;
+		while (begin <= factors.size())
+		{
+			size_t end = factors.find('*', begin);
+			if (end == std::string::npos)
+				end = factors.size();
+			if (factors.compare(begin, end - begin, name) == 0)
+				return true;
+			begin = end + 1;
+		}
+	}
+	return false;
+}
+
+std::string KinematicsCodeGenerator::toString(const Term& term)
+{
+	std::vector<Term> merged;
+	double constant;
+	return expression(std::vector<Term>(1, term), merged, constant);
+}
+
+std::string KinematicsCodeGenerator::toString(double value)
+{
+	char buf[64];
+	snprintf(buf, sizeof(buf), "%.17g", value);
+	return std::string(buf);
+}
+
+void KinematicsCodeGenerator::emitFrames(std::ostringstream& out, std::vector< std::vector<Term> >& R, std::vector< std::vector<Term> >& p) const
+{
+	const int dof = _robot->getDOF();
+	out << "\t\tconst double ";
+	for (int i=0; i<dof; i++)
+		out << "s" << i + 1 << " = trig.s(" << i << "), c" << i + 1 << " = trig.c(" << i << ")" << ((i + 1 < dof) ? ", " : ";\n");
+
+	std::vector<Term> rot(9);
+	rot[0] = rot[4] = rot[8] = Term(1);
+	std::vector<Term> pos(3);
+	R.clear();
+	p.clear();
+	for (int i=0; i<dof; i++)
+	{
+		Link::ptr link = _robot->getLink(i);
+		const double sa = snap(link->sa());
+		const double ca = snap(link->ca());
+		std::ostringstream index;
+		index << i + 1;
+		const std::string s = "s" + index.str();
+		const std::string c = "c" + index.str();
+		out << "\t\t// 关节" << i + 1 << ": alpha = " << toString(link->alpha()) << ", a = " << toString(link->a())
+				<< ", d = " << toString(link->d()) << "\n";
+
+		// DH矩阵, 参见HTransform3D<T>::DHFast
+		Term B[9] = {
+				Term(1, c), Term(-1, s), Term(0),
+				Term(ca, s), Term(ca, c), Term(-sa),
+				Term(sa, s), Term(sa, c), Term(ca)};
+		Term Bp[3] = {Term(snap(link->a())), Term(snap(-link->d()*sa)), Term(snap(link->d()*ca))};
+
+		std::vector<Term> newRot(9);
+		std::vector<Term> newPos(3);
+		for (int r=0; r<3; r++)
+		{
+			std::vector<Term> terms;
+			for (int k=0; k<3; k++)
+				terms.push_back(multiply(rot[3*r + k], Bp[k]));
+			terms.push_back(pos[r]);
+			newPos[r] = sum(terms, "p" + toString((double)r) + "_" + index.str(), out);
+		}
+		for (int r=0; r<3; r++)
+		{
+			for (int col=0; col<3; col++)
+			{
+				std::vector<Term> terms;
+				for (int k=0; k<3; k++)
+					terms.push_back(multiply(rot[3*r + k], B[3*k + col]));
+				newRot[3*r + col] = sum(terms, "r" + toString((double)r) + toString((double)col) + "_" + index.str(), out);
+			}
+		}
+		rot = newRot;
+		pos = newPos;
+		R.push_back(rot);
+		p.push_back(pos);
+	}
+}
+
+std::vector<KinematicsCodeGenerator::Term> KinematicsCodeGenerator::emitPoint(std::ostringstream& out, const std::vector<Term>& R, const std::vector<Term>& p)
+{
+	out << "\t\tconst double x = point(0), y = point(1), z = point(2);\n";
+	const Term xyz[3] = {Term(1, "x"), Term(1, "y"), Term(1, "z")};
+	std::vector<Term> result(3);
+	for (int r=0; r<3; r++)
+	{
+		std::vector<Term> terms;
+		for (int k=0; k<3; k++)
+			terms.push_back(multiply(R[3*r + k], xyz[k]));
+		terms.push_back(p[r]);
+		result[r] = sum(terms, "e" + toString((double)r), out);
+	}
+	return result;
+}
+
+std::string KinematicsCodeGenerator::generate() const
+{
+	const int dof = _robot->getDOF();
+	std::string guard;
+	for (size_t i=0; i<_className.size(); i++)
+		guard += (char)toupper(_className[i]);
+	guard += "_H_";
+
+	std::ostringstream out;
+	out << "/**\n"
+			<< " * @brief " << _className << "类\n"
+			<< " *\n"
+			<< " * 由robot::parse::KinematicsCodeGenerator根据" << (_source.empty() ? "机器人模型" : _source) << "自动生成, 请勿手动修改.\n"
+			<< " */\n\n"
+			<< "#ifndef " << guard << "\n"
+			<< "#define " << guard << "\n\n"
+			<< "# include \"../KinematicsKernel.h\"\n\n"
+			<< "namespace robot {\n"
+			<< "namespace model {\n"
+			<< "namespace generated {\n\n"
+			<< "/** @addtogroup model\n"
+			<< " * @{\n"
+			<< " */\n\n"
+			<< "/**\n"
+			<< " * @brief " << _className << "的运动学计算核, 参见KinematicsKernel\n"
+			<< " */\n"
+			<< "class " << _className << ": public KinematicsKernel {\n"
+			<< "public:\n"
+			<< "\tusing ptr = std::shared_ptr<" << _className << ">;\n\n";
+
+	out << "\tint getDOF() const\n\t{\n\t\treturn " << dof << ";\n\t}\n\n";
+	out << "\tconst char* getName() const\n\t{\n\t\treturn \"" << _className << "\";\n\t}\n\n";
+
+	out << "\tDHParameters getDHParameters(int i) const\n\t{\n"
+			<< "\t\tstatic const double dh[" << dof << "][4] = {\n";
+	for (int i=0; i<dof; i++)
+	{
+		Link::ptr link = _robot->getLink(i);
+		out << "\t\t\t\t{" << toString(link->alpha()) << ", " << toString(link->a()) << ", "
+				<< toString(link->d()) << ", " << toString(link->theta()) << "}" << ((i + 1 < dof) ? ",\n" : "};\n");
+	}
+	out << "\t\treturn DHParameters(dh[i][0], dh[i][1], dh[i][2], dh[i][3]);\n\t}\n\n";
+
+	std::vector< std::vector<Term> > R, p;
+
+	// 正运动学
+	{
+		std::ostringstream body;
+		emitFrames(body, R, p);
+		const std::vector<Term>& r = R[dof - 1];
+		const std::vector<Term>& t = p[dof - 1];
+		out << "\trobot::math::HTransform3D<double> getFlangeTransform(const JointTrig& trig) const\n\t{\n"
+				<< body.str()
+				<< "\t\treturn robot::math::HTransform3D<double>(\n"
+				<< "\t\t\t\t" << toString(r[0]) << ", " << toString(r[1]) << ", " << toString(r[2]) << ", " << toString(t[0]) << ",\n"
+				<< "\t\t\t\t" << toString(r[3]) << ", " << toString(r[4]) << ", " << toString(r[5]) << ", " << toString(t[1]) << ",\n"
+				<< "\t\t\t\t" << toString(r[6]) << ", " << toString(r[7]) << ", " << toString(r[8]) << ", " << toString(t[2]) << ");\n"
+				<< "\t}\n\n";
+	}
+
+	// 末端位置
+	{
+		std::ostringstream body;
+		emitFrames(body, R, p);
+		std::vector<Term> e = emitPoint(body, R[dof - 1], p[dof - 1]);
+		out << "\trobot::math::Vector3D<double> getPosition(const JointTrig& trig, const robot::math::Vector3D<double>& point) const\n\t{\n"
+				<< body.str()
+				<< "\t\treturn robot::math::Vector3D<double>(" << toString(e[0]) << ", " << toString(e[1]) << ", " << toString(e[2]) << ");\n"
+				<< "\t}\n\n";
+	}
+
+	// 雅克比矩阵: 第i列为z_i X (p - o_i), z_i
+	{
+		std::ostringstream body;
+		emitFrames(body, R, p);
+		std::vector<Term> e = emitPoint(body, R[dof - 1], p[dof - 1]);
+		for (int i=0; i<dof; i++)
+		{
+			const Term z[3] = {R[i][2], R[i][5], R[i][8]};
+			Term r[3];
+			std::ostringstream definitions[3];
+			for (int k=0; k<3; k++)
+			{
+				std::vector<Term> terms;
+				terms.push_back(e[k]);
+				terms.push_back(multiply(Term(-1), p[i][k]));
+				r[k] = sum(terms, "d" + toString((double)k) + "_" + toString((double)(i + 1)), definitions[k]);
+			}
+			std::ostringstream column;
+			std::vector<Term> used;
+			for (int k=0; k<3; k++)
+			{
+				const int k1 = (k + 1)%3;
+				const int k2 = (k + 2)%3;
+				std::vector<Term> terms;
+				terms.push_back(multiply(z[k1], r[k2]));
+				terms.push_back(multiply(multiply(Term(-1), z[k2]), r[k1]));
+				std::vector<Term> merged;
+				double constant;
+				column << "\t\tj[" << 6*i + k << "] = " << expression(terms, merged, constant) << ";\n";
+				used.insert(used.end(), merged.begin(), merged.end());
+			}
+			for (int k=0; k<3; k++)
+				column << "\t\tj[" << 6*i + 3 + k << "] = " << toString(z[k]) << ";\n";
+			/**> z轴的分量为0时, 对应的p - o_i分量用不到, 不输出 */
+			for (int k=0; k<3; k++)
+			{
+				if (references(used, r[k].name))
+					body << definitions[k].str();
+			}
+			body << column.str();
+		}
+		out << "\tvoid getJacobian(const JointTrig& trig, const robot::math::Vector3D<double>& point, double* j) const\n\t{\n"
+				<< body.str()
+				<< "\t}\n\n";
+	}
+
+	out << "\tvirtual ~" << _className << "(){}\n"
+			<< "};\n\n"
+			<< "/** @} */\n"
+			<< "} /* namespace generated */\n"
+			<< "} /* namespace model */\n"
+			<< "} /* namespace robot */\n\n"
+			<< "#endif /* " << guard << " */\n";
+	return out.str();
+}
+
+void KinematicsCodeGenerator::write(const std::string& fileName) const
+{
+	std::ofstream file(fileName.c_str());
+	if (!file)
+		throw(std::string("错误<KinematicsCodeGenerator>: 无法打开文件") + fileName);
+	file << generate();
+}
+
+KinematicsCodeGenerator::~KinematicsCodeGenerator()
+{
+}
+
+} /* namespace parse */
+} /* namespace robot */
@@ -0,0 +1,132 @@
+/**
+ * @brief KinematicsCodeGenerator.h
+ * @date Oct 16, 2026
+ * @author a1994846931931
+ */
+
+#ifndef KINEMATICSCODEGENERATOR_H_
+#define KINEMATICSCODEGENERATOR_H_
+
+# include "../model/SerialLink.h"
+# include <string>
+# include <vector>
+# include <sstream>
+
+using namespace robot::model;
+
+namespace robot {
+namespace parse {
+
+/**
+ * @addtogroup parse
+ * @{
+ */
+
+/**
+ * @brief 运动学代码生成器
+ *
+ * 根据机器人模型(一般由RobotXMLParser从模型文件读取)生成该机器人专用的C++头文件:
+ * 一个继承robot::model::KinematicsKernel的类, 其中正运动学与雅克比矩阵按关节展开,
+ * DH参数全部作为常量代入, 与0相乘的项直接去掉, 与@f$ \pm 1 @f$相乘的项只保留符号.
+ * 生成的头文件放在model/generated中, 通过SerialLink::setKinematicsKernel使用.
+ *
+ * 模型文件修改后重新生成即可, 例如:
+ * @code
+ * SerialLink::ptr robot = RobotXMLParser::parse("src/example/modelData/siasun6.xml");
+ * KinematicsCodeGenerator(robot, "Siasun6Kinematics").write("src/model/generated/Siasun6Kinematics.h");
+ * @endcode
+ */
+class KinematicsCodeGenerator {
+public:
+	/**
+	 * @brief 构造函数
+	 * @param robot [in] 机器人模型
+	 * @param className [in] 生成的类名(同时作为文件名)
+	 * @param source [in] 模型来源(写入生成文件的注释)
+	 */
+	KinematicsCodeGenerator(SerialLink::ptr robot, const std::string& className, const std::string& source="");
+
+	/**
+	 * @brief 生成头文件的内容
+	 */
+	std::string generate() const;
+
+	/**
+	 * @brief 生成头文件并保存
+	 * @param fileName [in] 文件名(包含路径)
+	 */
+	void write(const std::string& fileName) const;
+
+	virtual ~KinematicsCodeGenerator();
+public:
+	/**
+	 * @brief 生成代码中的一项: 常数value, 或者value*name
+	 */
+	class Term {
+	public:
+		Term(double value=0, const std::string& name="") : value(value), name(name){}
+		/** @brief 是否为常数 */
+		bool isConstant() const { return name.empty(); }
+		/** @brief 是否为常数0 */
+		bool isZero() const { return isConstant() && value == 0; }
+		double value;
+		std::string name;
+	};
+private:
+	/**
+	 * @brief 两项相乘
+	 */
+	static Term multiply(const Term& a, const Term& b);
+
+	/**
+	 * @brief 多项相加, 不是单项时输出一条赋值语句并返回新变量
+	 * @param terms [in] 各项
+	 * @param name [in] 新变量名
+	 * @param out [in] 代码输出
+	 */
+	static Term sum(const std::vector<Term>& terms, const std::string& name, std::ostringstream& out);
+
+	/**
+	 * @brief 各项(系数不为0)中是否有变量name作为因子
+	 */
+	static bool references(const std::vector<Term>& terms, const std::string& name);
+
+	/**
+	 * @brief 单项的代码
+	 */
+	static std::string toString(const Term& term);
+
+	/**
+	 * @brief 常数的代码(保留全部有效数字)
+	 */
+	static std::string toString(double value);
+
+	/**
+	 * @brief 输出正运动学的展开计算, 得到各关节坐标系的旋转与位置
+	 * @param out [in] 代码输出
+	 * @param R [out] 每个关节坐标系的旋转矩阵(9项, 行优先)
+	 * @param p [out] 每个关节坐标系的原点(3项)
+	 */
+	void emitFrames(std::ostringstream& out, std::vector< std::vector<Term> >& R, std::vector< std::vector<Term> >& p) const;
+
+	/**
+	 * @brief 输出法兰坐标系中的点point变换到基坐标系的计算
+	 */
+	static std::vector<Term> emitPoint(std::ostringstream& out, const std::vector<Term>& R, const std::vector<Term>& p);
+private:
+	/** @brief 机器人模型 */
+	SerialLink::ptr _robot;
+
+	/** @brief 类名 */
+	std::string _className;
+
+	/** @brief 模型来源 */
+	std::string _source;
+};
+
+/**@}*/
+
+} /* namespace parse */
+} /* namespace robot */
+
+#endif /* KINEMATICSCODEGENERATOR_H_ */
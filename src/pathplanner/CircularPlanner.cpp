@@ -10,6 +10,7 @@
 # include "../model/Config.h"
 # include "../math/Quaternion.h"
 # include "../trajectory/CompositeInterpolator.h"
+# include "../trajectory/PiecewisePolynomial.h"
 # include "../trajectory/ConvertedInterpolator.h"
 # include "../trajectory/CircularInterpolator.h"
 # include "../trajectory/Trajectory.h"
@@ -61,6 +62,7 @@ CircularTrajectory::ptr CircularPlanner::query()
 		_serialLink->getEndTransform(qStart).getRotation(), _serialLink->getEndTransform(_qEnd).getRotation(), Length));
 	/**> 生成Trajectory */
 	Trajectory::ptr trajectory(new Trajectory(std::make_pair(posIpr, rotIpr), _ikSolver, _config));
+	trajectory->setDifferential(true);
 	/**> 直线平滑插补器_l(t) */
 	int count = Length/_dl + 1;
 	count = (count < _countMin)? _countMin : count;
@@ -68,7 +70,7 @@ CircularTrajectory::ptr CircularPlanner::query()
 	double velocity = trajectory->getMaxSpeed(count, _dqLim, _ddqLim, assignedVelocity);
 	double acceleration = assignedAcceleration;
 	SmoothMotionPlanner smPlanner;
-	SequenceInterpolator<double>::ptr lt = smPlanner.query(Length, _h, acceleration, velocity, 0);
+	PiecewisePolynomial<double, 3>::ptr lt = PiecewisePolynomial<double, 3>::fromSequence(smPlanner.query(Length, _h, acceleration, velocity, 0));
 	/**> 返回 */
 	auto origin = std::make_pair(CompositeInterpolator<Vector3D<double> >::ptr(new CompositeInterpolator<Vector3D<double> >(posIpr, lt)),
 			CompositeInterpolator<Rotation3D<double> >::ptr(new CompositeInterpolator<Rotation3D<double> >(rotIpr, lt)));
@@ -126,5 +128,25 @@ Interpolator<Q>::ptr CircularPlanner::getQTrajectory() const
 	return _circularTrajectory;
 }
 
+void CircularPlanner::setReachabilityMap(robot::ik::ReachabilityMap::ptr map)
+{
+	if (map.get() != NULL && map->header().modelHash != robot::ik::ReachabilityMap::modelHash(*_serialLink))
+		throw ("错误<圆弧规划>: 可达性地图与机器人模型不符!");
+	_reachabilityMap = map;
+}
+
+bool CircularPlanner::prescreen() const
+{
+	if (_reachabilityMap.get() == NULL)
+		return true;
+	const HTransform3D<double> start = _serialLink->getEndTransform(_qStop);
+	const HTransform3D<double> end = _serialLink->getEndTransform(_qEnd);
+	CircularInterpolator<Vector3D<double> > arc(start.getPosition(),
+			_serialLink->getEndTransform(_qIntermediate).getPosition(), end.getPosition());
+	/**> 与query相同的姿态插补 */
+	LinearInterpolator<Rotation3D<double> > rotIpr(start.getRotation(), end.getRotation(), arc.getLength());
+	return _reachabilityMap->mayReachPath([&](double s){ return HTransform3D<double>(arc.x(s), rotIpr.x(s)); }, arc.getLength(), _config);
+}
+
 } /* namespace pathplanner */
 } /* namespace robot */
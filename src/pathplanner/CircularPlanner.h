@@ -17,6 +17,7 @@
 # include "../trajectory/LinearInterpolator.h"
 # include "../trajectory/CircularTrajectory.h"
 # include "Planner.h"
+# include "../ik/ReachabilityMap.h"
 # include <memory>
 
 using robot::math::Q;
@@ -100,6 +101,21 @@ public:
 	 */
 	Interpolator<Q>::ptr getQTrajectory() const;
 
+	/**
+	 * @brief 设置可达性地图, 用于prescreen
+	 * @param map [in] 可达性地图, 为NULL时不筛选. 与机器人模型不符时抛出异常
+	 */
+	void setReachabilityMap(robot::ik::ReachabilityMap::ptr map);
+
+	/**
+	 * @brief 用可达性地图筛选路径上各点的位置和姿态(不逆解, 不插补)
+	 * @retval true 没有设置地图, 或者路径可能可以到达
+	 * @retval false 路径可能经过不可到达的区域
+	 * @note 只是建议性的: 地图是采样的, 极少数可以规划的路径也可能不通过筛选, 因此query不检查筛选结果,
+	 * 不通过时应当用query确认(见TaskStack)
+	 */
+	bool prescreen() const;
+
 	virtual ~CircularPlanner(){}
 private:
 	/** @brief 末端预定最大直线速度 */
@@ -147,6 +163,9 @@ private:
     /** @brief 圆弧插补器 */
     CircularTrajectory::ptr _circularTrajectory;
 
+    /** @brief 可达性地图, 可以为NULL */
+    robot::ik::ReachabilityMap::ptr _reachabilityMap;
+
 	/** @brief 采样精度 */
 	const double _dl = 0.1;
 
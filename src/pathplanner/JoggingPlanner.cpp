@@ -23,6 +23,10 @@ JoggingPlanner::JoggingPlanner(std::shared_ptr<robot::ik::IKSolver> ikSolver, ve
 	_jAngle = constraints[5];
 	_dqLim = dqLim;
 	_ddqLim = ddqLim;
+	_lastReach.distance = 0;
+	_lastReach.limit = reachMax;
+	_lastReach.evaluations = 0;
+	_singularityStop = false;
 }
 
 Planner::ptr JoggingPlanner::jogX(Q current, Q &farEnd, bool isPositive, Rotation3D<double> rot)
@@ -88,8 +92,8 @@ JoggingPlanner::~JoggingPlanner()
 
 Planner::ptr JoggingPlanner::planLine(Q current, Q &farEnd, Vector3D<double> direction)
 {
-	Q end = LinePlanner::findReachableEnd(current, direction, _ikSolver); //默认采样长度
-	auto planner = std::make_shared<LinePlanner>(_dqLim, _ddqLim, _vLine, _aLine, _jLine, _ikSolver, current, end); //返回的是已近做好规划的规划器, 可以直接添加到运动堆栈里面
+	_lastReach = LinePlanner::findReachable(current, direction, _ikSolver, 1e-4, _singularityStop); //默认精度
+	auto planner = std::make_shared<LinePlanner>(_dqLim, _ddqLim, _vLine, _aLine, _jLine, _ikSolver, current, _lastReach.q); //返回的是已近做好规划的规划器, 可以直接添加到运动堆栈里面
 	try{
 		planner->query();
 		farEnd = planner->getQTrajectory()->end();
@@ -103,8 +107,8 @@ Planner::ptr JoggingPlanner::planLine(Q current, Q &farEnd, Vector3D<double> dir
 
 Planner::ptr JoggingPlanner::planRotation(Q current, Q &farEnd, Vector3D<double> direction)
 {
-	double theta = RotationPlanner::findReachableTheta(current, direction, _ikSolver); //默认采样长度
-	auto planner = std::make_shared<RotationPlanner>(_dqLim, _ddqLim, _vAngle, _aAngle, _jAngle, _ikSolver, current, direction, theta); //返回的是已近做好规划的规划器, 可以直接添加到运动堆栈里面
+	_lastReach = RotationPlanner::findReachable(current, direction, _ikSolver, 1e-4, _singularityStop); //默认精度
+	auto planner = std::make_shared<RotationPlanner>(_dqLim, _ddqLim, _vAngle, _aAngle, _jAngle, _ikSolver, current, direction, _lastReach.distance); //返回的是已近做好规划的规划器, 可以直接添加到运动堆栈里面
 	try{
 		planner->query();
 		farEnd = planner->getQTrajectory()->end();
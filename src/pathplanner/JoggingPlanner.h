@@ -9,6 +9,7 @@
 
 # include "Planner.h"
 # include "../ik/IKSolver.h"
+# include "ReachableSearch.h"
 
 using std::vector;
 
@@ -57,6 +58,19 @@ public:
 
 	Planner::ptr jogRZ(Q current, Q &farEnd, bool isPositive, Rotation3D<double> rot=Rotation3D<double>());
 
+	/**
+	 * @brief 设置示教时是否在进入奇异区域前停止
+	 * @param stop [in] 为true时搜索最远点时检查奇异点(起点已经处于的奇异区域不限制), 默认为false:
+	 * 只受工作空间和关节范围限制, 越过奇异点造成的关节跳变仍然会停止
+	 */
+	inline void setSingularityStop(bool stop) { _singularityStop = stop; }
+
+	/**
+	 * @brief 上一次示教规划时搜索到的最远点
+	 * @return 最远的距离(m或rad), 关节角和限制原因(工作空间, 关节范围, 关节跳变或奇异点)
+	 */
+	inline ReachResult getLastReach() const { return _lastReach; }
+
 	virtual ~JoggingPlanner();
 
 private:
@@ -96,6 +110,12 @@ private:
 	Q _dqLim;
 
 	Q _ddqLim;
+
+	/**> 上一次搜索到的最远点 */
+	ReachResult _lastReach;
+
+	/**> 是否在进入奇异区域前停止 */
+	bool _singularityStop;
 };
 
 /** @} */
@@ -12,6 +12,7 @@
 # include "../common/common.h"
 # include "../math/Quaternion.h"
 # include "../trajectory/CompositeInterpolator.h"
+# include "../trajectory/PiecewisePolynomial.h"
 # include "../trajectory/Sampler.h"
 # include "SmoothMotionPlanner.h"
 # include "SMPlannerEx.h"
@@ -62,6 +63,7 @@ LineTrajectory::ptr LinePlanner::query()
 		_serialLink->getEndTransform(start).getRotation(), _serialLink->getEndTransform(_qEnd).getRotation(), Length));
 	/**> 生成Trajectory */
 	Trajectory::ptr trajectory(new Trajectory(std::make_pair(posIpr, rotIpr), _ikSolver, _config));
+	trajectory->setDifferential(true);
 	/**> 直线平滑插补器_l(t) */
 	int count = Length/_dl + 1;
 	count = (count < _countMin)? _countMin : count;
@@ -84,7 +86,9 @@ LineTrajectory::ptr LinePlanner::query()
 	TimeOptimalPlanner::optimizeVelocityRestriction(maxSpeed, assignedAcceleration, _h, Length/(count - 1)); //采样速度检测与优化
 //	saveDoublePath(to_string(getUTime()).c_str(), maxSpeed, vl);
 
-	SequenceInterpolator<double>::ptr lt = TimeOptimalPlanner::getOptimalLt(maxSpeed, Length, assignedVelocity, assignedAcceleration, _h, Length/(count - 1)); //获取最优策略
+	/**> 时间最优策略有上千段, 展开成分段多项式 */
+	PiecewisePolynomial<double, 3>::ptr lt = PiecewisePolynomial<double, 3>::fromSequence(
+			TimeOptimalPlanner::getOptimalLt(maxSpeed, Length, assignedVelocity, assignedAcceleration, _h, Length/(count - 1))); //获取最优策略
 //	vector<double> vt = robot::trajectory::Sampler<double>::linspace(0, lt->duration(), 100);
 //	vl = robot::trajectory::Sampler<double>::sample(vt, [&](double t){return lt->x(t);});
 //	vector<double> vv = robot::trajectory::Sampler<double>::sample(vt, [&](double t){return lt->dx(t);});
@@ -149,34 +153,49 @@ Interpolator<Q>::ptr LinePlanner::getQTrajectory() const
 LinePlanner::~LinePlanner() {
 }
 
-Q LinePlanner::findReachableEnd(Q start, Vector3D<double> direction, std::shared_ptr<robot::ik::IKSolver> ikSolver, double dl)
+void LinePlanner::setReachabilityMap(robot::ik::ReachabilityMap::ptr map)
+{
+	if (map.get() != NULL && map->header().modelHash != robot::ik::ReachabilityMap::modelHash(*_serialLink))
+		throw ("错误<直线规划>: 可达性地图与机器人模型不符!");
+	_reachabilityMap = map;
+}
+
+bool LinePlanner::prescreen() const
+{
+	if (_reachabilityMap.get() == NULL)
+		return true;
+	const HTransform3D<double> start = _serialLink->getEndTransform(_qStop);
+	const HTransform3D<double> end = _serialLink->getEndTransform(_qEnd);
+	const Vector3D<double> startPos = start.getPosition();
+	Vector3D<double> direction = end.getPosition() - startPos;
+	const double length = direction.getLength();
+	if (length > 0)
+		direction.doNormalize();
+	/**> 与query相同的姿态插补 */
+	LinearInterpolator<Rotation3D<double> > rotIpr(start.getRotation(), end.getRotation(), length);
+	return _reachabilityMap->mayReachPath([&](double s){
+		return HTransform3D<double>(Vector3D<double>(startPos + direction*s), rotIpr.x(s)); }, length, _config);
+}
+
+Q LinePlanner::findReachableEnd(Q start, Vector3D<double> direction, std::shared_ptr<robot::ik::IKSolver> ikSolver, double tolerance)
+{
+	return findReachable(start, direction, ikSolver, tolerance).q;
+}
+
+ReachResult LinePlanner::findReachable(Q start, Vector3D<double> direction, std::shared_ptr<robot::ik::IKSolver> ikSolver,
+		double tolerance, bool checkSingularity)
 {
-	Config config = ikSolver->getConfig(start);
 	SerialLink::ptr robot = ikSolver->getRobot();
+	/**> 直线的长度不会超过工作空间的直径 */
+	double reach = robot->getTool()->getTransform().getPosition().getLength();
+	for (int i=0; i<robot->getDOF(); i++)
+		reach += fabs(robot->getLink(i)->a()) + fabs(robot->getLink(i)->d());
 	direction.doNormalize();
-	direction = direction*dl;
 	const HTransform3D<double> startTran = robot->getEndTransform(start);
 	const Rotation3D<double> rot = startTran.getRotation();
-	Vector3D<double> pos;
-	pos = startTran.getPosition();
-	Q end = start;
-	do{
-		pos += direction; //下一个位置
-		try{
-			vector<Q> result = ikSolver->solve(HTransform3D<double>(pos, rot), config);
-			end = result[0];
-		}
-		catch(char const*)
-		{
-			break;
-		}
-		catch(std::string &)
-		{
-			break;
-		}
-	}
-	while(true);
-	return end;
+	const Vector3D<double> pos = startTran.getPosition();
+	ReachableSearch search(ikSolver, tolerance, 0.01, checkSingularity ? 0.05 : 0.1, 2*reach, checkSingularity);
+	return search.search(start, [&](double s){ return HTransform3D<double>(pos + direction*s, rot); });
 }
 
 } /* namespace pathplanner */
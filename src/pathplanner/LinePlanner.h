@@ -16,6 +16,8 @@
 # include "../trajectory/LineTrajectory.h"
 # include "../trajectory/LinearInterpolator.h"
 # include "Planner.h"
+# include "ReachableSearch.h"
+# include "../ik/ReachabilityMap.h"
 # include <memory>
 
 using robot::math::Q;
@@ -105,18 +107,48 @@ public:
 	 */
 	Interpolator<Q>::ptr getQTrajectory() const;
 
+	/**
+	 * @brief 设置可达性地图, 用于prescreen
+	 * @param map [in] 可达性地图, 为NULL时不筛选. 与机器人模型不符时抛出异常
+	 */
+	void setReachabilityMap(robot::ik::ReachabilityMap::ptr map);
+
+	/**
+	 * @brief 用可达性地图筛选路径上各点的位置和姿态(不逆解, 不插补)
+	 * @retval true 没有设置地图, 或者路径可能可以到达
+	 * @retval false 路径可能经过不可到达的区域
+	 * @note 只是建议性的: 地图是采样的, 极少数可以规划的路径也可能不通过筛选, 因此query不检查筛选结果,
+	 * 不通过时应当用query确认(见TaskStack)
+	 */
+	bool prescreen() const;
+
 	virtual ~LinePlanner();
 
 public:
 	/**
-	 * @brief 查找沿正方向纯直线平移可到达的最远点
+	 * @brief 查找沿正方向纯直线平移可到达的最远点, 参见findReachable
 	 * @param start [in] 开始点位置
 	 * @param direction [in] 平移的方向
 	 * @param ikSolver [in] 逆解器
-	 * @param dl [in] 采样步长(m)
+	 * @param tolerance [in] 最远距离的精度(m)
 	 * @return 最远点
 	 */
-	static Q findReachableEnd(Q start, Vector3D<double> direction, std::shared_ptr<robot::ik::IKSolver> ikSolver, double dl=0.01);
+	static Q findReachableEnd(Q start, Vector3D<double> direction, std::shared_ptr<robot::ik::IKSolver> ikSolver, double tolerance=1e-4);
+
+	/**
+	 * @brief 查找沿正方向纯直线平移可到达的最远点
+	 * @param start [in] 开始点位置
+	 * @param direction [in] 平移的方向
+	 * @param ikSolver [in] 逆解器
+	 * @param tolerance [in] 最远距离的精度(m)
+	 * @param checkSingularity [in] 是否在进入奇异区域时停止(起点已经处于的奇异区域不限制)
+	 * @return 最远的距离, 关节角和限制原因
+	 *
+	 * 从1cm开始步长加倍(不超过10cm, 检查奇异点时不超过5cm)试探, 再二分到tolerance, 参见ReachableSearch.
+	 * 搜索范围为机器人所有连杆长度之和的两倍.
+	 */
+	static ReachResult findReachable(Q start, Vector3D<double> direction, std::shared_ptr<robot::ik::IKSolver> ikSolver,
+			double tolerance=1e-4, bool checkSingularity=true);
 
 private:
 	/** @brief 末端预定最大直线速度 */
@@ -160,6 +192,9 @@ private:
     /**> 规划器记录的直线轨迹 */
     LineTrajectory::ptr _lineTrajectory;
 
+    /**> 可达性地图, 可以为NULL */
+    robot::ik::ReachabilityMap::ptr _reachabilityMap;
+
 	/** @brief 采样精度 */
 	const double _dl = 0.05; //设置过小会影响时间最优效率
 
@@ -238,10 +238,11 @@ MLABTrajectory::ptr MultiLineArcBlendPlanner::query()
 	/**> 生成lt */
 	vector<SequenceInterpolator<double>::ptr> vlt = getLt(vTrajectory);
 
-	/**> 生成qIpr */
+	/**> 生成qIpr, 插补和烘焙时用微分运动学求解析的速度和加速度 */
 	vector<Interpolator<Q>::ptr> vqIpr;
 	for (int i=0; i<(int)vTrajectory.size(); i++)
 	{
+		vTrajectory[i]->setDifferential(true);
 		vqIpr.push_back(CompositeInterpolator<Q>::ptr(new CompositeInterpolator<Q>(vTrajectory[i], vlt[i])));
 	}
 
@@ -250,6 +251,7 @@ MLABTrajectory::ptr MultiLineArcBlendPlanner::query()
 			std::make_pair(posIpr, rotIpr),
 			_ikSolver,
 			_config);
+	trajectory->setDifferential(true);
 
 	auto lt = std::make_shared<SequenceInterpolator<double> > ();
 	for_each(vlt.begin(), vlt.end(), [&](SequenceInterpolator<double>::ptr ipr){lt->appendInterpolator(ipr);});
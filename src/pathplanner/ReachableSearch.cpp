@@ -0,0 +1,127 @@
+/*
+ * ReachableSearch.cpp
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: a1994846931931
+ */
+
+# include "ReachableSearch.h"
+# include <math.h>
+
+using robot::math::Q;
+using robot::model::Config;
+
+namespace robot {
+namespace pathplanner {
+
+const double ReachableSearch::maxJointJump = M_PI/2;
+
+ReachableSearch::ReachableSearch(std::shared_ptr<robot::ik::IKSolver> ikSolver, double tolerance, double initialStep, double maxStep,
+		double maxDistance, bool checkSingularity) :
+				_ikSolver(ikSolver),
+				_tolerance(tolerance),
+				_initialStep(initialStep),
+				_maxStep(maxStep),
+				_maxDistance(maxDistance),
+				_checkSingularity(checkSingularity)
+{
+	if (tolerance <= 0 || initialStep <= 0 || maxStep < initialStep)
+		throw ("错误<ReachableSearch>: 精度和步长必须大于0, 且步长上限不能小于初始步长!");
+}
+
+ReachResult ReachableSearch::search(const Q& start, const std::function<HTransform3D<double>(double)>& pose) const
+{
+	const Config config = _ikSolver->getConfig(start);
+	const int singular = _checkSingularity ? _ikSolver->singularJudge(start) : 0;
+	ReachResult result;
+	result.distance = 0;
+	result.q = start;
+	result.limit = reachMax;
+	result.evaluations = 0;
+
+	/**> 步长加倍试探, 找到第一个不可到达的点 */
+	double reachable = 0;
+	double step = _initialStep;
+	Q q = start;
+	while (reachable < _maxDistance)
+	{
+		const double s = (reachable + step < _maxDistance) ? reachable + step : _maxDistance;
+		q = result.q;
+		result.evaluations++;
+		ReachLimit limit = evaluate(pose(s), config, singular, q);
+		if (limit == reachMax)
+		{
+			reachable = s;
+			result.q = q;
+			step = (2*step < _maxStep) ? 2*step : _maxStep;
+			continue;
+		}
+
+		/**> 二分 */
+		double unreachable = s;
+		result.limit = limit;
+		while (unreachable - reachable > _tolerance)
+		{
+			const double middle = 0.5*(reachable + unreachable);
+			q = result.q;
+			result.evaluations++;
+			limit = evaluate(pose(middle), config, singular, q);
+			if (limit == reachMax)
+			{
+				reachable = middle;
+				result.q = q;
+			}
+			else
+			{
+				unreachable = middle;
+				result.limit = limit;
+			}
+		}
+		if (result.limit != reachDiscontinuity)
+			break;
+
+		/**> 从二分得到的点再试探一次, 仍然跳变才是真正的不连续 */
+		q = result.q;
+		result.evaluations++;
+		limit = evaluate(pose(unreachable), config, singular, q);
+		if (limit != reachMax)
+		{
+			result.limit = limit;
+			break;
+		}
+		reachable = unreachable;
+		result.q = q;
+		result.limit = reachMax;
+		step = _initialStep;
+	}
+	result.distance = reachable;
+	return result;
+}
+
+ReachLimit ReachableSearch::evaluate(const HTransform3D<double>& pose, const Config& config, int singular, Q& q) const
+{
+	const Q previous = q;
+	switch (_ikSolver->solveNearest(pose, config, q, q))
+	{
+	case robot::ik::ikNoSolution:
+		return reachWorkspace;
+	case robot::ik::ikOutOfRange:
+		return reachJointLimit;
+	default:
+		break;
+	}
+	for (int i=0; i<q.size(); i++)
+		if (fabs(q[i] - previous[i]) > maxJointJump)
+			return reachDiscontinuity;
+	/**> 只在进入起点不在的奇异区域时停止, 起点已经在奇异区域内时仍可以移动(包括离开) */
+	if (_checkSingularity && (_ikSolver->singularJudge(q) & ~singular) != 0)
+		return reachSingularity;
+	return reachMax;
+}
+
+ReachableSearch::~ReachableSearch()
+{
+}
+
+} /* namespace pathplanner */
+} /* namespace robot */
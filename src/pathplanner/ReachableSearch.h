@@ -0,0 +1,114 @@
+/**
+ * @brief ReachableSearch类
+ * @date Oct 16, 2026
+ * @author a1994846931931
+ */
+
+#ifndef REACHABLESEARCH_H_
+#define REACHABLESEARCH_H_
+
+# include "../math/Q.h"
+# include "../math/HTransform3D.h"
+# include "../ik/IKSolver.h"
+# include <functional>
+
+namespace robot {
+namespace pathplanner {
+
+/**
+ * @addtogroup pathplanner
+ * @{
+ */
+
+/**
+ * @brief 可到达范围的限制原因
+ */
+enum ReachLimit{
+	reachMax = 0, /**< 到达了搜索的最大范围 */
+	reachWorkspace, /**< 工作空间的边界(没有逆解, 或者不满足Config) */
+	reachJointLimit, /**< 有逆解, 但超出关节范围 */
+	reachSingularity, /**< 进入起点不在的奇异区域(IKSolver::singularJudge出现起点没有的位) */
+	reachDiscontinuity /**< 关节角在tolerance以内跳变超过ReachableSearch::maxJointJump(通常是经过了奇异点) */
+};
+
+/**
+ * @brief 可到达范围的搜索结果
+ */
+struct ReachResult{
+	/** @brief 可到达的最远距离(直线为m, 旋转为rad) */
+	double distance;
+
+	/** @brief 最远点的关节角 */
+	robot::math::Q q;
+
+	/** @brief 限制原因 */
+	ReachLimit limit;
+
+	/** @brief 逆解的次数 */
+	int evaluations;
+};
+
+/**
+ * @brief 沿一维路径搜索可到达的最远点
+ *
+ * 路径由距离s到末端位姿的函数给出(s=0为起点). 先以initialStep为步长, 每次步长加倍(不超过maxStep)
+ * 向前试探, 直到逆解失败(或超出关节范围, 接近奇异点); 再在最后一个可到达的点和第一个不可到达的点之间二分,
+ * 直到区间小于tolerance. 与逐个步长试探相比, 1m的直线只需要二十次左右的逆解.
+ *
+ * 每一点的逆解使用IKSolver::solveNearest, Config锁定为起点的Config, 参考关节角为上一个可到达的点.
+ * 解与参考关节角相比有关节变化超过maxJointJump时, 这一点也作为边界二分; 二分到tolerance后仍然跳变的
+ * 为真正的不连续(reachDiscontinuity), 否则只是步长太大, 从二分得到的点继续试探. 因此越过奇异点
+ * (分支翻转)的试探不会被当作可到达.
+ *
+ * @warning 二分假设可到达的部分是从起点开始的一段. 宽度小于maxStep, 进出在同一侧的不可到达区间
+ * (例如没有越过的奇异区域)可能被跳过; 检查奇异点时调用者应使用较小的maxStep.
+ */
+class ReachableSearch {
+public:
+	/** @brief 相邻两个可到达点之间每个关节允许的最大变化(rad) */
+	static const double maxJointJump;
+
+	/**
+	 * @brief 构造
+	 * @param ikSolver [in] 逆解器
+	 * @param tolerance [in] 最远距离的精度
+	 * @param initialStep [in] 第一次试探的步长
+	 * @param maxStep [in] 试探步长的上限
+	 * @param maxDistance [in] 搜索的最大范围
+	 * @param checkSingularity [in] 是否在进入奇异区域时停止. 起点已经处于的奇异区域(singularJudge的各位)不限制移动
+	 */
+	ReachableSearch(std::shared_ptr<robot::ik::IKSolver> ikSolver, double tolerance, double initialStep, double maxStep,
+			double maxDistance, bool checkSingularity=true);
+
+	/**
+	 * @brief 搜索
+	 * @param start [in] 起点的关节角
+	 * @param pose [in] 距离为s时的末端位姿
+	 * @return 搜索结果. 起点之后就不可到达时, 距离为0, 关节角为start
+	 */
+	ReachResult search(const robot::math::Q& start, const std::function<HTransform3D<double>(double)>& pose) const;
+
+	virtual ~ReachableSearch();
+private:
+	/**
+	 * @brief 判断一点是否可到达
+	 * @param singular [in] 起点的singularJudge
+	 * @param q [in/out] 输入参考关节角, 可到达时输出解
+	 * @retval reachMax 可到达
+	 * @retval 其它 限制原因
+	 */
+	ReachLimit evaluate(const HTransform3D<double>& pose, const robot::model::Config& config, int singular, robot::math::Q& q) const;
+private:
+	std::shared_ptr<robot::ik::IKSolver> _ikSolver;
+	double _tolerance;
+	double _initialStep;
+	double _maxStep;
+	double _maxDistance;
+	bool _checkSingularity;
+};
+
+/** @} */
+} /* namespace pathplanner */
+} /* namespace robot */
+
+#endif /* REACHABLESEARCH_H_ */
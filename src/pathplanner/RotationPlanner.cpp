@@ -8,6 +8,7 @@
 #include "RotationPlanner.h"
 # include "SmoothMotionPlanner.h"
 # include "SMPlannerEx.h"
+# include "../trajectory/PiecewisePolynomial.h"
 
 using robot::model::Config;
 
@@ -49,7 +50,7 @@ LineTrajectory::ptr RotationPlanner::query()
 	double acceleration = assignedAcceleration;
 
 	SmoothMotionPlanner smPlanner;
-	SequenceInterpolator<double>::ptr lt = smPlanner.query(rotIpr->duration(), _h, acceleration, velocity, 0);
+	PiecewisePolynomial<double, 3>::ptr lt = PiecewisePolynomial<double, 3>::fromSequence(smPlanner.query(rotIpr->duration(), _h, acceleration, velocity, 0));
 	/**> 返回 */
 	auto origin = std::make_pair(CompositeInterpolator<Vector3D<double> >::ptr(new CompositeInterpolator<Vector3D<double> >(posIpr, lt)),
 			CompositeInterpolator<Rotation3D<double> >::ptr(new CompositeInterpolator<Rotation3D<double> >(rotIpr, lt)));
@@ -105,41 +106,20 @@ Interpolator<Q>::ptr RotationPlanner::getQTrajectory() const
 	return _lineTrajectory;
 }
 
-double RotationPlanner::findReachableTheta(Q start, Vector3D<double> n, std::shared_ptr<robot::ik::IKSolver> ikSolver, double da)
+double RotationPlanner::findReachableTheta(Q start, Vector3D<double> n, std::shared_ptr<robot::ik::IKSolver> ikSolver, double tolerance)
+{
+	return findReachable(start, n, ikSolver, tolerance).distance;
+}
+
+ReachResult RotationPlanner::findReachable(Q start, Vector3D<double> n, std::shared_ptr<robot::ik::IKSolver> ikSolver,
+		double tolerance, bool checkSingularity)
 {
-	Config config = ikSolver->getConfig(start);
 	SerialLink::ptr robot = ikSolver->getRobot();
 	const HTransform3D<double> startTran = robot->getEndTransform(start);
 	const Vector3D<double> pos = startTran.getPosition();
 	const Rotation3D<double> startRot = startTran.getRotation();
-	double theta = 0;
-	const double thetaMax = 2*M_PI; //限制一次最多旋转一圈
-	Q result; //用来保存结果,做奇异点检查
-	do{
-		theta += da; //下一个位置 ////////////////////
-		if (theta > thetaMax)
-			break;
-		try{
-			result = ikSolver->solve(HTransform3D<double>(pos, startRot*(Quaternion(theta, n)).toRotation3D()), config)[0];
-			int singular;
-			if ((singular = ikSolver->singularJudge(result)) != 0)
-			{
-				printf("奇异点: %02X\n", singular);
-				break;
-			}
-		}
-		catch(char const*)
-		{
-			break;
-		}
-		catch(std::string &)
-		{
-			break;
-		}
-	}
-	while(true);
-	theta -= da;
-	return theta;
+	ReachableSearch search(ikSolver, tolerance, 0.05, checkSingularity ? 0.1 : 0.2, 2*M_PI, checkSingularity); //限制一次最多旋转一圈
+	return search.search(start, [&](double theta){ return HTransform3D<double>(pos, startRot*(Quaternion(theta, n)).toRotation3D()); });
 }
 
 RotationPlanner::~RotationPlanner() {
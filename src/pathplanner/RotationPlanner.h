@@ -10,6 +10,7 @@
 # include "../trajectory/RotationInterpolator.h"
 # include "../trajectory/LineTrajectory.h"
 # include "Planner.h"
+# include "ReachableSearch.h"
 
 using robot::trajectory::RotationInterpolator;
 
@@ -100,15 +101,29 @@ public:
 	virtual ~RotationPlanner();
 public:
 	/**
-	 * @brief 查找沿旋转方向正方向纯旋转运动可到达的最远点
+	 * @brief 查找沿旋转方向正方向纯旋转运动可到达的最远点, 参见findReachable
 	 * @param start [in] 开始位置
 	 * @param n [in] 旋转方向
 	 * @param ikSolver [in] 逆解器
-	 * @param da [in] 采样步长(rad)
+	 * @param tolerance [in] 最远角度的精度(rad)
 	 * @return 最远可到达的角度
 	 * @note 为防止可能存在无限旋转的情况, 函数实现中限制了最远的距离为 2PI
 	 */
-	static double findReachableTheta(Q start, Vector3D<double> n, std::shared_ptr<robot::ik::IKSolver> ikSolver, double da=0.05);
+	static double findReachableTheta(Q start, Vector3D<double> n, std::shared_ptr<robot::ik::IKSolver> ikSolver, double tolerance=1e-4);
+
+	/**
+	 * @brief 查找沿旋转方向正方向纯旋转运动可到达的最远点
+	 * @param start [in] 开始位置
+	 * @param n [in] 旋转方向
+	 * @param ikSolver [in] 逆解器
+	 * @param tolerance [in] 最远角度的精度(rad)
+	 * @param checkSingularity [in] 是否在进入奇异区域时停止(起点已经处于的奇异区域不限制)
+	 * @return 最远的角度, 关节角和限制原因
+	 *
+	 * 从0.05rad开始步长加倍(不超过0.2rad, 检查奇异点时不超过0.1rad)试探, 再二分到tolerance, 参见ReachableSearch. 最多旋转2PI.
+	 */
+	static ReachResult findReachable(Q start, Vector3D<double> n, std::shared_ptr<robot::ik::IKSolver> ikSolver,
+			double tolerance=1e-4, bool checkSingularity=true);
 private:
 	/** @brief 关节最大速度 */
 	Q _dqLim;
@@ -6,21 +6,32 @@
  */
 
 #include "MotionStack.h"
+# include "../trajectory/BakedTrajectory.h"
 
 namespace robot {
 namespace simulation {
 
 using robot::common::getUTime;
 
-MotionStack::MotionStack(Q& initialQ, std::mutex *mtx) : _mtx(mtx), _staticQ(initialQ), _zero(Q::zero(initialQ.size()))
+MotionStack::MotionStack(Q& initialQ, std::mutex *mtx) : _mtx(mtx), _staticQ(initialQ),
+		_bakePolicy(robot::common::ExecPolicy::sequential, 64), _zero(Q::zero(initialQ.size()))
 {
 	_id = 0;
 	_status = stackEmpty;
 	_recordTime = 0;
 	_size = initialQ.size();
+	_bakeResolution = 0;
+	_bakeTolerance = 1e-6;
 }
 
 int MotionStack::addPlanner(Planner::ptr planner)
+{
+	if ( ! planner->isTrajectoryExist())
+		return 3;
+	return addPlanner(planner, bake(planner));
+}
+
+int MotionStack::addPlanner(Planner::ptr planner, Interpolator<Q>::ptr trajectory)
 {
 	if ( ! planner->isTrajectoryExist())
 		return 3;
@@ -46,7 +57,7 @@ int MotionStack::addPlanner(Planner::ptr planner)
 				)
 			return 4;
 	}
-	_motionQueue.push(motionData{_id++, planner, planner->getQTrajectory()->duration()});
+	_motionQueue.push(motionData{_id++, planner, trajectory->duration(), trajectory});
 	if (_status == stackEmpty)
 		_status = stackWait;
 	return 0;
@@ -71,6 +82,7 @@ int MotionStack::start()
 	}
 	_status = stackNormal;
 	_recordTime = getUTime();
+	_cursor.reset();
 	return 0;
 }
 
@@ -100,7 +112,7 @@ int MotionStack::state(unsigned long long t, State &state)
 			_status = stackStop;
 			return 1;
 		}
-		state = _stopIpr->getState(time);
+		state = _stopIpr->getState(time, _cursor);
 		return 0;
 	}
 	case stackStop://栈不空, 暂停状态
@@ -110,7 +122,7 @@ int MotionStack::state(unsigned long long t, State &state)
 		throw("内部错误, 运动堆栈启动时找到异常状态号\n");
 	}
 	double time = (double(t - _recordTime))/1000000.0; //秒
-	Interpolator<Q>::ptr qIpr = _motionQueue.front().planner->getQTrajectory();
+	Interpolator<Q>::ptr qIpr = _motionQueue.front().trajectory;
 	if ((qIpr->duration()) <= time) //时间超出
 	{
 		_staticQ = qIpr->end();
@@ -123,7 +135,7 @@ int MotionStack::state(unsigned long long t, State &state)
 
 		return 1;
 	}
-	state = qIpr->getState(time);
+	state = qIpr->getState(time, _cursor);
 	return 0;
 }
 
@@ -151,6 +163,7 @@ int MotionStack::pause()
 	{
 		_status = stackPause;
 		_recordTime = getUTime();
+		_cursor.reset();
 		return 0;
 	}
 	else //无法规划暂停路径, 若不处理, 运动堆栈仍可以按照原来的轨迹运行
@@ -178,6 +191,8 @@ int MotionStack::resume(Q &current)
 	}
 	Planner::ptr planner = _motionQueue.front().planner;
 	planner->resume();
+	_motionQueue.front().trajectory = planner->getQTrajectory();
+	_motionQueue.front().duration = _motionQueue.front().trajectory->duration();
 	_status = stackWait;
 	return 0;
 }
@@ -205,6 +220,30 @@ bool MotionStack::clear()
 	return true;
 }
 
+void MotionStack::setBaking(double resolution, double tolerance, const robot::common::ExecPolicy& policy)
+{
+	if (resolution < 0 || tolerance <= 0)
+		throw ("错误<MotionStack>: 烘焙的采样间隔不能小于0, 允许误差必须大于0!");
+	_bakeResolution = resolution;
+	_bakeTolerance = tolerance;
+	_bakePolicy = policy;
+}
+
+Interpolator<Q>::ptr MotionStack::bake(Planner::ptr planner) const
+{
+	Interpolator<Q>::ptr trajectory = planner->getQTrajectory();
+	if (_bakeResolution <= 0 || trajectory.get() == NULL)
+		return trajectory;
+	try
+	{
+		return Interpolator<Q>::ptr(new robot::trajectory::BakedTrajectory(trajectory, _bakeResolution, _bakeTolerance, _bakePolicy));
+	}
+	catch (std::string&)
+	{
+		return trajectory; //误差超过允许误差, 不烘焙
+	}
+}
+
 MotionStack::~MotionStack() {
 	// TODO Auto-generated destructor stub
 }
@@ -10,6 +10,7 @@
 # include <queue>
 # include "../pathplanner/Planner.h"
 # include "../common/common.h"
+# include "../common/ThreadPool.h"
 # include <memory>
 # include <mutex>
 
@@ -58,9 +59,27 @@ public:
 	 * @retval 2 添加路径的初始位置和上一条路径的结束位置不衔接
 	 * @retval 3 添加的规划器中不包含路径
 	 * @retval 4 添加的路径始末速度加速度不为0
+	 * @note 设置了烘焙时在调用线程中烘焙. 调用时持有堆栈锁的, 应先在锁外调用bake, 再用两个参数的addPlanner
 	 */
 	int addPlanner(Planner::ptr planner);
 
+	/**
+	 * @brief 向堆栈中添加路径, 使用事先得到的插补用关节轨迹
+	 * @param planner [in] 添加的规划器指针, 规划器应事先规划好一条路径
+	 * @param trajectory [in] 插补用的关节轨迹, 一般是bake(planner)的结果
+	 * @return 同addPlanner(planner)
+	 */
+	int addPlanner(Planner::ptr planner, Interpolator<Q>::ptr trajectory);
+
+	/**
+	 * @brief 按烘焙设置获取规划器的插补用关节轨迹
+	 *
+	 * 不读写堆栈, 可以在规划线程中不持有堆栈锁调用. 未设置烘焙时返回规划器的关节轨迹;
+	 * 烘焙误差超过允许误差时放弃烘焙, 同样返回规划器的关节轨迹.
+	 * @param planner [in] 已规划好路径的规划器
+	 */
+	Interpolator<Q>::ptr bake(Planner::ptr planner) const;
+
 	/**
 	 * @brief 启动堆
 	 *
@@ -98,6 +117,7 @@ public:
 	 * @retval 0 成功恢复
 	 * @retval 1 不是处于暂停停止阶段
 	 * @warning 恢复后堆栈不会自动打开, 仍需调用start函数
+	 * @note 恢复的路径不烘焙, 以免在重新规划之外进一步延长调用时间
 	 */
 	int resume(Q &current);
 
@@ -118,12 +138,25 @@ public:
 	/**> 获取锁 */
 	inline std::mutex* getMutex(){return _mtx;}
 
+	/**
+	 * @brief 设置轨迹烘焙
+	 * @param resolution [in] 烘焙的采样间隔(秒), 为0时不烘焙(默认)
+	 * @param tolerance [in] 关节角的允许误差(弧度)
+	 * @param policy [in] 烘焙的执行策略, 并行时源插补器必须可以同时在多个线程中求值(见BakedTrajectory)
+	 *
+	 * 烘焙时bake(以及单参数的addPlanner)把规划器的关节轨迹烘焙成BakedTrajectory, state只查表求值,
+	 * 实时线程中不再逆解. 只影响之后添加的规划器.
+	 */
+	void setBaking(double resolution, double tolerance=1e-6,
+			const robot::common::ExecPolicy& policy=robot::common::ExecPolicy(robot::common::ExecPolicy::sequential, 64));
+
 	virtual ~MotionStack();
 protected:
 	struct motionData{
 		int id;
 		Planner::ptr planner;
 		double duration;
+		Interpolator<Q>::ptr trajectory; //插补用的关节轨迹, 烘焙时为BakedTrajectory
 	};
 
 	/**
@@ -149,11 +182,23 @@ private:
 	/**> 用于存放停止路径 */
 	Interpolator<Q>::ptr _stopIpr;
 
+	/**> 当前路径(或停止路径)的插补游标, 启动和暂停时复位 */
+	robot::trajectory::PlaybackCursor _cursor;
+
 	/**> 记录的非运行状态时的关节角度, 用于state返回 */
 	Q& _staticQ;
 
 	/**> 关节个数 */
 	int _size;
+
+	/**> 烘焙的采样间隔, 为0时不烘焙 */
+	double _bakeResolution;
+
+	/**> 烘焙的允许误差 */
+	double _bakeTolerance;
+
+	/**> 烘焙的执行策略 */
+	robot::common::ExecPolicy _bakePolicy;
 private:
 	const Q _zero;
 };
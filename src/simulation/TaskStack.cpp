@@ -42,6 +42,11 @@ void TaskStack::reset(Q start)
 	_error = false;
 }
 
+void TaskStack::setReachabilityMap(robot::ik::ReachabilityMap::ptr map)
+{
+	_reachabilityMap = map;
+}
+
 bool TaskStack::addLine(Q end, double vRatio, double aRatio)
 {
 	if (_error)
@@ -51,8 +56,9 @@ bool TaskStack::addLine(Q end, double vRatio, double aRatio)
 		try{
 			LinePlanner::ptr planner( new LinePlanner(_dqLim, _ddqLim, _velocity*vRatio, _acceleration*aRatio, _jerk, _solver,_start, end));
 			planner->query();
+			Interpolator<Q>::ptr trajectory = _motionStack->bake(planner); //在锁外烘焙
 			_msmtx->lock();
-			int result = _motionStack->addPlanner(planner);
+			int result = _motionStack->addPlanner(planner, trajectory);
 			_msmtx->unlock();
 			if (result == 0)
 			{
@@ -76,6 +82,9 @@ bool TaskStack::addLine(Q end, double vRatio, double aRatio)
 		LinePlanner::ptr planner;
 		try{
 			planner = LinePlanner::ptr( new LinePlanner(_dqLim, _ddqLim, _velocity*vRatio, _acceleration*aRatio, _jerk, _solver, _start, end));
+			planner->setReachabilityMap(_reachabilityMap);
+			if (!planner->prescreen())
+				planner->query(); //筛选只是建议性的, 不通过时逆解确认, 确实无法规划时抛出异常
 			_start = end;
 		}
 		catch(char const* msg) { cout << msg << endl; _error = true; return false;}
@@ -101,8 +110,9 @@ bool TaskStack::addCircle(Q intermediate, Q end, double vRatio, double aRatio)
 		try{
 			CircularPlanner::ptr planner( new CircularPlanner(_dqLim, _ddqLim, _velocity*vRatio, _acceleration*aRatio, _jerk, _solver, intermediate, _start, end));
 			planner->query();
+			Interpolator<Q>::ptr trajectory = _motionStack->bake(planner); //在锁外烘焙
 			_msmtx->lock();
-			int result = _motionStack->addPlanner(planner);
+			int result = _motionStack->addPlanner(planner, trajectory);
 			_msmtx->unlock();
 			if (result == 0)
 			{
@@ -131,6 +141,9 @@ bool TaskStack::addCircle(Q intermediate, Q end, double vRatio, double aRatio)
 		CircularPlanner::ptr planner;
 		try{
 			planner = CircularPlanner::ptr( new CircularPlanner(_dqLim, _ddqLim, _velocity*vRatio, _acceleration*aRatio, _jerk, _solver, intermediate, _start, end));
+			planner->setReachabilityMap(_reachabilityMap);
+			if (!planner->prescreen())
+				planner->query(); //筛选只是建议性的, 不通过时逆解确认, 确实无法规划时抛出异常
 			_start = end;
 		}
 		catch(char const* msg) { cout << msg << endl; _error = true; return false;}
@@ -157,8 +170,9 @@ bool TaskStack::addMLAB(vector<Q> qPath, vector<double> arcRatio, vector<double>
 		try{
 			MultiLineArcBlendPlanner::ptr planner( new MultiLineArcBlendPlanner(_dqLim, _ddqLim, _solver, qPath, arcRatio, velocity, acceleration, jerk));
 			planner->query();
+			Interpolator<Q>::ptr trajectory = _motionStack->bake(planner); //在锁外烘焙
 			_msmtx->lock();
-			int result = _motionStack->addPlanner(planner);
+			int result = _motionStack->addPlanner(planner, trajectory);
 			_msmtx->unlock();
 			if (result == 0)
 			{
@@ -221,9 +235,11 @@ void TaskStack::doQuery()
 		_task.pop();
 		_taskMutex.unlock();
 		try{
-			planner->doQuery();
+			if (!planner->isTrajectoryExist()) //未通过筛选的路径已经规划过
+				planner->doQuery();
+			Interpolator<Q>::ptr trajectory = _motionStack->bake(planner); //在锁外烘焙
 			_msmtx->lock();
-			int result = _motionStack->addPlanner(planner);
+			int result = _motionStack->addPlanner(planner, trajectory);
 			_msmtx->unlock();
 			if (result != 0)
 			{
@@ -10,6 +10,7 @@
 
 # include "MotionStack.h"
 # include "../ik/IKSolver.h"
+# include "../ik/ReachabilityMap.h"
 # include <queue>
 # include <memory>
 # include <mutex>
@@ -61,6 +62,13 @@ public:
 	 */
 	void setMode(int mode);
 
+	/**
+	 * @brief 设置可达性地图. 设置后非阻塞模式下添加直线段和圆弧段时先用地图筛选, 通过筛选的路径
+	 * 在规划线程中规划; 未通过的立即规划确认, 无法规划时直接返回false. 阻塞模式下总是立即规划, 不使用地图
+	 * @param map [in] 可达性地图, 为NULL时不筛选
+	 */
+	void setReachabilityMap(robot::ik::ReachabilityMap::ptr map);
+
 	/**
 	 * @brief 添加直线段MoveL
 	 * @param end [in] 末端位置
@@ -135,6 +143,9 @@ private:
 	/**> 逆解器 */
 	std::shared_ptr<IKSolver> _solver;
 
+	/**> 可达性地图, 可以为NULL */
+	robot::ik::ReachabilityMap::ptr _reachabilityMap;
+
 	/**> 当任务堆栈的某条路径无法规划时, 其后所有的路径都不能规划.
 	 * 当error为true时, 无法再添加路径, 除非使用reset函数重置
 	 */
@@ -0,0 +1,205 @@
+/*
+ * BakedTrajectory.cpp
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: a1994846931931
+ */
+
+# include "BakedTrajectory.h"
+# include <algorithm>
+# include <math.h>
+# include <string>
+
+namespace robot {
+namespace trajectory {
+
+using robot::common::ExecPolicy;
+
+BakedTrajectory::BakedTrajectory(Interpolator<Q>::ptr source, double resolution, double tolerance, const ExecPolicy& policy) :
+		_tolerance(tolerance), _maxError(0)
+{
+	if (source.get() == NULL || source->duration() <= 0)
+		throw ("错误<BakedTrajectory>: 源插补器为空或时长不大于0!");
+	if (resolution <= 0 || tolerance <= 0)
+		throw ("错误<BakedTrajectory>: 采样间隔和允许误差必须大于0!");
+	const double T = source->duration();
+	const int count = std::max(1, (int)ceil(T/resolution));
+	_dof = source->x(0).size();
+
+	/**> 各初始分段的采样点(包括两端), 分块采样和细分 */
+	std::vector<std::vector<Node> > pieces(count);
+	std::vector<double> errors(count, 0);
+	policy.run(count, [&](int begin, int end){
+		Node first = sample(*source, T*begin/count);
+		for (int i=begin; i<end; i++)
+		{
+			Node last = sample(*source, (i == count - 1)? T : T*(i + 1)/count);
+			pieces[i].push_back(first);
+			errors[i] = refine(*source, first, last, 0, pieces[i]);
+			first = last;
+		}
+	});
+
+	/**> 拼接并计算系数 */
+	_breaks.push_back(0);
+	for (int i=0; i<count; i++)
+	{
+		_maxError = std::max(_maxError, errors[i]);
+		for (int k=1; k<(int)pieces[i].size(); k++)
+		{
+			const int index = (int)_breaks.size() - 1;
+			_breaks.push_back(pieces[i][k].t);
+			_coefficients.resize((index + 1)*_dof*6);
+			hermite(pieces[i][k - 1], pieces[i][k], &_coefficients[index*_dof*6]);
+		}
+	}
+	if (_maxError > _tolerance)
+		throw (std::string("错误<BakedTrajectory>: 细分") + std::to_string(maxDepth) + "层后中点误差仍为"
+				+ std::to_string(_maxError) + ", 超过允许误差, 源插补器的导数可能不连续或含有数值差分的噪声!");
+}
+
+BakedTrajectory::Node BakedTrajectory::sample(const Interpolator<Q>& source, double t) const
+{
+	Node node;
+	node.t = t;
+	source.evaluate(t, node.state);
+	return node;
+}
+
+double BakedTrajectory::refine(const Interpolator<Q>& source, const Node& begin, const Node& end, int depth, std::vector<Node>& nodes) const
+{
+	const double h = end.t - begin.t;
+	Node middle = sample(source, begin.t + h/2);
+	std::vector<double> coefficients(_dof*6);
+	hermite(begin, end, &coefficients[0]);
+	/**> 速度和加速度的误差分别乘以h和h^2, 与关节角的误差一起与允许误差比较 */
+	double error = 0;
+	const double s = h/2;
+	for (int j=0; j<_dof; j++)
+	{
+		const double* c = &coefficients[j*6];
+		const double x = ((((c[5]*s + c[4])*s + c[3])*s + c[2])*s + c[1])*s + c[0];
+		const double dx = (((5*c[5]*s + 4*c[4])*s + 3*c[3])*s + 2*c[2])*s + c[1];
+		const double ddx = ((20*c[5]*s + 12*c[4])*s + 6*c[3])*s + 2*c[2];
+		error = std::max(error, fabs(x - middle.state.x[j]));
+		error = std::max(error, fabs(dx - middle.state.dx[j])*h);
+		error = std::max(error, fabs(ddx - middle.state.ddx[j])*h*h);
+	}
+	if (error <= _tolerance || depth >= maxDepth)
+	{
+		nodes.push_back(end);
+		return error;
+	}
+	const double left = refine(source, begin, middle, depth + 1, nodes);
+	const double right = refine(source, middle, end, depth + 1, nodes);
+	return std::max(left, right);
+}
+
+void BakedTrajectory::hermite(const Node& begin, const Node& end, double* coefficients) const
+{
+	const double h = end.t - begin.t;
+	const Q& p0 = begin.state.x;
+	const Q& v0 = begin.state.dx;
+	const Q& a0 = begin.state.ddx;
+	const Q& p1 = end.state.x;
+	const Q& v1 = end.state.dx;
+	const Q& a1 = end.state.ddx;
+	for (int j=0; j<_dof; j++)
+	{
+		/**> 在[0, 1]上归一化的五次Hermite多项式, 再换算成以秒为单位 */
+		const double dp = p1[j] - p0[j];
+		const double V0 = v0[j]*h, V1 = v1[j]*h;
+		const double A0 = a0[j]*h*h, A1 = a1[j]*h*h;
+		double* c = coefficients + j*6;
+		c[0] = p0[j];
+		c[1] = v0[j];
+		c[2] = a0[j]/2;
+		c[3] = (10*dp - 6*V0 - 4*V1 - (3*A0 - A1)/2)/(h*h*h);
+		c[4] = (-15*dp + 8*V0 + 7*V1 + (3*A0 - 2*A1)/2)/(h*h*h*h);
+		c[5] = (6*dp - 3*V0 - 3*V1 - (A0 - A1)/2)/(h*h*h*h*h);
+	}
+}
+
+Q BakedTrajectory::x(double t) const
+{
+	Derivatives<Q> result;
+	evaluate(t, result);
+	return result.x;
+}
+
+Q BakedTrajectory::dx(double t) const
+{
+	Derivatives<Q> result;
+	evaluate(t, result);
+	return result.dx;
+}
+
+Q BakedTrajectory::ddx(double t) const
+{
+	Derivatives<Q> result;
+	evaluate(t, result);
+	return result.ddx;
+}
+
+void BakedTrajectory::evaluate(double t, Derivatives<Q>& result) const
+{
+	horner(search(t), t, result);
+}
+
+void BakedTrajectory::evaluate(double t, Derivatives<Q>& result, PlaybackCursor& cursor) const
+{
+	const int n = size();
+	int index = cursor.index;
+	if (index < 0 || index >= n || (index > 0 && t < _breaks[index]))
+		index = search(t);
+	else if (index < n - 1 && t >= _breaks[index + 1])
+	{
+		index++;
+		if (index < n - 1 && t >= _breaks[index + 1])
+			index = search(t);
+	}
+	cursor.index = index;
+	horner(index, t, result);
+}
+
+double BakedTrajectory::duration() const
+{
+	return _breaks.back();
+}
+
+int BakedTrajectory::size() const
+{
+	return (int)_breaks.size() - 1;
+}
+
+double BakedTrajectory::getMaxError() const
+{
+	return _maxError;
+}
+
+int BakedTrajectory::search(double t) const
+{
+	const int index = std::upper_bound(_breaks.begin() + 1, _breaks.end(), t) - _breaks.begin() - 1;
+	return std::min(index, size() - 1);
+}
+
+void BakedTrajectory::horner(int index, double t, Derivatives<Q>& result) const
+{
+	const double s = t - _breaks[index];
+	const double* c = &_coefficients[index*_dof*6];
+	if (result.x.size() != _dof)
+	{
+		result.x = Q::zero(_dof);
+		result.dx = Q::zero(_dof);
+		result.ddx = Q::zero(_dof);
+	}
+	for (int j=0; j<_dof; j++, c+=6)
+	{
+		result.x(j) = ((((c[5]*s + c[4])*s + c[3])*s + c[2])*s + c[1])*s + c[0];
+		result.dx(j) = (((5*c[5]*s + 4*c[4])*s + 3*c[3])*s + 2*c[2])*s + c[1];
+		result.ddx(j) = ((20*c[5]*s + 12*c[4])*s + 6*c[3])*s + 2*c[2];
+	}
+}
+
+} /* namespace trajectory */
+} /* namespace robot */
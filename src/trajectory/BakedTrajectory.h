@@ -0,0 +1,129 @@
+/**
+ * @brief BakedTrajectory类
+ * @date Oct 16, 2026
+ * @author a1994846931931
+ */
+
+#ifndef BAKEDTRAJECTORY_H_
+#define BAKEDTRAJECTORY_H_
+
+# include "Interpolator.h"
+# include "../common/ThreadPool.h"
+# include "../math/Q.h"
+# include <vector>
+# include <memory>
+
+using robot::math::Q;
+
+namespace robot {
+namespace trajectory {
+
+/** @addtogroup trajectory
+ * @{
+ */
+
+/**
+ * @brief 烘焙的关节轨迹
+ *
+ * 把任意的关节插补器(通常是逆解得到的LineTrajectory, CircularTrajectory, MLABTrajectory)预先采样,
+ * 相邻采样点之间用五次Hermite多项式(两端的关节角, 速度和加速度)连接, 保存成连续的分段点和系数数组.
+ * 之后的x, dx, ddx, evaluate只是查找分段和Horner求值, 不再逆解; 带PlaybackCursor时查找为O(1).
+ *
+ * 采样点通过源插补器的evaluate获取. 采样先按resolution均匀分段, 每段在中点上与源插补器比较: 关节角的误差,
+ * 速度的误差乘以段长h, 加速度的误差乘以h^2, 其中最大的超过tolerance时对半细分(最多细分maxDepth层).
+ * 细分后误差仍超过tolerance时构造函数抛出异常, 不接受不准确的烘焙. ikInterpolator应设为微分模式
+ * (setDifferential(true)), 否则速度和加速度是数值差分的结果, 其噪声通常无法满足允许误差.
+ *
+ * 烘焙后的对象不再改变, 可以在多个线程中同时使用. 烘焙本身需要时间, 应在规划线程中完成(见MotionStack::setBaking).
+ * @warning 并行烘焙要求源插补器可以同时在多个线程中求值. ikInterpolator的结果与求值顺序无关,
+ * 但会调用逆解器, 逆解器不能同时在多个线程中使用时(例如NumericIKSolver)必须用顺序的执行策略(默认).
+ */
+class BakedTrajectory: public Interpolator<Q> {
+public:
+	using ptr = std::shared_ptr<BakedTrajectory>;
+
+	/**
+	 * @brief 构造函数, 烘焙源插补器
+	 * @param source [in] 源插补器, 时长必须大于0
+	 * @param resolution [in] 初始采样间隔(秒)
+	 * @param tolerance [in] 关节角的允许误差(弧度)
+	 * @param policy [in] 执行策略, 并行时按初始分段分块
+	 * @throw std::string 细分maxDepth层后中点误差仍超过tolerance
+	 */
+	BakedTrajectory(Interpolator<Q>::ptr source, double resolution=0.004, double tolerance=1e-6,
+			const robot::common::ExecPolicy& policy=robot::common::ExecPolicy(robot::common::ExecPolicy::sequential, 64));
+
+	Q x(double t) const;
+
+	Q dx(double t) const;
+
+	Q ddx(double t) const;
+
+	void evaluate(double t, Derivatives<Q>& result) const;
+
+	/**
+	 * @brief 带游标的evaluate, 按时间顺序插补时查找分段为O(1)
+	 */
+	void evaluate(double t, Derivatives<Q>& result, PlaybackCursor& cursor) const;
+
+	double duration() const;
+
+	/** @brief 分段的个数 */
+	int size() const;
+
+	/** @brief 烘焙时各段中点上的最大误差(见类的说明) */
+	double getMaxError() const;
+
+	virtual ~BakedTrajectory(){}
+public:
+	/** @brief 最多的细分层数 */
+	static const int maxDepth = 8;
+private:
+	/** @brief 采样点 */
+	struct Node{
+		double t;
+		Derivatives<Q> state;
+	};
+
+	/** @brief 源插补器在t处的采样点 */
+	Node sample(const Interpolator<Q>& source, double t) const;
+
+	/**
+	 * @brief 细分[begin, end], 把除begin以外的采样点按时间顺序加到nodes末尾
+	 * @return 各段中点上的最大误差
+	 */
+	double refine(const Interpolator<Q>& source, const Node& begin, const Node& end, int depth, std::vector<Node>& nodes) const;
+
+	/**
+	 * @brief 两个采样点之间的五次Hermite多项式系数
+	 * @param coefficients [out] 每个关节6个, 从常数项开始, 以begin.t为0
+	 */
+	void hermite(const Node& begin, const Node& end, double* coefficients) const;
+
+	/** @brief 二分查找t所在的段 */
+	int search(double t) const;
+
+	/** @brief 第index段在t处的关节角, 速度和加速度 */
+	void horner(int index, double t, Derivatives<Q>& result) const;
+private:
+	/** @brief 关节数 */
+	int _dof;
+
+	/** @brief 允许误差 */
+	double _tolerance;
+
+	/** @brief 分段点, 第一个为0, 最后一个为总时长 */
+	std::vector<double> _breaks;
+
+	/** @brief 系数, 每段每个关节6个 */
+	std::vector<double> _coefficients;
+
+	/** @brief 各段中点上的最大误差 */
+	double _maxError;
+};
+
+/** @} */
+} /* namespace trajectory */
+} /* namespace robot */
+
+#endif /* BAKEDTRAJECTORY_H_ */
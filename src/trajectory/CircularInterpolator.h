@@ -184,6 +184,29 @@ public:
         return (_T.getRotation())*v;
     }
 
+    /**
+     * @brief 位置, 速度和加速度, 三角函数只计算一次
+     */
+    void evaluate(double t, Derivatives<Vector3D<T> >& result) const
+    {
+        const double a = (_tend-_tstart)/_duration;
+        const double tau = a*t + _tstart;
+        const double s = sin(tau);
+        const double c = cos(tau);
+
+        Vector3D<T> v;
+        v[0] = _r*c+_cx;
+        v[1] = _r*s+_cy;
+        v[2] = 0;
+        result.x = _T*v;
+        v[0] = -_r*a*s;
+        v[1] = _r*a*c;
+        result.dx = _T.getRotation()*v;
+        v[0] = -_r*a*a*c;
+        v[1] = -_r*a*a*s;
+        result.ddx = (_T.getRotation())*v;
+    }
+
     double duration() const
     {
     	return _duration;
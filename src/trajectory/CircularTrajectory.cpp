@@ -13,10 +13,11 @@ namespace trajectory {
 CircularTrajectory::CircularTrajectory(std::pair<Interpolator<Vector3D<double> >::ptr , Interpolator<Rotation3D<double> >::ptr >  origin,
 		std::shared_ptr<robot::ik::IKSolver> iksolver,
 		robot::model::Config config,
-		SequenceInterpolator<double>::ptr lt,
+		Interpolator<double>::ptr lt,
 		Trajectory::ptr trajectory)
 :_qIpr(new ikInterpolator(origin, iksolver, config)), _lt(lt), _trajectory(trajectory)
 {
+	_qIpr->setDifferential(trajectory->isDifferential());
 }
 
 Q CircularTrajectory::x(double t) const
@@ -34,6 +35,26 @@ Q CircularTrajectory::ddx(double t) const
 	return _qIpr->ddx(t);
 }
 
+void CircularTrajectory::evaluate(double t, Derivatives<Q>& result) const
+{
+	_qIpr->evaluate(t, result);
+}
+
+State CircularTrajectory::getState(double t, double precision) const
+{
+	return _qIpr->getState(t, precision);
+}
+
+void CircularTrajectory::evaluate(double t, Derivatives<Q>& result, PlaybackCursor& cursor) const
+{
+	_qIpr->evaluate(t, result, cursor);
+}
+
+State CircularTrajectory::getState(double t, PlaybackCursor& cursor) const
+{
+	return _qIpr->getState(t, cursor);
+}
+
 double CircularTrajectory::l(double t) const
 {
 	return _lt->x(t);
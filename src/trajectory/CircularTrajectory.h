@@ -39,13 +39,35 @@ public:
 	CircularTrajectory(std::pair<Interpolator<Vector3D<double> >::ptr , Interpolator<Rotation3D<double> >::ptr >  origin,
 			std::shared_ptr<robot::ik::IKSolver> iksolver,
 			robot::model::Config config,
-			SequenceInterpolator<double>::ptr lt,
+			Interpolator<double>::ptr lt,
 			Trajectory::ptr trajectory);
 
 	Q x(double t) const;
 	Q dx(double t) const;
 	Q ddx(double t) const;
 
+	/**
+	 * @brief 关节角, 速度和加速度, 见ikInterpolator::evaluate
+	 */
+	void evaluate(double t, Derivatives<Q>& result) const;
+
+	/**
+	 * @brief 关节角, 速度和加速度
+	 *
+	 * 路径插补器为微分运动学模式(ikInterpolator::setDifferential)时只逆解一次
+	 */
+	State getState(double t, double precision=0.00001) const;
+
+	/**
+	 * @brief 带游标的evaluate, 游标用于查找速度规划(lt)的分段
+	 */
+	void evaluate(double t, Derivatives<Q>& result, PlaybackCursor& cursor) const;
+
+	/**
+	 * @brief 带游标获得State, 游标用于查找速度规划(lt)的分段, 见ikInterpolator::getState(t, cursor)
+	 */
+	State getState(double t, PlaybackCursor& cursor) const;
+
 	/**
 	 * @brief 获取时间索引t处的路径长度
 	 * @param t [in] 时间索引
@@ -78,7 +100,7 @@ protected:
 	ikInterpolator::ptr _qIpr;
 
 	/**> 直线距离-时间插补器 */
-	SequenceInterpolator<double>::ptr _lt;
+	Interpolator<double>::ptr _lt;
 
 	/**> 关节路径 - 长度为索引 */
 	Trajectory::ptr _trajectory;
@@ -62,7 +62,28 @@ public:
 
 	T ddx(double t) const
 	{
-		return (_interpolator->ddx(_mapper->x(t)))*pow((_mapper->dx(t)), 2) + (_interpolator->dx(_mapper->x(t)))*(_mapper->ddx(t));
+		const double s = _mapper->x(t);
+		return (_interpolator->ddx(s))*pow((_mapper->dx(t)), 2) + (_interpolator->dx(s))*(_mapper->ddx(t));
+	}
+
+	/**
+	 * @brief 位置, 速度和加速度, 映射器和主插补器各求值一次
+	 */
+	void evaluate(double t, Derivatives<T>& result) const
+	{
+		Derivatives<double> e;
+		_mapper->evaluate(t, e);
+		compose(e, result);
+	}
+
+	/**
+	 * @brief 带游标的evaluate, 游标用于映射器(例如分段的速度规划)
+	 */
+	void evaluate(double t, Derivatives<T>& result, PlaybackCursor& cursor) const
+	{
+		Derivatives<double> e;
+		_mapper->evaluate(t, e, cursor);
+		compose(e, result);
 	}
 
 	double duration() const
@@ -71,6 +92,17 @@ public:
 	}
 	virtual ~CompositeInterpolator(){}
 private:
+	/**
+	 * @brief 由映射器的值和导数求复合后的值和导数
+	 */
+	void compose(const Derivatives<double>& e, Derivatives<T>& result) const
+	{
+		Derivatives<T> f;
+		_interpolator->evaluate(e.x, f);
+		result.x = f.x;
+		result.dx = (f.dx)*(e.dx);
+		result.ddx = (f.ddx)*pow((e.dx), 2) + (f.dx)*(e.ddx);
+	}
 	/**
 	 * @brief 主插补器地址
 	 */
@@ -110,7 +142,6 @@ public:
 
 	T x(double t) const
 	{
-		_interpolator->x(_factor*t);
 		return _interpolator->x(_factor*t);
 	}
 
@@ -124,6 +155,13 @@ public:
 		return (_interpolator->ddx(_factor*t))*(_factor*_factor);
 	}
 
+	void evaluate(double t, Derivatives<T>& result) const
+	{
+		_interpolator->evaluate(_factor*t, result);
+		result.dx = (result.dx)*_factor;
+		result.ddx = (result.ddx)*(_factor*_factor);
+	}
+
 	double duration() const
 	{
 		return (_interpolator->duration())/_factor;;
@@ -14,6 +14,8 @@
 # include <memory>
 # include "../ik/IKSolver.h"
 # include "../model/Config.h"
+# include "../model/KinematicsResult.h"
+# include "../model/FixedJacobian.h"
 # include "../common/printAdvance.h"
 # include <functional>
 # include <algorithm>
@@ -69,10 +71,25 @@ public:
 		return _transformddx(_OriginalInterpolator->ddx(t));
 	}
 
+	void evaluate(double t, Derivatives<T>& result) const
+	{
+		Derivatives<B> origin;
+		_OriginalInterpolator->evaluate(t, origin);
+		result.x = _transformx(origin.x);
+		result.dx = _transformdx(origin.dx);
+		result.ddx = _transformddx(origin.ddx);
+	}
+
 	double duration() const
 	{
 		return _OriginalInterpolator->duration();
 	}
+
+	/** @brief 源插补器 */
+	std::shared_ptr<Interpolator<B> > getOrigin() const
+	{
+		return _OriginalInterpolator;
+	}
 	virtual ~ConvertedInterpolator(){}
 private:
 	/** @brief 源插补器 */
@@ -125,6 +142,21 @@ public:
 		return q;
 	}
 
+	void evaluate(double t, Derivatives<robot::math::Q>& result) const
+	{
+		result.x = robot::math::Q::zero(_size);
+		result.dx = robot::math::Q::zero(_size);
+		result.ddx = robot::math::Q::zero(_size);
+		Derivatives<double> joint;
+		for (int i=0; i<_size; i++)
+		{
+			_interpolatorList[i]->evaluate(t, joint);
+			result.x(i) = joint.x;
+			result.dx(i) = joint.dx;
+			result.ddx(i) = joint.ddx;
+		}
+	}
+
 	double duration() const
 	{
 		return _interpolatorList[0]->duration();
@@ -153,54 +185,343 @@ public:
 	 */
 	ConvertedInterpolator(std::pair<Interpolator<Vector3D<double> >::ptr , Interpolator<Rotation3D<double> >::ptr >  origin,
 			std::shared_ptr<robot::ik::IKSolver> iksolver,
-			robot::model::Config config):_config(config)
+			robot::model::Config config):_config(config), _differential(false)
 	{
 		_ikSolver = iksolver;
+		_serialLink = iksolver->getRobot();
 		_posInterpolator = origin.first;
 		_rotInterpolator = origin.second;
 		if (fabs(_posInterpolator->duration() - _rotInterpolator->duration()) > 0.001)
 			common::println("警告<ikInterpolator>: 位置插补器与姿态插补器的周期不同!");
+		initReferences();
 	}
 
+	/**
+	 * @brief 插补点的关节角
+	 *
+	 * 用solveNearest只计算同一分支中最接近t所在区间的参考关节角的解(见initReferences), 保证连续的轨迹上
+	 * 关节角连续(不会在+-180处跳变). 结果只与t有关, 与之前求值的时刻和顺序无关.
+	 */
 	virtual robot::math::Q x(double t) const
 	{
-		try{
-			std::vector<robot::math::Q> result = (_ikSolver->solve(HTransform3D<double>(_posInterpolator->x(t), _rotInterpolator->x(t)), _config));
-			if ((int)result.size() <= 0)
-			{
-				robot::common::println("无法逆解的末端位姿: ");
-				HTransform3D<double>(_posInterpolator->x(t), _rotInterpolator->x(t)).print();
-				throw (std::string("错误<ikInterpolator>: 无法进行逆解!"));
-			}
-			return result[0];
-		}
-		catch(std::string& msg)
-		{
-			throw(std::string("错误<ikInterpolator>: 无法进行逆解!\n") + msg);
-		}
+		return solve(t, HTransform3D<double>(_posInterpolator->x(t), _rotInterpolator->x(t)));
 	}
 
-	/** @todo 如何处理 */
+	/**
+	 * @brief 插补点的关节速度
+	 *
+	 * 微分运动学模式下为@f$ \mathbf{J}^{-1}\dot{\mathbf{x}} @f$, 否则(或者雅克比矩阵奇异时)为差分.
+	 */
 	virtual robot::math::Q dx(double t) const
 	{
+		robot::math::Q q, dq;
+		if (_differential && differentiate(t, q, dq, NULL))
+			return dq;
 		return (this->x(t + 0.0001) - this->x(t))*10000.0;
 	}
 
+	/**
+	 * @brief 插补点的关节加速度
+	 *
+	 * 微分运动学模式下为@f$ \mathbf{J}^{-1}(\ddot{\mathbf{x}} - \dot{\mathbf{J}}\dot{\mathbf{q}}) @f$,
+	 * 否则(或者雅克比矩阵奇异时)为差分.
+	 */
 	virtual robot::math::Q ddx(double t) const
 	{
+		robot::math::Q q, dq, ddq;
+		if (_differential && differentiate(t, q, dq, &ddq))
+			return ddq;
 		return ((this->x(t + 0.0002)) - (this->x(t + 0.0001))*2.0 +( this->x(t)))*100000000.0;
 	}
 
+	/**
+	 * @brief 插补点的关节角, 速度和加速度
+	 *
+	 * 微分运动学模式下位置和姿态插补器各求值一次(evaluate), 只逆解一次, 速度和加速度由雅克比矩阵求出;
+	 * 否则(或者雅克比矩阵奇异时)与dx(t), ddx(t)相同, 用差分计算, 共逆解三次.
+	 */
+	virtual void evaluate(double t, Derivatives<robot::math::Q>& result) const
+	{
+		if (_differential)
+		{
+			Derivatives<Vector3D<double> > pos;
+			Derivatives<Rotation3D<double> > rot;
+			_posInterpolator->evaluate(t, pos);
+			_rotInterpolator->evaluate(t, rot);
+			evaluate(t, pos, rot, result);
+		}
+		else
+			difference(t, this->x(t), result);
+	}
+
+	/**
+	 * @brief 带游标的evaluate
+	 *
+	 * 微分运动学模式下把游标传给位置和姿态插补器(例如CompositeInterpolator的速度规划), 否则与evaluate(t)相同.
+	 */
+	virtual void evaluate(double t, Derivatives<robot::math::Q>& result, PlaybackCursor& cursor) const
+	{
+		if (_differential)
+		{
+			Derivatives<Vector3D<double> > pos;
+			Derivatives<Rotation3D<double> > rot;
+			_posInterpolator->evaluate(t, pos, cursor);
+			_rotInterpolator->evaluate(t, rot, cursor);
+			evaluate(t, pos, rot, result);
+		}
+		else
+			evaluate(t, result);
+	}
+
+	/**
+	 * @brief 插补点的关节角, 速度和加速度
+	 *
+	 * 微分运动学模式下与evaluate相同, 只逆解一次; 否则以precision为间隔差分, 共逆解三次.
+	 */
+	virtual State getState(double t, double precision=0.00001) const
+	{
+		if (_differential)
+			return Interpolator<robot::math::Q>::getState(t, precision);
+		robot::math::Q x0 = this->x(t);
+		robot::math::Q x1 = this->x(t + precision);
+		robot::math::Q x2 = this->x(t + precision*2);
+		robot::math::Q dx = (x1 - x0)/precision;
+		robot::math::Q ddx = (x0 + x2 - x1*2.0)/(precision*precision);
+		return State(x0, dx, ddx);
+	}
+
+	/**
+	 * @brief 带游标获得State
+	 *
+	 * 微分运动学模式下与evaluate(t, result, cursor)相同; 否则与getState(t)相同, 以默认的precision差分.
+	 */
+	virtual State getState(double t, PlaybackCursor& cursor) const
+	{
+		if (_differential)
+			return Interpolator<robot::math::Q>::getState(t, cursor);
+		return getState(t);
+	}
+
+	/**
+	 * @brief 设置是否使用微分运动学计算关节速度和加速度
+	 * @param differential [in] true: 由位置和姿态插补器的导数经雅克比矩阵求出; false(默认): 对x(t)差分
+	 *
+	 * 位置和姿态插补器都需要提供正确的dx和ddx(姿态插补器的导数为旋转矩阵的导数).
+	 */
+	void setDifferential(bool differential)
+	{
+		_differential = differential;
+	}
+
+	/** @brief 是否使用微分运动学计算关节速度和加速度 */
+	bool isDifferential() const
+	{
+		return _differential;
+	}
+
 	double duration() const
 	{
 		return _posInterpolator->duration();
 	}
 
 	virtual ~ConvertedInterpolator(){}
+protected:
+	/**
+	 * @brief 由位置和姿态插补器的结果求关节角, 速度和加速度, 雅克比矩阵奇异时速度和加速度用差分
+	 */
+	void evaluate(double t, const Derivatives<Vector3D<double> >& pos, const Derivatives<Rotation3D<double> >& rot,
+			Derivatives<robot::math::Q>& result) const
+	{
+		const robot::math::Q q = solve(t, HTransform3D<double>(pos.x, rot.x));
+		if (differentiate(pos, rot, q, result.dx, &result.ddx))
+			result.x = q;
+		else
+			difference(t, q, result);
+	}
+
+	/**
+	 * @brief 以0.0001为间隔差分求速度和加速度
+	 * @param x [in] t处的关节角
+	 */
+	void difference(double t, const robot::math::Q& x, Derivatives<robot::math::Q>& result) const
+	{
+		const robot::math::Q x1 = this->x(t + 0.0001);
+		const robot::math::Q x2 = this->x(t + 0.0002);
+		result.x = x;
+		result.dx = (x1 - x)*10000.0;
+		result.ddx = (x2 - x1*2.0 + x)*100000000.0;
+	}
+
+	/**
+	 * @brief 逆解(x(t)的实现)
+	 * @param t [in] 时间, 用于选择参考关节角
+	 * @param end [in] t时刻的末端位姿
+	 * @return 关节角, 无解时抛出异常
+	 */
+	robot::math::Q solve(double t, const HTransform3D<double>& end) const
+	{
+		robot::math::Q q;
+		const robot::ik::IKStatus status = solve(end, reference(t), q);
+		if (status != robot::ik::ikSuccess)
+		{
+			throw(std::string("错误<ikInterpolator>: 无法进行逆解!\n")
+					+ ((status == robot::ik::ikOutOfRange) ? "没有符合范围的解!" : "没有解!"));
+		}
+		return q;
+	}
+
+	/**
+	 * @brief 逆解
+	 * @param end [in] 末端位姿
+	 * @param reference [in] 参考关节角, 为空时取solveInto的第一个解
+	 * @param q [out] 关节角
+	 * @return 结果状态
+	 */
+	robot::ik::IKStatus solve(const HTransform3D<double>& end, const robot::math::Q& reference, robot::math::Q& q) const
+	{
+		if (reference.size() != 0)
+			return _ikSolver->solveNearest(end, _config, reference, q);
+		robot::ik::IKSolutionSet result;
+		const robot::ik::IKStatus status = _ikSolver->solveInto(end, _config, result);
+		if (status == robot::ik::ikSuccess)
+			result.get(0, q);
+		return status;
+	}
+
+	/**
+	 * @brief 计算参考关节角
+	 *
+	 * 先把位置插补器的[0, duration()]等分为initialReferenceCount个区间, 在各分段点逆解: 起点取solveInto的第一个解,
+	 * 之后的取最接近前一个的解. 相邻的参考关节角有关节相差不小于pi/2时对半细分(最多maxReferenceDepth层),
+	 * 因此区间内的转动不会使由参考关节角求出的解跳过一个分支. 细分到最后仍然相差很大的是路径本身的不连续(例如经过奇异点).
+	 * 无解的点沿用前一个参考关节角(起点无解时为空).
+	 */
+	void initReferences()
+	{
+		const double T = _posInterpolator->duration();
+		robot::math::Q q;
+		solve(HTransform3D<double>(_posInterpolator->x(0), _rotInterpolator->x(0)), robot::math::Q(), q);
+		_referenceTimes.assign(1, 0);
+		_references.assign(1, q);
+		for (int i=1; i<=initialReferenceCount; i++)
+		{
+			const robot::math::Q previous = _references.back();
+			appendReferences(T*(i - 1)/initialReferenceCount, previous, T*i/initialReferenceCount, 0);
+		}
+	}
+
+	/**
+	 * @brief 添加(t0, t1]上的参考关节角, 必要时细分
+	 * @param q0 [in] t0处的参考关节角
+	 */
+	void appendReferences(double t0, const robot::math::Q& q0, double t1, int depth)
+	{
+		robot::math::Q q1;
+		if (solve(HTransform3D<double>(_posInterpolator->x(t1), _rotInterpolator->x(t1)), q0, q1) != robot::ik::ikSuccess)
+			q1 = q0;
+		else if (q0.size() != 0 && depth < maxReferenceDepth)
+		{
+			robot::math::Q delta = q1 - q0;
+			delta.abs();
+			if (delta.getMax() >= M_PI/2)
+			{
+				const double middle = 0.5*(t0 + t1);
+				appendReferences(t0, q0, middle, depth + 1);
+				const robot::math::Q q = _references.back();
+				appendReferences(middle, q, t1, depth + 1);
+				return;
+			}
+		}
+		_referenceTimes.push_back(t1);
+		_references.push_back(q1);
+	}
+
+	/**
+	 * @brief t所在区间的参考关节角
+	 */
+	const robot::math::Q& reference(double t) const
+	{
+		const int index = (int)(std::upper_bound(_referenceTimes.begin(), _referenceTimes.end(), t) - _referenceTimes.begin()) - 1;
+		return _references[std::max(0, index)];
+	}
+
+	/**
+	 * @brief 微分运动学: 由末端速度和加速度求关节速度和加速度
+	 * @param t [in] 时间
+	 * @param q [out] 关节角(逆解一次)
+	 * @param dq [out] 关节速度
+	 * @param ddq [out] 关节加速度, 为NULL时不计算
+	 * @retval true 成功
+	 * @retval false 雅克比矩阵奇异(或者不是6轴)
+	 */
+	bool differentiate(double t, robot::math::Q& q, robot::math::Q& dq, robot::math::Q* ddq) const
+	{
+		q = this->x(t);
+		Derivatives<Vector3D<double> > pos;
+		Derivatives<Rotation3D<double> > rot;
+		pos.dx = _posInterpolator->dx(t);
+		rot.x = _rotInterpolator->x(t);
+		rot.dx = _rotInterpolator->dx(t);
+		if (ddq != NULL)
+		{
+			pos.ddx = _posInterpolator->ddx(t);
+			rot.ddx = _rotInterpolator->ddx(t);
+		}
+		return differentiate(pos, rot, q, dq, ddq);
+	}
+
+	/**
+	 * @brief 微分运动学: 由末端速度和加速度求关节速度和加速度
+	 * @param pos [in] 位置插补器的速度和加速度(不使用pos.x)
+	 * @param rot [in] 姿态插补器的姿态, 速度和加速度
+	 * @param q [in] 关节角
+	 * @param dq [out] 关节速度
+	 * @param ddq [out] 关节加速度, 为NULL时不计算(不使用pos.ddx和rot.ddx)
+	 * @retval true 成功
+	 * @retval false 雅克比矩阵奇异(或者不是6轴)
+	 *
+	 * 末端角速度为@f$ \omega = (\dot{\mathbf{R}}\mathbf{R}^T)^\vee @f$, 角加速度为
+	 * @f$ \alpha = (\ddot{\mathbf{R}}\mathbf{R}^T)^\vee @f$(@f$ \dot{\mathbf{R}}\dot{\mathbf{R}}^T @f$对称, 不影响反对称部分).
+	 */
+	bool differentiate(const Derivatives<Vector3D<double> >& pos, const Derivatives<Rotation3D<double> >& rot,
+			const robot::math::Q& q, robot::math::Q& dq, robot::math::Q* ddq) const
+	{
+		typedef Eigen::Matrix<double, 6, 1> Vector6;
+		if (q.size() != 6)
+			return false;
+		const robot::model::JointTrig trig = _serialLink->getJointTrig(q);
+		robot::model::FixedJacobian<6, 6> J;
+		_serialLink->getJacobian(trig, J);
+		// 速度和加速度使用同一个分解
+		const Eigen::PartialPivLU<Eigen::Matrix<double, 6, 6> > lu(J.matrix());
+		if (fabs(lu.determinant()) < 1e-12)
+			return false;
+		const Rotation3D<double> rotT = rot.x.inverse();
+		Vector3D<double> v = pos.dx;
+		Rotation3D<double> W = rot.dx*rotT;
+		Vector6 end;
+		end << v(0), v(1), v(2), 0.5*(W(2, 1) - W(1, 2)), 0.5*(W(0, 2) - W(2, 0)), 0.5*(W(1, 0) - W(0, 1));
+		dq = robot::math::Q::zero(6);
+		Eigen::Map<Vector6>(dq.data()) = lu.solve(end);
+		if (ddq != NULL)
+		{
+			robot::model::KinematicsResult kinematics;
+			_serialLink->computeKinematics(trig, dq, kinematics);
+			v = pos.ddx;
+			W = rot.ddx*rotT;
+			end << v(0), v(1), v(2), 0.5*(W(2, 1) - W(1, 2)), 0.5*(W(0, 2) - W(2, 0)), 0.5*(W(1, 0) - W(0, 1));
+			*ddq = robot::math::Q::zero(6);
+			Eigen::Map<Vector6>(ddq->data()) = lu.solve(end - kinematics.jacobianDotQd);
+		}
+		return true;
+	}
 protected:
 	/**> 逆解器 */
 	std::shared_ptr<robot::ik::IKSolver> _ikSolver;
 
+	/**> 机器人模型, 用于微分运动学 */
+	robot::model::SerialLink::ptr _serialLink;
+
 	/**> 位置插补器 */
 	Interpolator<Vector3D<double> >::ptr _posInterpolator;
 
@@ -209,6 +530,21 @@ protected:
 
 	/**> 机器人姿态 - 用于逆解取解 */
 	robot::model::Config _config;
+
+	/**> 初始的参考区间个数 */
+	static const int initialReferenceCount = 16;
+
+	/**> 参考区间的最多细分层数 */
+	static const int maxReferenceDepth = 10;
+
+	/**> 参考关节角的时刻, 从0开始递增 */
+	std::vector<double> _referenceTimes;
+
+	/**> 参考关节角, 逆解只计算同一分支中最接近t所在区间的参考关节角的解 */
+	std::vector<robot::math::Q> _references;
+
+	/**> 是否使用微分运动学计算关节速度和加速度 */
+	bool _differential;
 };
 
 using ikInterpolator = ConvertedInterpolator<std::pair<Interpolator<Vector3D<double> >::ptr , Interpolator<Rotation3D<double> >::ptr > , robot::math::Q>;
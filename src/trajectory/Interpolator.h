@@ -14,6 +14,8 @@
 # include "../math/Vector3D.h"
 # include <math.h>
 # include "../common/printAdvance.h"
+# include "../common/ThreadPool.h"
+# include "SampleBuffer.h"
 
 using namespace robot::math;
 using robot::model::SerialLink;
@@ -25,7 +27,7 @@ namespace robot {
 namespace trajectory {
 
 /** @addtogroup trajectory
- * @brief 插补器, 生成平滑的插补函数, 提供x(t), dx(t), ddx(t)和duration()函数接口
+ * @brief 插补器, 生成平滑的插补函数, 提供x(t), dx(t), ddx(t), evaluate(t)和duration()函数接口
  *
  * 包括的类有:
  * 1. Interpolator: 插补器基类
@@ -42,11 +44,44 @@ namespace trajectory {
  * @{
  */
 
+/**
+ * @brief 插补器在t时刻的位置, 速度和加速度, 由Interpolator::evaluate一次求出
+ */
+template <class T>
+struct Derivatives {
+	/** @brief 位置 */
+	T x;
+
+	/** @brief 速度 */
+	T dx;
+
+	/** @brief 加速度 */
+	T ddx;
+};
+
+/**
+ * @brief 按时间顺序插补时的游标
+ *
+ * 记录上一次查询所在的段. 游标由使用者(例如MotionStack)持有, 插补器本身仍然是const的,
+ * 多个使用者可以各自带着游标同时查询同一个插补器. 查询时间递增时从上一段向后查找, 为O(1);
+ * 时间回退或跳过很多段时退回二分查找. 开始新的插补时调用reset.
+ */
+struct PlaybackCursor {
+	PlaybackCursor(): index(0){}
+
+	/** @brief 回到第一段 */
+	void reset(){index = 0;}
+
+	/** @brief 上一次查询所在的段 */
+	int index;
+};
+
 /**
  * @brief 插补器接口
  *
  * 所有插补器一致的基类, 定义了公共的函数借口x(t), dx(t), ddx(t)和duration().
- * 参照具体类的实现
+ * evaluate(t)一次求出三者, 默认分别调用x, dx, ddx; 具体的插补器重载它以共用中间结果
+ * (分段查找, 映射器的值, 三角函数, 逆解等). 参照具体类的实现
  */
 template <class T>
 class Interpolator {
@@ -76,6 +111,29 @@ public:
 	 */
 	virtual T ddx(double t) const = 0;
 
+	/**
+	 * @brief t时刻的位置, 速度和加速度
+	 * @param t [in] 时间t
+	 * @param result [out] 结果, 与分别调用x(t), dx(t), ddx(t)相同
+	 */
+	virtual void evaluate(double t, Derivatives<T>& result) const
+	{
+		result.x = this->x(t);
+		result.dx = this->dx(t);
+		result.ddx = this->ddx(t);
+	}
+
+	/**
+	 * @brief 带游标的evaluate, 用于按时间顺序插补
+	 * @param t [in] 时间t
+	 * @param result [out] 结果, 与evaluate(t, result)相同
+	 * @param cursor [in,out] 使用者持有的游标. 默认忽略游标, 分段的插补器(SequenceInterpolator等)重载它
+	 */
+	virtual void evaluate(double t, Derivatives<T>& result, PlaybackCursor& /*cursor*/) const
+	{
+		this->evaluate(t, result);
+	}
+
 	/**
 	 * @brief 返回末端位置
 	 * @return 末端位置
@@ -134,6 +192,29 @@ public:
 	 */
 	virtual Q ddx(double t) const = 0;
 
+	/**
+	 * @brief t时刻的位置, 速度和加速度
+	 * @param t [in] 时间t
+	 * @param result [out] 结果, 与分别调用x(t), dx(t), ddx(t)相同
+	 */
+	virtual void evaluate(double t, Derivatives<Q>& result) const
+	{
+		result.x = this->x(t);
+		result.dx = this->dx(t);
+		result.ddx = this->ddx(t);
+	}
+
+	/**
+	 * @brief 带游标的evaluate, 用于按时间顺序插补
+	 * @param t [in] 时间t
+	 * @param result [out] 结果, 与evaluate(t, result)相同
+	 * @param cursor [in,out] 使用者持有的游标. 默认忽略游标, 分段的插补器(SequenceInterpolator等)重载它
+	 */
+	virtual void evaluate(double t, Derivatives<Q>& result, PlaybackCursor& /*cursor*/) const
+	{
+		this->evaluate(t, result);
+	}
+
 	/**
 	 * @brief 返回末端位置
 	 * @return 末端位置
@@ -161,48 +242,73 @@ public:
 	/**
 	 * @brief 获得State
 	 * @param t [in] 时间
-	 * @param precision [in] 采样精度
+	 * @param precision [in] 采样精度, 只用于需要数值求导的插补器(ikInterpolator)
 	 * @return state
 	 *
-	 * 采用数值方法求速度和加速度, 可以指定采样的精度. 由于速度需要求解两次x(t), 加速度
-	 * 需要求解三次x(t), 如果用数值方法分开求解这三个数据将需要6次求x(t). 用这个方法只
-	 * 需要求解3次x(t), 计算上更为节省.
+	 * 由evaluate一次求出位置, 速度和加速度(解析的导数, 与dx(t), ddx(t)相同).
 	 */
 	virtual State getState(double t, double precision=0.00001) const
 	{
-		Q x0 = this->x(t);
-		Q x1 = this->x(t + precision);
-		Q x2 = this->x(t + precision*2);
-		Q dx = (x1 - x0)/precision;
-		Q ddx = (x0 + x2 - x1*2.0)/(precision*precision);
-		return State(x0, dx, ddx);
+		Derivatives<Q> result;
+		this->evaluate(t, result);
+		return State(result.x, result.dx, result.ddx);
 	}
 
 	/**
-	 * @brief 获取关节上下限
-	 * @param step [in] 采样数量
-	 * @return 返回关节上下限制[min, maax]
+	 * @brief 带游标获得State, 用于按时间顺序插补(MotionStack)
+	 * @param t [in] 时间
+	 * @param cursor [in,out] 使用者持有的游标
+	 * @return state, 与getState(t)相同
 	 */
-	virtual std::pair<Q, Q> getLimQ(int step)
+	virtual State getState(double t, PlaybackCursor& cursor) const
 	{
-		double T = this->duration();
-		double dt = T/(step - 1);
-		int size = (this->x(0)).size();
-		Q minQ = this->x(0);
-		Q maxQ = minQ;
-		Q xresult;
-		for (double t=0; t<=T; t+=dt)
+		Derivatives<Q> result;
+		this->evaluate(t, result, cursor);
+		return State(result.x, result.dx, result.ddx);
+	}
+
+	/**
+	 * @brief 在给定的时刻上批量采样
+	 * @param times [in] 采样的时刻
+	 * @param buffer [out] 结果, 按buffer构造时指定的量采样. 只有一个量时调用x, dx或ddx;
+	 * 多个量时调用getState(与插补时得到的State相同)
+	 * @param policy [in] 执行策略. 默认在调用线程中按时间顺序采样; 并行只能用于可以在多个线程中
+	 * 同时求值的插补器(由ikInterpolator组成时还要求逆解器可以同时使用, 见BakedTrajectory)
+	 */
+	void sampleInto(const std::vector<double>& times, SampleBuffer& buffer,
+			const robot::common::ExecPolicy& policy=robot::common::ExecPolicy(robot::common::ExecPolicy::sequential)) const
+	{
+		const int count = (int)times.size();
+		if (count == 0)
 		{
-			xresult = this->dx(t);
-			for (int i=0; i<size; i++)
+			buffer.resize(0, 0);
+			return;
+		}
+		Derivatives<Q> first;
+		sampleAt(times[0], buffer.fields(), first);
+		const int fields = buffer.fields();
+		buffer.resize(((fields & SampleBuffer::position)? first.x : (fields & SampleBuffer::velocity)? first.dx : first.ddx).size(), count);
+		buffer.set(0, first.x, first.dx, first.ddx);
+		policy.run(count - 1, [&](int begin, int end){
+			Derivatives<Q> result;
+			for (int i=begin + 1; i<end + 1; i++)
 			{
-				if (xresult[i] > maxQ[i])
-					maxQ(i) = xresult[i];
-				else if (xresult[i] < minQ[i])
-					minQ(i) = xresult[i];
+				sampleAt(times[i], fields, result);
+				buffer.set(i, result.x, result.dx, result.ddx);
 			}
-		}
-		return std::pair<Q, Q>(minQ, maxQ);
+		});
+	}
+
+	/**
+	 * @brief 获取关节上下限
+	 * @param step [in] 采样数量
+	 * @return 返回各关节在采样点上的关节角范围[min, max]
+	 */
+	virtual std::pair<Q, Q> getLimQ(int step)
+	{
+		SampleBuffer buffer(SampleBuffer::position);
+		sampleInto(SampleBuffer::timeGrid(this->duration(), step), buffer);
+		return std::pair<Q, Q>(buffer.getMin(SampleBuffer::position), buffer.getMax(SampleBuffer::position));
 	}
 
 	/**
@@ -212,21 +318,9 @@ public:
 	 */
 	virtual Q getMaxdQ(int step)
 	{
-		double T = this->duration();
-		double dt = T/(step - 1);
-		int size = (this->dx(0)).size();
-		Q dqMax = Q::zero(size);
-		Q dxresult;
-		for (double t=0; t<=T; t+=dt)
-		{
-			dxresult = this->dx(t);
-			for (int i=0; i<size; i++)
-			{
-				if (dqMax(i) < fabs(dxresult[i]))
-					dqMax(i) = fabs(dxresult[i]);
-			}
-		}
-		return dqMax;
+		SampleBuffer buffer(SampleBuffer::velocity);
+		sampleInto(SampleBuffer::timeGrid(this->duration(), step), buffer);
+		return buffer.getMaxAbs(SampleBuffer::velocity);
 	}
 
 	/**
@@ -236,66 +330,45 @@ public:
 	 */
 	virtual Q getMaxddQ(int step) const
 	{
-		double T = this->duration();
-		double dt = T/(step - 1);
-		int size = (this->ddx(0)).size();
-		Q ddqMax = Q::zero(size);
-		Q ddxresult;
-		for (double t=0; t<=T; t+=dt)
-		{
-			ddxresult = this->ddx(t);
-			for (int i=0; i<size; i++)
-			{
-				if (ddqMax(i) < fabs(ddxresult[i]))
-					ddqMax(i) = fabs(ddxresult[i]);
-			}
-		}
-		return ddqMax;
+		SampleBuffer buffer(SampleBuffer::acceleration);
+		sampleInto(SampleBuffer::timeGrid(this->duration(), step), buffer);
+		return buffer.getMaxAbs(SampleBuffer::acceleration);
 	}
 
 	/**
 	 * @brief 对x(t)函数进行采样
 	 * @param step [in] 采样数量
-	 * @return 在0~duration()之间采样的step个位置点
+	 * @return 在0~duration()之间等间距采样的step个位置点
 	 */
 	virtual std::vector<Q> xSample(int step)
 	{
-		std::vector<Q> q;
-		double T = this->duration();
-		double dt = T/double(step - 1);
-		for (double t=0; t<=T; t+=dt)
-			q.push_back(this->x(t));
-		return q;
+		SampleBuffer buffer(SampleBuffer::position);
+		sampleInto(SampleBuffer::timeGrid(this->duration(), step), buffer);
+		return buffer.toVector(SampleBuffer::position);
 	}
 
 	/**
 	 * @brief 对dx(t)函数进行采样
 	 * @param step [in] 采样数量
-	 * @return 在0~duration()之间采样的step个速度点
+	 * @return 在0~duration()之间等间距采样的step个速度点
 	 */
 	virtual std::vector<Q> dxSample(int step)
 	{
-		std::vector<Q> q;
-		double T = this->duration();
-		double dt = T/double(step - 1);
-		for (double t=0; t<=T; t+=dt)
-			q.push_back(this->dx(t));
-		return q;
+		SampleBuffer buffer(SampleBuffer::velocity);
+		sampleInto(SampleBuffer::timeGrid(this->duration(), step), buffer);
+		return buffer.toVector(SampleBuffer::velocity);
 	}
 
 	/**
 	 * @brief 对ddx(t)函数进行采样
 	 * @param step [in] 采样数量
-	 * @return 在0~duration()之间采样的step个加速度点
+	 * @return 在0~duration()之间等间距采样的step个加速度点
 	 */
 	virtual std::vector<Q> ddxSample(int step)
 	{
-		std::vector<Q> q;
-		double T = this->duration();
-		double dt = T/double(step - 1);
-		for (double t=0; t<=T; t+=dt)
-			q.push_back(this->ddx(t));
-		return q;
+		SampleBuffer buffer(SampleBuffer::acceleration);
+		sampleInto(SampleBuffer::timeGrid(this->duration(), step), buffer);
+		return buffer.toVector(SampleBuffer::acceleration);
 	}
 
 	/**
@@ -315,15 +388,20 @@ public:
 		int step = 1000; //采样次数
 		double T = this->duration();
 		double dt = T/(step - 1);
-		Vector3D<double> position1;
-		Vector3D<double> position2 = serialink->getEndPosition(this->x(0));
-		_trajectoryLength.push_back(std::pair<double, double>(0, 0));
-		int i = 0;
+		std::vector<double> time(1, 0);
+		std::vector<Q> q(1, this->x(0));
 		for (double t = dt; t<= T; t+=dt)
 		{
-			position1 = position2;
-			position2 = serialink->getEndPosition(this->x(t));
-			_trajectoryLength.push_back(std::pair<double, double>(t, _trajectoryLength[i++].second + (position2 - position1).getLength()));
+			time.push_back(t);
+			q.push_back(this->x(t));
+		}
+		std::vector<HTransform3D<double> > tran;
+		serialink->getEndTransforms(q, tran); // 批量正运动学
+		_trajectoryLength.push_back(std::pair<double, double>(0, 0));
+		for (int i=1; i<(int)tran.size(); i++)
+		{
+			_trajectoryLength.push_back(std::pair<double, double>(time[i],
+					_trajectoryLength[i - 1].second + (tran[i].getPosition() - tran[i - 1].getPosition()).getLength()));
 		}
 	}
 
@@ -369,6 +447,29 @@ public:
 		return t;
 	}
 private:
+	/**
+	 * @brief 采样一个时刻
+	 * @param t [in] 时刻
+	 * @param fields [in] 采样的量(SampleBuffer::Field的组合)
+	 * @param result [out] 结果, 没有采样的量不改变
+	 */
+	void sampleAt(double t, int fields, Derivatives<Q>& result) const
+	{
+		if (fields == SampleBuffer::position)
+			result.x = this->x(t);
+		else if (fields == SampleBuffer::velocity)
+			result.dx = this->dx(t);
+		else if (fields == SampleBuffer::acceleration)
+			result.ddx = this->ddx(t);
+		else
+		{
+			State state = this->getState(t);
+			result.x = state.getAngle();
+			result.dx = state.getVelocity();
+			result.ddx = state.getAcceleration();
+		}
+	}
+
 	/**
 	 * @brief 路径长度采样
 	 *
@@ -408,6 +509,13 @@ public:
 		return _zero;
 	}
 
+	void evaluate(double t, Derivatives<T>& result) const
+	{
+		result.x = _constant;
+		result.dx = _zero;
+		result.ddx = _zero;
+	}
+
 	double duration() const
 	{
 		return _duration;
@@ -25,10 +25,11 @@ namespace trajectory {
 LineTrajectory::LineTrajectory(std::pair<Interpolator<Vector3D<double> >::ptr , Interpolator<Rotation3D<double> >::ptr >  origin,
 		std::shared_ptr<robot::ik::IKSolver> iksolver,
 		robot::model::Config config,
-		SequenceInterpolator<double>::ptr lt,
+		Interpolator<double>::ptr lt,
 		Trajectory::ptr trajectory)
 :_qIpr(new ikInterpolator(origin, iksolver, config)), _trajectory(trajectory), _lt(lt), _pathSize(trajectory->duration()/0.01 + 1)
 {
+	_qIpr->setDifferential(trajectory->isDifferential());
 	_lengthPath.reserve(_pathSize);
 }
 
@@ -47,6 +48,26 @@ Q LineTrajectory::ddx(double t) const
 	return _qIpr->ddx(t);
 }
 
+void LineTrajectory::evaluate(double t, Derivatives<Q>& result) const
+{
+	_qIpr->evaluate(t, result);
+}
+
+State LineTrajectory::getState(double t, double precision) const
+{
+	return _qIpr->getState(t, precision);
+}
+
+void LineTrajectory::evaluate(double t, Derivatives<Q>& result, PlaybackCursor& cursor) const
+{
+	_qIpr->evaluate(t, result, cursor);
+}
+
+State LineTrajectory::getState(double t, PlaybackCursor& cursor) const
+{
+	return _qIpr->getState(t, cursor);
+}
+
 double LineTrajectory::l(double t) const
 {
 	return _lt->x(t);
@@ -15,6 +15,7 @@
 # include "../math/HTransform3D.h"
 # include "../math/Quaternion.h"
 # include "../math/Q.h"
+# include "../math/DualQuaternion.h"
 # include <memory>
 # include "../ik/IKSolver.h"
 
@@ -36,7 +37,8 @@ namespace trajectory {
  * 线性插补器的值由 \f$\mathbf{x}(t)=\mathbf{s} +
  * (\mathbf{e}-\mathbf{s})*t/d\f$给出. <br>
  *
- * 旋转矩阵的差值用到四元数的概念, 具体实现参照LinearInterpolator<Rotation3D<T> >的内容
+ * 旋转矩阵的差值用到四元数的概念, 具体实现参照LinearInterpolator<Rotation3D<T> >的内容. <br>
+ * 位姿(位移和旋转)一起插补时可以使用LinearInterpolator<DualQuaternion>
  */
 template <class T>
 class LinearInterpolator: public Interpolator<T> {
@@ -81,6 +83,13 @@ public:
 		return _acc;
 	}
 
+	void evaluate(double t, Derivatives<T>& result) const
+	{
+		result.x = _a + _b*t;
+		result.dx = _vel;
+		result.ddx = _acc;
+	}
+
 	double duration() const
 	{
 		return _duration;
@@ -146,7 +155,7 @@ public:
 		return (Rotation3D<T>(
 				-s*(n22 + n32), s*n1n2 + c*n3, s*n1n3 - c*n2,
 				s*n1n2 - c*n3, -s*(n12 + n32), s*n2n3 + c*n1,
-				s*n1n3 + c*n2, s*n2n3 - c*n1, -s*(n12 + n22)))*_vel;
+				s*n1n3 + c*n2, s*n2n3 - c*n1, -s*(n12 + n22))*_start)*_vel;
 	}
 
 	Rotation3D<T> ddx(double t) const
@@ -166,7 +175,35 @@ public:
 		return (Rotation3D<T>(
 				-c*(n22 + n32), c*n1n2 - s*n3, c*n1n3 + s*n2,
 				c*n1n2 + s*n3, -c*(n12 + n32), c*n2n3 - s*n1,
-				c*n1n3 - s*n2, c*n2n3 + s*n1, -c*(n12 + n22)))*_acc;
+				c*n1n3 - s*n2, c*n2n3 + s*n1, -c*(n12 + n22))*_start)*_acc;
+	}
+
+	/**
+	 * @brief 位置, 速度和加速度, 三角函数只计算一次
+	 */
+	void evaluate(double t, Derivatives<Rotation3D<T> >& result) const
+	{
+		result.x = (_quartStart*Quaternion((t*_vel), _n)).toRotation3D();
+		double theta = t*_theta/_duration;
+		double s = sin(theta);
+		double c = cos(theta);
+		double n1 = _n(0);
+		double n2 = _n(1);
+		double n3 = _n(2);
+		double n12 = n1*n1;
+		double n22 = n2*n2;
+		double n32 = n3*n3;
+		double n1n2 = n1*n2;
+		double n1n3 = n1*n3;
+		double n2n3 = n2*n3;
+		result.dx = (Rotation3D<T>(
+				-s*(n22 + n32), s*n1n2 + c*n3, s*n1n3 - c*n2,
+				s*n1n2 - c*n3, -s*(n12 + n32), s*n2n3 + c*n1,
+				s*n1n3 + c*n2, s*n2n3 - c*n1, -s*(n12 + n22))*_start)*_vel;
+		result.ddx = (Rotation3D<T>(
+				-c*(n22 + n32), c*n1n2 - s*n3, c*n1n3 + s*n2,
+				c*n1n2 + s*n3, -c*(n12 + n32), c*n2n3 - s*n1,
+				c*n1n3 - s*n2, c*n2n3 + s*n1, -c*(n12 + n22))*_start)*_acc;
 	}
 
 	double duration() const
@@ -185,6 +222,81 @@ private:
 	double _acc;
 };
 
+/**
+ * @brief 位姿的螺旋线性插值(ScLERP)
+ *
+ * 用一个插补器代替位移的LinearInterpolator<Vector3D<double> >和姿态的
+ * LinearInterpolator<Rotation3D<double> >. 令@f$ \delta = \sigma_s^*\sigma_e @f$,
+ * @f$ \xi = \log\delta @f$, 则 @f$ \sigma(t) = \sigma_s\delta^{t/d} @f$,
+ * @f$ \dot\sigma = \sigma(t)\xi/d @f$, @f$ \ddot\sigma = \sigma(t)\xi^2/d^2 @f$.
+ * 末端沿螺旋线运动, 当两个位姿之间没有转动时就是直线.
+ */
+template <>
+class LinearInterpolator<DualQuaternion>: public Interpolator<DualQuaternion>{
+public:
+	typedef std::shared_ptr<LinearInterpolator> ptr;
+	/**
+	 * @brief 构造函数
+	 * @param start [in] 开始位姿
+	 * @param end [in] 结束位姿
+	 * @param duration [in] 插补时长
+	 */
+	LinearInterpolator(const DualQuaternion& start,
+			const DualQuaternion& end,
+			double duration):
+				_start(start),
+				_duration(duration)
+	{
+		_delta = _start.conjugate()*end;
+		if (_delta.real(0) < 0)
+			_delta = -_delta;
+		_xi = _delta.log();
+		if (duration != 0)
+			_xi = _xi*(1.0/duration);
+	}
+
+	virtual ~LinearInterpolator(){}
+
+	DualQuaternion x(double t) const
+	{
+		if (_duration == 0)
+			return _start;
+		DualQuaternion result = _start*_delta.pow(t/_duration);
+		result.normalize();
+		return result;
+	}
+
+	DualQuaternion dx(double t) const
+	{
+		return x(t)*_xi;
+	}
+
+	DualQuaternion ddx(double t) const
+	{
+		return x(t)*_xi*_xi;
+	}
+
+	/**
+	 * @brief 位置, 速度和加速度, 只计算一次@f$ \delta^{t/d} @f$
+	 */
+	void evaluate(double t, Derivatives<DualQuaternion>& result) const
+	{
+		result.x = x(t);
+		result.dx = result.x*_xi;
+		result.ddx = result.x*_xi*_xi;
+	}
+
+	double duration() const
+	{
+		return _duration;
+	}
+private:
+	const DualQuaternion _start;
+	const double _duration;
+	DualQuaternion _delta;
+	DualQuaternion _xi;
+};
+
 /** @} */
 } /* namespace trajectory */
 } /* namespace robot */
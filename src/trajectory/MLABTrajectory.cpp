@@ -6,6 +6,7 @@
  */
 
 #include "MLABTrajectory.h"
+# include <algorithm>
 
 namespace robot {
 namespace trajectory {
@@ -21,6 +22,11 @@ MLABTrajectory::MLABTrajectory(
 		_vtrajectory(vtrajectory), _vlt(vlt), _vqIpr(vqIpr), _trajectory(trajectory), _lt(lt), _qIpr(qIpr)
 {
 	_size = (int)(vlt.size());
+	for (int i=0; i<_size; i++)
+	{
+		_timeSequence.push_back(_vlt[i]->duration() + (i == 0? 0 : _timeSequence[i - 1]));
+		_lengthSequence.push_back(_vtrajectory[i]->duration() + (i == 0? 0 : _lengthSequence[i - 1]));
+	}
 }
 
 Q MLABTrajectory::x(double t) const
@@ -38,6 +44,16 @@ Q MLABTrajectory::ddx(double t) const
 	return _qIpr->ddx(t);
 }
 
+void MLABTrajectory::evaluate(double t, Derivatives<Q>& result) const
+{
+	_qIpr->evaluate(t, result);
+}
+
+void MLABTrajectory::evaluate(double t, Derivatives<Q>& result, PlaybackCursor& cursor) const
+{
+	_qIpr->evaluate(t, result, cursor);
+}
+
 double MLABTrajectory::duration() const
 {
 	return _qIpr->duration();
@@ -81,32 +97,14 @@ vector<double> MLABTrajectory::getLengthVector() const
 
 int MLABTrajectory::getIndexFromTime(double t) const
 {
-	vector<double> vt = getTimeVector();
-	for (int i=0; i<_size; i++)
-	{
-		if (t >= vt[i])
-		{
-			t -= vt[i];
-		}
-		else
-			return i;
-	}
-	return _size - 1;
+	int index = std::upper_bound(_timeSequence.begin(), _timeSequence.end(), t) - _timeSequence.begin();
+	return (index < _size)? index : (_size - 1);
 }
 
 int MLABTrajectory::getIndexFromLength(double l) const
 {
-	vector<double> vl = getLengthVector();
-	for (int i=0; i<_size; i++)
-	{
-		if (l >= vl[i])
-		{
-			l -= vl[i];
-		}
-		else
-			return i;
-	}
-	return _size - 1;
+	int index = std::upper_bound(_lengthSequence.begin(), _lengthSequence.end(), l) - _lengthSequence.begin();
+	return (index < _size)? index : (_size - 1);
 }
 
 } /* namespace trajectory */
@@ -59,6 +59,16 @@ public:
 
 	Q ddx(double t) const;
 
+	/**
+	 * @brief 关节角, 速度和加速度, 只查找一次所在的段
+	 */
+	void evaluate(double t, Derivatives<Q>& result) const;
+
+	/**
+	 * @brief 带游标的evaluate, 按时间顺序插补时查找所在的段为O(1)
+	 */
+	void evaluate(double t, Derivatives<Q>& result, PlaybackCursor& cursor) const;
+
 	double duration() const;
 
 	/**
@@ -98,6 +108,8 @@ public:
 	 * @brief 获取索引
 	 * @param t [in] 时间
 	 * @return 时间t时指向的那一段路径(例如直线为第0段, 圆弧第1段...)
+	 *
+	 * 在各段结束时刻的前缀和中二分查找, O(log n).
 	 */
 	int getIndexFromTime(double t) const;
 
@@ -105,6 +117,8 @@ public:
 	 * @brief 获取索引
 	 * @param l [in] 长度
 	 * @return 路径长度l指向的那一段路径(例如直线为第0段, 圆弧第1段...)
+	 *
+	 * 在各段结束长度的前缀和中二分查找, O(log n).
 	 */
 	int getIndexFromLength(double l) const;
 
@@ -133,6 +147,12 @@ private:
 	/**> 统一的q插补器 */
 	Interpolator<Q>::ptr _qIpr;
 
+	/**> 各段的结束时刻(时长的前缀和) */
+	vector<double> _timeSequence;
+
+	/**> 各段的结束长度(长度的前缀和) */
+	vector<double> _lengthSequence;
+
 };
 
 /** @} */
@@ -0,0 +1,15 @@
+/*
+ * PiecewisePolynomial.cpp
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: a1994846931931
+ */
+
+#include "PiecewisePolynomial.h"
+
+namespace robot {
+namespace trajectory {
+
+
+} /* namespace trajectory */
+} /* namespace robot */
@@ -0,0 +1,333 @@
+/**
+ * @brief PiecewisePolynomial类
+ * @date Oct 16, 2026
+ * @author a1994846931931
+ */
+
+#ifndef PIECEWISEPOLYNOMIAL_H_
+#define PIECEWISEPOLYNOMIAL_H_
+
+# include "Interpolator.h"
+# include "PolynomialInterpolator.h"
+# include "SequenceInterpolator.h"
+# include "ConvertedInterpolator.h"
+# include "../ext/Eigen/Dense"
+# include <vector>
+# include <algorithm>
+# include <memory>
+# include <math.h>
+
+namespace robot {
+namespace trajectory {
+
+/** @addtogroup trajectory
+ * @{
+ */
+
+/**
+ * @brief 分段多项式插补器
+ *
+ * 第i段为@f$ \sum_{k=0}^{Degree} c_{ik}(t - t_i)^k @f$, @f$ t_i \le t < t_{i+1} @f$.
+ * 分段点和系数分别保存在连续的数组中(每段Degree + 1个系数), 查找一次分段后用Horner法求值,
+ * 不需要虚函数调用和指针跳转. 分段的规则与SequenceInterpolator相同: t正好在分段点上时取后一段,
+ * 超出范围时用第一段或最后一段外推.
+ *
+ * x, dx, ddx和evaluate每次二分查找. 按时间顺序查询时(插补周期, 采样)使用带PlaybackCursor的evaluate,
+ * 只检查游标所在的段和下一段, 为O(1). 游标由使用者持有, 对象本身不会改变, 可以在多个线程中同时使用.
+ *
+ * fromSequence把SMPlannerEx, SmoothMotionPlanner, TimeOptimalPlanner等得到的SequenceInterpolator
+ * (可以嵌套)展开成一个分段多项式:
+ * - PolynomialInterpolator1~5直接复制系数(次数不能超过Degree);
+ * - 其它插补器(例如appendInterpolator生成的ConvertedInterpolator)按其内部的分段,
+ *   在每段的Degree + 1个Chebyshev点上采样拟合. 源插补器在该段上是不超过Degree次的多项式时拟合是精确的(只有舍入误差).
+ *
+ * @code
+ * PiecewisePolynomial<double, 3>::ptr lt = PiecewisePolynomial<double, 3>::fromSequence(
+ * 		TimeOptimalPlanner::getOptimalLt(maxSpeed, length, v, a, h, ds));
+ * PlaybackCursor cursor;
+ * Derivatives<double> l;
+ * for (double t=0; t<lt->duration(); t+=0.001)
+ * 	lt->evaluate(t, l, cursor);
+ * @endcode
+ */
+template <class T, int Degree>
+class PiecewisePolynomial: public Interpolator<T> {
+	static_assert(Degree >= 1 && Degree <= 5, "PiecewisePolynomial: Degree必须为1~5");
+public:
+	using ptr = std::shared_ptr<PiecewisePolynomial>;
+
+	/** @brief 空的分段多项式, 用addSegment添加分段 */
+	PiecewisePolynomial(): _breaks(1, 0.0){}
+
+	/**
+	 * @brief 在末尾添加一段
+	 * @param coefficients [in] Degree + 1个系数, 从常数项开始, 以该段的开始时刻为0
+	 * @param duration [in] 时长, 不能为负数
+	 */
+	void addSegment(const T* coefficients, double duration)
+	{
+		if (duration < 0)
+			throw("错误<PiecewisePolynomial>: 时长不能为负数!");
+		_coefficients.insert(_coefficients.end(), coefficients, coefficients + Degree + 1);
+		_breaks.push_back(duration + _breaks.back());
+	}
+
+	/**
+	 * @brief 展开插补器
+	 * @param source [in] 源插补器, 通常为SequenceInterpolator
+	 * @return 分段多项式, 与源插补器的时长和分段相同
+	 */
+	static ptr fromSequence(const std::shared_ptr<Interpolator<T> >& source)
+	{
+		ptr result(new PiecewisePolynomial());
+		result->append(source);
+		return result;
+	}
+
+	T x(double t) const
+	{
+		double local;
+		const T* c = &_coefficients[search(t, local)*(Degree + 1)];
+		T x = c[Degree];
+		for (int k=Degree - 1; k>=0; k--)
+			x = x*local + c[k];
+		return x;
+	}
+
+	T dx(double t) const
+	{
+		double local;
+		const T* c = &_coefficients[search(t, local)*(Degree + 1)];
+		T dx = c[Degree]*(double)Degree;
+		for (int k=Degree - 1; k>=1; k--)
+			dx = dx*local + c[k]*(double)k;
+		return dx;
+	}
+
+	T ddx(double t) const
+	{
+		double local;
+		const T* c = &_coefficients[search(t, local)*(Degree + 1)];
+		T ddx = c[Degree]*(double)(Degree*(Degree - 1));
+		for (int k=Degree - 1; k>=2; k--)
+			ddx = ddx*local + c[k]*(double)(k*(k - 1));
+		return ddx;
+	}
+
+	void evaluate(double t, Derivatives<T>& result) const
+	{
+		double local;
+		const int index = search(t, local);
+		horner(index, local, result);
+	}
+
+	/**
+	 * @brief 带游标的evaluate, 从游标所在的段开始查找
+	 */
+	void evaluate(double t, Derivatives<T>& result, PlaybackCursor& cursor) const
+	{
+		double local;
+		const int index = locate(t, local, cursor);
+		horner(index, local, result);
+	}
+
+	double duration() const
+	{
+		return _breaks.back();
+	}
+
+	/** @brief 分段的个数 */
+	int size() const
+	{
+		return (int)_breaks.size() - 1;
+	}
+
+	/** @brief 第index段的开始时刻, index = size()时为总时长 */
+	double breakpoint(int index) const
+	{
+		return _breaks[index];
+	}
+
+	/** @brief 第index段的Degree + 1个系数 */
+	const T* coefficients(int index) const
+	{
+		return &_coefficients[index*(Degree + 1)];
+	}
+
+	virtual ~PiecewisePolynomial(){}
+private:
+	/**
+	 * @brief 二分查找t所在的段
+	 * @param t [in] 时间
+	 * @param local [out] 在该段中的时间
+	 * @return 段的序号
+	 */
+	int search(double t, double& local) const
+	{
+		const int n = size();
+		if (n <= 0)
+			throw("错误<PiecewisePolynomial>: 没有分段!");
+		int index = std::upper_bound(_breaks.begin() + 1, _breaks.end(), t) - _breaks.begin() - 1;
+		if (index >= n)
+			index = n - 1;
+		local = (index == 0)? t : (t - _breaks[index]);
+		return index;
+	}
+
+	/**
+	 * @brief 从游标所在的段开始查找t所在的段
+	 * @param t [in] 时间
+	 * @param local [out] 在该段中的时间
+	 * @param cursor [in,out] 游标, 更新为找到的段
+	 * @return 段的序号, 与二分查找相同
+	 */
+	int locate(double t, double& local, PlaybackCursor& cursor) const
+	{
+		const int n = size();
+		int index = cursor.index;
+		if (index >= 0 && index < n && contains(index, t))
+			local = (index == 0)? t : (t - _breaks[index]);
+		else if (index >= 0 && index + 1 < n && contains(index + 1, t))
+			local = t - _breaks[++index];
+		else
+			index = search(t, local);
+		cursor.index = index;
+		return index;
+	}
+
+	/** @brief 第index段在local处的值, 速度和加速度(Horner法) */
+	void horner(int index, double local, Derivatives<T>& result) const
+	{
+		const T* c = &_coefficients[index*(Degree + 1)];
+		result.x = c[Degree];
+		result.dx = c[Degree]*(double)Degree;
+		result.ddx = c[Degree]*(double)(Degree*(Degree - 1));
+		for (int k=Degree - 1; k>=0; k--)
+		{
+			result.x = result.x*local + c[k];
+			if (k >= 1)
+				result.dx = result.dx*local + c[k]*(double)k;
+			if (k >= 2)
+				result.ddx = result.ddx*local + c[k]*(double)(k*(k - 1));
+		}
+	}
+
+	/** @brief t是否在第index段中(第一段和最后一段包括外推的部分) */
+	bool contains(int index, double t) const
+	{
+		return (index == 0 || t >= _breaks[index]) && (index == size() - 1 || t < _breaks[index + 1]);
+	}
+
+	/** @brief 展开插补器并添加到末尾 */
+	void append(const std::shared_ptr<Interpolator<T> >& source)
+	{
+		auto sequence = std::dynamic_pointer_cast<SequenceInterpolator<T> >(source);
+		if (sequence)
+		{
+			for (int i=0; i<sequence->size(); i++)
+				append(sequence->getInterpolator(i));
+			return;
+		}
+		std::vector<T> coefficients;
+		if (polynomialCoefficients(source, coefficients))
+		{
+			if ((int)coefficients.size() > Degree + 1)
+				throw("错误<PiecewisePolynomial>: 多项式插补器的次数超过Degree!");
+			while ((int)coefficients.size() < Degree + 1)
+				coefficients.push_back(coefficients[0]*0);
+			addSegment(coefficients.data(), source->duration());
+			return;
+		}
+		/**> 按源插补器内部的分段拟合 */
+		std::vector<double> pieces(1, 0.0);
+		splitOf(source, pieces);
+		for (int i=1; i<(int)pieces.size(); i++)
+			fit(source, pieces[i - 1], pieces[i]);
+	}
+
+	/** @brief PolynomialInterpolator1~5的系数 */
+	static bool polynomialCoefficients(const std::shared_ptr<Interpolator<T> >& source, std::vector<T>& coefficients)
+	{
+		if (auto p = std::dynamic_pointer_cast<PolynomialInterpolator1<T> >(source))
+			coefficients = p->getCoefficients();
+		else if (auto p = std::dynamic_pointer_cast<PolynomialInterpolator2<T> >(source))
+			coefficients = p->getCoefficients();
+		else if (auto p = std::dynamic_pointer_cast<PolynomialInterpolator3<T> >(source))
+			coefficients = p->getCoefficients();
+		else if (auto p = std::dynamic_pointer_cast<PolynomialInterpolator4<T> >(source))
+			coefficients = p->getCoefficients();
+		else if (auto p = std::dynamic_pointer_cast<PolynomialInterpolator5<T> >(source))
+			coefficients = p->getCoefficients();
+		else
+			return false;
+		return true;
+	}
+
+	/**
+	 * @brief 插补器内部的分段点(相对于插补器的开始时刻)
+	 * @param source [in] 插补器
+	 * @param pieces [in,out] 在末尾添加各分段的结束时刻
+	 */
+	static void splitOf(const std::shared_ptr<Interpolator<T> >& source, std::vector<double>& pieces)
+	{
+		auto sequence = std::dynamic_pointer_cast<SequenceInterpolator<T> >(source);
+		auto converted = std::dynamic_pointer_cast<ConvertedInterpolator<T, T> >(source);
+		if (sequence)
+		{
+			for (int i=0; i<sequence->size(); i++)
+			{
+				const double offset = pieces.back();
+				const int first = (int)pieces.size();
+				splitOf(sequence->getInterpolator(i), pieces);
+				for (int k=first; k<(int)pieces.size(); k++)
+					pieces[k] += offset;
+			}
+		}
+		else if (converted)
+			splitOf(converted->getOrigin(), pieces);
+		else if (source->duration() > 0)
+			pieces.push_back(pieces.back() + source->duration());
+	}
+
+	/**
+	 * @brief 在[begin, end]的Degree + 1个Chebyshev点上采样, 拟合成一段
+	 */
+	void fit(const std::shared_ptr<Interpolator<T> >& source, double begin, double end)
+	{
+		typedef Eigen::Matrix<double, Degree + 1, Degree + 1> Matrix;
+		const double d = end - begin;
+		if (d <= 0)
+			return;
+		Matrix vandermonde;
+		std::vector<T> values;
+		for (int i=0; i<=Degree; i++)
+		{
+			const double u = (1 - cos((2*i + 1)*M_PI/(2*(Degree + 1))))/2;
+			for (int k=0; k<=Degree; k++)
+				vandermonde(i, k) = pow(u, k);
+			values.push_back(source->x(begin + u*d));
+		}
+		const Matrix inverse = vandermonde.inverse();
+		std::vector<T> coefficients;
+		for (int k=0; k<=Degree; k++)
+		{
+			T c = values[0]*inverse(k, 0);
+			for (int i=1; i<=Degree; i++)
+				c = c + values[i]*inverse(k, i);
+			coefficients.push_back(c*(1.0/pow(d, k)));
+		}
+		addSegment(coefficients.data(), d);
+	}
+private:
+	/** @brief 分段点, 第一个为0, 最后一个为总时长 */
+	std::vector<double> _breaks;
+
+	/** @brief 系数, 每段Degree + 1个 */
+	std::vector<T> _coefficients;
+};
+
+/** @} */
+} /* namespace trajectory */
+} /* namespace robot */
+
+#endif /* PIECEWISEPOLYNOMIAL_H_ */
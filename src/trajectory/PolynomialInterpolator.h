@@ -57,11 +57,23 @@ public:
 	{
 		return _acc;
 	}
+	void evaluate(double t, Derivatives<T>& result) const
+	{
+		result.x = _a+_b*t;
+		result.dx = _vel;
+		result.ddx = _acc;
+	}
 
 	double duration() const
 	{
 		return _duration;
 	}
+
+	/** @brief 系数, 从常数项开始 */
+	std::vector<T> getCoefficients() const
+	{
+		return std::vector<T>{_a, _b};
+	}
 private:
 	T _a;
 	T _b;
@@ -105,12 +117,24 @@ public:
 	{
 		return 2*_c;
 	}
+	void evaluate(double t, Derivatives<T>& result) const
+	{
+		result.x = _a+(_b+_c*t)*t;
+		result.dx = _b+2*_c*t;
+		result.ddx = 2*_c;
+	}
 
 	double duration() const
 	{
 		return _duration;
 	}
 
+	/** @brief 系数, 从常数项开始 */
+	std::vector<T> getCoefficients() const
+	{
+		return std::vector<T>{_a, _b, _c};
+	}
+
 	/**> 给出f(x) = y的三组点, 求出并返回该二次多项式插补器 */
 	static PolynomialInterpolator2::ptr make(double x1,double x2,double x3,double y1,double y2,double y3,double duration)
 		{
@@ -173,11 +197,24 @@ public:
 	{
 		return 2*_c+6*_d*t;
 	}
+
+	void evaluate(double t, Derivatives<T>& result) const
+	{
+		result.x = _a+(_b+(_c+_d*t)*t)*t;
+		result.dx = _b+(2*_c+3*_d*t)*t;
+		result.ddx = 2*_c+6*_d*t;
+	}
 	double duration() const
 	{
 		return _duration;
 	}
 
+	/** @brief 系数, 从常数项开始 */
+	std::vector<T> getCoefficients() const
+	{
+		return std::vector<T>{_a, _b, _c, _d};
+	}
+
 	/**> 给出f(x) = y的四组点, 求出并返回该三次多项式插补器 */
 	static PolynomialInterpolator3::ptr make(double x1,double x2,double x3,double x4,double y1,double y2,double y3,double y4,double duration)
 	{
@@ -242,12 +279,24 @@ public:
 	{
 		return 2*_c+(6*_d+12*_e*t)*t;
 	}
+	void evaluate(double t, Derivatives<T>& result) const
+	{
+		result.x = _a+(_b+(_c+(_d+_e*t)*t)*t)*t;
+		result.dx = _b+(2*_c+(3*_d+4*_e*t)*t)*t;
+		result.ddx = 2*_c+(6*_d+12*_e*t)*t;
+	}
 
 	double duration() const
 	{
 		return _duration;
 	}
 
+	/** @brief 系数, 从常数项开始 */
+	std::vector<T> getCoefficients() const
+	{
+		return std::vector<T>{_a, _b, _c, _d, _e};
+	}
+
 	/**> 给出f(x) = y的五四组点, 求出并返回该四次多项式插补器 */
 	static PolynomialInterpolator4::ptr make(double x1,double x2,double x3,double x4,double x5,double y1,double y2,double y3,double y4,double y5,double duration)
 		{
@@ -314,12 +363,24 @@ public:
 	{
 		return 2*_c+(6*_d+(12*_e+20*_f*t)*t)*t;
 	}
+	void evaluate(double t, Derivatives<T>& result) const
+	{
+		result.x = _a+(_b+(_c+(_d+(_e+_f*t)*t)*t)*t)*t;
+		result.dx = _b+(2*_c+(3*_d+(4*_e+5*_f*t)*t)*t)*t;
+		result.ddx = 2*_c+(6*_d+(12*_e+20*_f*t)*t)*t;
+	}
 
 	double duration() const
 	{
 		return _duration;
 	}
 
+	/** @brief 系数, 从常数项开始 */
+	std::vector<T> getCoefficients() const
+	{
+		return std::vector<T>{_a, _b, _c, _d, _e, _f};
+	}
+
 	/**> 给出f(x) = y的六组点, 求出并返回该五次多项式插补器 */
 	static PolynomialInterpolator5::ptr make(double x1,double x2,double x3,double x4,double x5,double x6,double y1,double y2,double y3,double y4,double y5,double y6,double duration)
 		{
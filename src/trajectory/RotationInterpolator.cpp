@@ -45,12 +45,46 @@ Rotation3D<double> RotationInterpolator::x(double t) const
 
 Rotation3D<double> RotationInterpolator::dx(double t) const
 {
-
+	const double vel = _rad/_duration;
+	const double theta = vel*t;
+	const double s = sin(theta);
+	const double c = cos(theta);
+	const double n1 = _n(0), n2 = _n(1), n3 = _n(2);
+	return (_start*Rotation3D<double>(
+			-s*(n2*n2 + n3*n3), s*n1*n2 + c*n3, s*n1*n3 - c*n2,
+			s*n1*n2 - c*n3, -s*(n1*n1 + n3*n3), s*n2*n3 + c*n1,
+			s*n1*n3 + c*n2, s*n2*n3 - c*n1, -s*(n1*n1 + n2*n2)))*vel;
 }
 
 Rotation3D<double> RotationInterpolator::ddx(double t) const
 {
+	const double vel = _rad/_duration;
+	const double theta = vel*t;
+	const double s = sin(theta);
+	const double c = cos(theta);
+	const double n1 = _n(0), n2 = _n(1), n3 = _n(2);
+	return (_start*Rotation3D<double>(
+			-c*(n2*n2 + n3*n3), c*n1*n2 - s*n3, c*n1*n3 + s*n2,
+			c*n1*n2 + s*n3, -c*(n1*n1 + n3*n3), c*n2*n3 - s*n1,
+			c*n1*n3 - s*n2, c*n2*n3 + s*n1, -c*(n1*n1 + n2*n2)))*(vel*vel);
+}
 
+void RotationInterpolator::evaluate(double t, Derivatives<Rotation3D<double> >& result) const
+{
+	result.x = x(t);
+	const double vel = _rad/_duration;
+	const double theta = vel*t;
+	const double s = sin(theta);
+	const double c = cos(theta);
+	const double n1 = _n(0), n2 = _n(1), n3 = _n(2);
+	result.dx = (_start*Rotation3D<double>(
+			-s*(n2*n2 + n3*n3), s*n1*n2 + c*n3, s*n1*n3 - c*n2,
+			s*n1*n2 - c*n3, -s*(n1*n1 + n3*n3), s*n2*n3 + c*n1,
+			s*n1*n3 + c*n2, s*n2*n3 - c*n1, -s*(n1*n1 + n2*n2)))*vel;
+	result.ddx = (_start*Rotation3D<double>(
+			-c*(n2*n2 + n3*n3), c*n1*n2 - s*n3, c*n1*n3 + s*n2,
+			c*n1*n2 + s*n3, -c*(n1*n1 + n3*n3), c*n2*n3 - s*n1,
+			c*n1*n3 - s*n2, c*n2*n3 + s*n1, -c*(n1*n1 + n2*n2)))*(vel*vel);
 }
 
 double RotationInterpolator::duration() const
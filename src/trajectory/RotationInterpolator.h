@@ -41,6 +41,11 @@ public:
 
 	Rotation3D<double> ddx(double t) const;
 
+	/**
+	 * @brief 姿态, 速度和加速度, 三角函数只计算一次
+	 */
+	void evaluate(double t, Derivatives<Rotation3D<double> >& result) const;
+
 	double duration() const;
 
 	virtual ~RotationInterpolator();
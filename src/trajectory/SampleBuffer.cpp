@@ -0,0 +1,137 @@
+/*
+ * SampleBuffer.cpp
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: a1994846931931
+ */
+
+# include "SampleBuffer.h"
+# include <algorithm>
+# include <math.h>
+
+namespace robot {
+namespace trajectory {
+
+using robot::math::Q;
+
+SampleBuffer::SampleBuffer(int fields) : _fields(fields), _dof(0), _count(0)
+{
+	if ((fields & all) == 0 || (fields & ~all) != 0)
+		throw ("错误<SampleBuffer>: 采样的量必须是position, velocity, acceleration的组合!");
+}
+
+void SampleBuffer::resize(int dof, int count)
+{
+	if (dof < 0 || count < 0)
+		throw ("错误<SampleBuffer>: 关节数和采样点数不能小于0!");
+	_dof = dof;
+	_count = count;
+	_x.resize((_fields & position)? dof*count : 0);
+	_dx.resize((_fields & velocity)? dof*count : 0);
+	_ddx.resize((_fields & acceleration)? dof*count : 0);
+}
+
+void SampleBuffer::set(int index, const Q& x, const Q& dx, const Q& ddx)
+{
+	for (int j=0; j<_dof; j++)
+	{
+		const int k = j*_count + index;
+		if (_fields & position)
+			_x[k] = x[j];
+		if (_fields & velocity)
+			_dx[k] = dx[j];
+		if (_fields & acceleration)
+			_ddx[k] = ddx[j];
+	}
+}
+
+double* SampleBuffer::row(Field field, int joint)
+{
+	return data(field).data() + joint*_count;
+}
+
+const double* SampleBuffer::row(Field field, int joint) const
+{
+	return data(field).data() + joint*_count;
+}
+
+Q SampleBuffer::get(Field field, int index) const
+{
+	const std::vector<double>& values = data(field);
+	Q q = Q::zero(_dof);
+	for (int j=0; j<_dof; j++)
+		q(j) = values[j*_count + index];
+	return q;
+}
+
+std::vector<Q> SampleBuffer::toVector(Field field) const
+{
+	std::vector<Q> result;
+	result.reserve(_count);
+	for (int i=0; i<_count; i++)
+		result.push_back(get(field, i));
+	return result;
+}
+
+Q SampleBuffer::getMin(Field field) const
+{
+	if (_count <= 0)
+		throw ("错误<SampleBuffer>: 没有采样点!");
+	Q q = Q::zero(_dof);
+	for (int j=0; j<_dof; j++)
+		q(j) = *std::min_element(row(field, j), row(field, j) + _count);
+	return q;
+}
+
+Q SampleBuffer::getMax(Field field) const
+{
+	if (_count <= 0)
+		throw ("错误<SampleBuffer>: 没有采样点!");
+	Q q = Q::zero(_dof);
+	for (int j=0; j<_dof; j++)
+		q(j) = *std::max_element(row(field, j), row(field, j) + _count);
+	return q;
+}
+
+Q SampleBuffer::getMaxAbs(Field field) const
+{
+	Q q = Q::zero(_dof);
+	for (int j=0; j<_dof; j++)
+	{
+		const double* values = row(field, j);
+		double maxAbs = 0;
+		for (int i=0; i<_count; i++)
+			maxAbs = std::max(maxAbs, fabs(values[i]));
+		q(j) = maxAbs;
+	}
+	return q;
+}
+
+std::vector<double> SampleBuffer::timeGrid(double duration, int count)
+{
+	if (count < 1)
+		throw ("错误<SampleBuffer>: 采样点数不能小于1!");
+	std::vector<double> times(count, 0.0);
+	for (int i=1; i<count; i++)
+		times[i] = duration*i/(count - 1);
+	return times;
+}
+
+std::vector<double>& SampleBuffer::data(Field field)
+{
+	return const_cast<std::vector<double>&>(static_cast<const SampleBuffer*>(this)->data(field));
+}
+
+const std::vector<double>& SampleBuffer::data(Field field) const
+{
+	if ((_fields & field) == 0 || (field != position && field != velocity && field != acceleration))
+		throw ("错误<SampleBuffer>: 没有采样这个量!");
+	if (field == position)
+		return _x;
+	if (field == velocity)
+		return _dx;
+	return _ddx;
+}
+
+} /* namespace trajectory */
+} /* namespace robot */
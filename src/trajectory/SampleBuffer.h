@@ -0,0 +1,115 @@
+/**
+ * @brief SampleBuffer类
+ * @date Oct 16, 2026
+ * @author a1994846931931
+ */
+
+#ifndef SAMPLEBUFFER_H_
+#define SAMPLEBUFFER_H_
+
+# include "../math/Q.h"
+# include <vector>
+
+namespace robot {
+namespace trajectory {
+
+/** @addtogroup trajectory
+ * @{
+ */
+
+/**
+ * @brief 关节轨迹的批量采样结果
+ *
+ * 按关节连续存放(structure of arrays): 第j个关节在各时刻的关节角连续保存在row(position, j)[0, size())中,
+ * 速度和加速度相同. 只保存构造时指定的量. 由Interpolator<Q>::sampleInto填充, 重复使用同一个缓冲区时不重新分配内存.
+ */
+class SampleBuffer {
+public:
+	/** @brief 采样的量, 可以按位组合 */
+	enum Field{
+		position = 1, /**< 关节角 */
+		velocity = 2, /**< 速度 */
+		acceleration = 4, /**< 加速度 */
+		all = 7 /**< 全部 */
+	};
+
+	/**
+	 * @brief 构造函数
+	 * @param fields [in] 采样的量(Field的组合)
+	 */
+	SampleBuffer(int fields=all);
+
+	/**
+	 * @brief 设置大小
+	 * @param dof [in] 关节数
+	 * @param count [in] 采样点数
+	 */
+	void resize(int dof, int count);
+
+	/**
+	 * @brief 保存第index个采样点, 只保存构造时指定的量
+	 */
+	void set(int index, const robot::math::Q& x, const robot::math::Q& dx, const robot::math::Q& ddx);
+
+	/** @brief 采样的量(Field的组合) */
+	inline int fields() const {return _fields;}
+
+	/** @brief 关节数 */
+	inline int dof() const {return _dof;}
+
+	/** @brief 采样点数 */
+	inline int size() const {return _count;}
+
+	/**
+	 * @brief 某个量的第joint个关节在各时刻的值
+	 * @param field [in] position, velocity或acceleration, 必须是构造时指定的量
+	 * @param joint [in] 关节序号
+	 * @return 指向size()个连续数值的指针
+	 */
+	double* row(Field field, int joint);
+	const double* row(Field field, int joint) const;
+
+	/** @brief 某个量在第index个时刻的值 */
+	robot::math::Q get(Field field, int index) const;
+
+	/** @brief 某个量在各时刻的值 */
+	std::vector<robot::math::Q> toVector(Field field) const;
+
+	/** @brief 某个量在各时刻的最小值(每个关节分别取) */
+	robot::math::Q getMin(Field field) const;
+
+	/** @brief 某个量在各时刻的最大值(每个关节分别取) */
+	robot::math::Q getMax(Field field) const;
+
+	/** @brief 某个量在各时刻的最大绝对值(每个关节分别取) */
+	robot::math::Q getMaxAbs(Field field) const;
+
+	/**
+	 * @brief 等间距的时刻
+	 * @param duration [in] 总时长
+	 * @param count [in] 采样点数, 不小于1
+	 * @return 第i个为duration*i/(count - 1), 最后一个正好是duration(不累加步长, 不会丢失最后一个点)
+	 */
+	static std::vector<double> timeGrid(double duration, int count);
+
+	virtual ~SampleBuffer(){}
+private:
+	/** @brief 某个量的存储 */
+	std::vector<double>& data(Field field);
+	const std::vector<double>& data(Field field) const;
+private:
+	int _fields;
+	int _dof;
+	int _count;
+
+	/** @brief 关节角, 速度和加速度, 每个_dof*_count个, 按关节连续存放 */
+	std::vector<double> _x;
+	std::vector<double> _dx;
+	std::vector<double> _ddx;
+};
+
+/** @} */
+} /* namespace trajectory */
+} /* namespace robot */
+
+#endif /* SAMPLEBUFFER_H_ */
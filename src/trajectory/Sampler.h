@@ -43,26 +43,16 @@ template< class T=double>
 		 */
 		static vector<T> sample(std::shared_ptr<Interpolator<T> > ipr, int count, const char* method_c="x")
 		{
-			std::function<T(double)> method;
+			int field = SampleBuffer::position;
 			if (std::string(method_c).compare(string("x")) == 0)
-				method = [&](double t){return ipr->x(t);};
+				field = SampleBuffer::position;
 			else if (std::string(method_c).compare(string("dx")) == 0)
-				method = [&](double t){return ipr->dx(t);};
+				field = SampleBuffer::velocity;
 			else if (std::string(method_c).compare(string("ddx")) == 0)
-				method = [&](double t){return ipr->ddx(t);};
+				field = SampleBuffer::acceleration;
 			else
-			{
 				cout << "未识别采样方法, 改为x(t)\n";
-				method = [&](double t){return ipr->x(t);};
-			}
-			double duration = ipr->duration();
-			double dt = duration/(count - 1);
-			vector<double> t;
-			for (int i=0; i<count; i++)
-			{
-				t.push_back(i*dt);
-			}
-			return sample(t, method);
+			return sampleField(*ipr, SampleBuffer::timeGrid(ipr->duration(), count), field);
 		}
 
 		/**
@@ -74,6 +64,7 @@ template< class T=double>
 		static vector<T> sample(vector<double> t, std::function<T(double)> method)
 		{
 			vector<T> result;
+			result.reserve(t.size());
 			for (auto it=t.begin(); it != t.end(); it++)
 				result.push_back(method(*it));
 			return result;
@@ -99,6 +90,37 @@ template< class T=double>
 		}
 
 		virtual ~Sampler(){}
+	private:
+		/**
+		 * @brief 在给定的时刻上对x, dx或ddx采样
+		 * @param field [in] SampleBuffer::position, velocity或acceleration
+		 */
+		template<class U>
+		static vector<U> sampleField(const Interpolator<U>& ipr, const vector<double>& t, int field)
+		{
+			vector<U> result;
+			result.reserve(t.size());
+			for (auto it=t.begin(); it != t.end(); it++)
+			{
+				if (field == SampleBuffer::velocity)
+					result.push_back(ipr.dx(*it));
+				else if (field == SampleBuffer::acceleration)
+					result.push_back(ipr.ddx(*it));
+				else
+					result.push_back(ipr.x(*it));
+			}
+			return result;
+		}
+
+		/**
+		 * @brief 关节插补器通过Interpolator<Q>::sampleInto采样
+		 */
+		static vector<Q> sampleField(const Interpolator<Q>& ipr, const vector<double>& t, int field)
+		{
+			SampleBuffer buffer(field);
+			ipr.sampleInto(t, buffer);
+			return buffer.toVector((SampleBuffer::Field)field);
+		}
 	};
 
 /** @} */
@@ -86,43 +86,109 @@ public:
 
 	T x(double t) const
 	{
-		if (_timeSequence.empty())
-			throw("错误<SequenceInterpolator>: 插补器时间序列为空!");
-		auto it = upper_bound(_timeSequence.begin(), _timeSequence.end(), t);
-		if (it == _timeSequence.end()) it--;
-		int idx = it - _timeSequence.begin();
-		return (it == _timeSequence.begin())? _interpolatorSequence[0]->x(t):
-				_interpolatorSequence[idx]->x(t - _timeSequence[idx - 1]);
+		double local;
+		const int idx = locate(t, local);
+		return _interpolatorSequence[idx]->x(local);
 	}
 
 	T dx(double t) const
 	{
-		if (_timeSequence.empty())
-			throw("错误<SequenceInterpolator>: 插补器时间序列为空!");
-		auto it = upper_bound(_timeSequence.begin(), _timeSequence.end(), t);
-		if (it == _timeSequence.end()) it--;
-		int idx = it - _timeSequence.begin();
-		return (it == _timeSequence.begin())? _interpolatorSequence[0]->dx(t):
-				_interpolatorSequence[idx]->dx(t - _timeSequence[idx - 1]);
+		double local;
+		const int idx = locate(t, local);
+		return _interpolatorSequence[idx]->dx(local);
 	}
 
 	T ddx(double t) const
+	{
+		double local;
+		const int idx = locate(t, local);
+		return _interpolatorSequence[idx]->ddx(local);
+	}
+
+	/**
+	 * @brief 位置, 速度和加速度, 只查找一次所在的插补器
+	 */
+	void evaluate(double t, Derivatives<T>& result) const
+	{
+		double local;
+		const int idx = locate(t, local);
+		_interpolatorSequence[idx]->evaluate(local, result);
+	}
+
+	/**
+	 * @brief 带游标的evaluate, 从游标所在的插补器向后查找
+	 */
+	void evaluate(double t, Derivatives<T>& result, PlaybackCursor& cursor) const
+	{
+		double local;
+		const int idx = locate(t, local, cursor);
+		_interpolatorSequence[idx]->evaluate(local, result);
+	}
+
+	double duration() const
+	{
+		return *(_timeSequence.end() - 1);
+	}
+
+	/** @brief 插补器的个数 */
+	int size() const
+	{
+		return (int)_interpolatorSequence.size();
+	}
+
+	/** @brief 第index个插补器 */
+	std::shared_ptr<Interpolator<T> > getInterpolator(int index) const
+	{
+		return _interpolatorSequence[index];
+	}
+
+	virtual ~SequenceInterpolator(){}
+private:
+	/**
+	 * @brief 查找t所在的插补器
+	 * @param t [in] 时间
+	 * @param local [out] 在该插补器中的时间
+	 * @return 插补器的序号, 超出总时长时为最后一个
+	 */
+	int locate(double t, double& local) const
 	{
 		if (_timeSequence.empty())
 			throw("错误<SequenceInterpolator>: 插补器时间序列为空!");
 		auto it = upper_bound(_timeSequence.begin(), _timeSequence.end(), t);
 		if (it == _timeSequence.end()) it--;
-		int idx = it - _timeSequence.begin();
-		return (it == _timeSequence.begin())? _interpolatorSequence[0]->ddx(t):
-				_interpolatorSequence[idx]->ddx(t - _timeSequence[idx - 1]);
+		const int idx = it - _timeSequence.begin();
+		local = (idx == 0)? t : (t - _timeSequence[idx - 1]);
+		return idx;
 	}
 
-	double duration() const
+	/**
+	 * @brief 从游标所在的插补器开始查找t所在的插补器
+	 * @param t [in] 时间
+	 * @param local [out] 在该插补器中的时间
+	 * @param cursor [in,out] 游标, 更新为找到的插补器
+	 * @return 插补器的序号, 与locate(t, local)相同
+	 *
+	 * t不早于游标所在插补器的开始时刻时, 最多向后前进cursorSteps个插补器; 时间回退或跳过更多的插补器时二分查找.
+	 */
+	int locate(double t, double& local, PlaybackCursor& cursor) const
 	{
-		return *(_timeSequence.end() - 1);
+		const int n = (int)_timeSequence.size();
+		int idx = cursor.index;
+		if (idx >= 0 && idx < n && (idx == 0 || t >= _timeSequence[idx - 1]))
+		{
+			for (int step=0; step<cursorSteps && idx < n - 1 && t >= _timeSequence[idx]; step++)
+				idx++;
+		}
+		if (idx < 0 || idx >= n || (idx > 0 && t < _timeSequence[idx - 1]) || (idx < n - 1 && t >= _timeSequence[idx]))
+			idx = locate(t, local);
+		else
+			local = (idx == 0)? t : (t - _timeSequence[idx - 1]);
+		cursor.index = idx;
+		return idx;
 	}
 
-	virtual ~SequenceInterpolator(){}
+	/** @brief 游标向后顺序查找的最多步数 */
+	static const int cursorSteps = 4;
 private:
 	/** @brief 插补器序列 */
 	std::vector<std::shared_ptr<Interpolator<T> > > _interpolatorSequence;
@@ -44,41 +44,49 @@ Trajectory::Trajectory(std::pair<Interpolator<Vector3D<double> >::ptr , Interpol
 
 Trajectory::qVelAcc Trajectory::sampleVelAcc(const int count, double precision)
 {
-	Q lastQ;
-	vector<Q> dq;
-	vector<Q> ddq;
 	double L = this->duration();
 	double dl = L/(double)(count - 1);
-	State state = this->getState(0);
-	lastQ = state.getAngle();
-	dq.push_back(state.getVelocity());
-	ddq.push_back(state.getAcceleration());
-	double l=dl; int i=1;
-	for (; i<count; i++, l+=dl)
+	SampleBuffer buffer(SampleBuffer::all);
+	this->sampleInto(SampleBuffer::timeGrid(L, count), buffer);
+	struct qVelAcc result;
+	result.ddq = buffer.toVector(SampleBuffer::acceleration);
+	if (isDifferential())
+		result.dq = buffer.toVector(SampleBuffer::velocity);
+	else
 	{
-		state = this->getState(l);
-		ddq.push_back(state.getAcceleration());
-		dq.push_back((state.getAngle() - lastQ)/dl); //用平均速度来代替瞬时速度
-		lastQ = state.getAngle();
+		result.dq.reserve(buffer.size());
+		result.dq.push_back(buffer.get(SampleBuffer::velocity, 0));
+		for (int i=1; i<buffer.size(); i++)
+			result.dq.push_back((buffer.get(SampleBuffer::position, i) - buffer.get(SampleBuffer::position, i - 1))/dl); //用平均速度来代替瞬时速度
 	}
-	struct qVelAcc result;
-	result.dq = dq;
-	result.ddq = ddq;
 	return result;
 }
 
 vector<Q> Trajectory::sampleVel(const int count, double precision)
 {
 	vector<Q> dq;
-	double L = this->duration();
-	double dl = L/(double)(count - 1);
-	Q tempQ1 = _ikSolver->solve(HTransform3D<double>(_posInterpolator->x(0), _rotInterpolator->x(0)), _config)[0];
-	Q tempQ2 = Q::zero(tempQ1.size());
-	for (double l=0; l<=L; l+=dl)
+	vector<double> samples = SampleBuffer::timeGrid(this->duration(), count);
+	/**> 每个采样点l与l + precision的位姿放在一起批量逆解 */
+	const int size = (int)samples.size();
+	TransformBatch poses(2*size);
+	for (int i=0; i<size; i++)
+	{
+		const double l = samples[i];
+		poses.set(2*i, HTransform3D<double>(_posInterpolator->x(l), _rotInterpolator->x(l)));
+		poses.set(2*i + 1, HTransform3D<double>(_posInterpolator->x(l + precision), _rotInterpolator->x(l + precision)));
+	}
+	vector<Q> q(2*size);
+	vector<robot::ik::IKStatus> status(2*size);
+	_ikSolver->solveBatch(poses, _config, q.data(), status.data());
+	for (int i=0; i<size; i++)
 	{
-		Q tempQ1 = _ikSolver->solve(HTransform3D<double>(_posInterpolator->x(l), _rotInterpolator->x(l)), _config)[0];
-		Q tempQ2 = _ikSolver->solve(HTransform3D<double>(_posInterpolator->x(l + precision), _rotInterpolator->x(l + precision)), _config)[0];
-		dq.push_back((tempQ2 - tempQ1)/precision);
+		for (int k=2*i; k<2*i + 2; k++)
+		{
+			if (status[k] != robot::ik::ikSuccess)
+				throw(std::string("错误<Trajectory>: 无法进行逆解!\n")
+						+ ((status[k] == robot::ik::ikOutOfRange) ? "没有符合范围的解!" : "没有解!"));
+		}
+		dq.push_back((q[2*i + 1] - q[2*i])/precision);
 	}
 	return dq;
 }